@@ -23,9 +23,12 @@
 #ifndef PICOLIBRARY_ALGORITHM_H
 #define PICOLIBRARY_ALGORITHM_H
 
+#include <cstddef>
+#include <cstring>
 #include <type_traits>
 #include <utility>
 
+#include "picolibrary/iterator.h"
 #include "picolibrary/result.h"
 #include "picolibrary/void.h"
 
@@ -77,12 +80,18 @@ template<typename Iterator, typename Functor>
 constexpr auto for_each( Iterator begin, Iterator end, Functor functor, Return_Functor ) noexcept
     -> Result<Functor, typename std::invoke_result_t<Functor, decltype( *std::declval<Iterator>() )>::Error>
 {
-    for ( ; begin != end; ++begin ) {
-        auto result = functor( *begin );
-        if ( result.is_error() ) {
-            return result.error();
-        } // if
-    }     // for
+    if constexpr ( std::is_same_v<typename std::invoke_result_t<Functor, decltype( *std::declval<Iterator>() )>::Error, Void> ) {
+        for ( ; begin != end; ++begin ) {
+            static_cast<void>( functor( *begin ) );
+        } // for
+    } else {
+        for ( ; begin != end; ++begin ) {
+            auto result = functor( *begin );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // for
+    }         // else
 
     return functor;
 }
@@ -121,12 +130,18 @@ template<typename Iterator, typename Functor>
 constexpr auto for_each( Iterator begin, Iterator end, Functor functor, Discard_Functor ) noexcept
     -> Result<Void, typename std::invoke_result_t<Functor, decltype( *std::declval<Iterator>() )>::Error>
 {
-    for ( ; begin != end; ++begin ) {
-        auto result = functor( *begin );
-        if ( result.is_error() ) {
-            return result.error();
-        } // if
-    }     // for
+    if constexpr ( std::is_same_v<typename std::invoke_result_t<Functor, decltype( *std::declval<Iterator>() )>::Error, Void> ) {
+        for ( ; begin != end; ++begin ) {
+            static_cast<void>( functor( *begin ) );
+        } // for
+    } else {
+        for ( ; begin != end; ++begin ) {
+            auto result = functor( *begin );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // for
+    }         // else
 
     return {};
 }
@@ -172,6 +187,158 @@ constexpr auto for_each( Iterator begin, Iterator end, Functor functor ) noexcep
     return for_each( begin, end, std::move( functor ), Functor_Policy{} );
 }
 
+/**
+ * \brief Apply a functor to the first n elements of a range.
+ *
+ * \tparam Iterator Range iterator.
+ * \tparam Size The type used to hold the number of elements to apply the functor to.
+ * \tparam Functor A unary functor that takes the iterated over type by value or const
+ *         reference, and returns either picolibrary::Result<picolibrary::Void,
+ *         picolibrary::Error_Code> or picolibrary::Result<picolibrary::Void,
+ *         picolibrary::Void>. If an error is returned by the functor, iteration halts,
+ *         and the error is returned. Illustrative signatures:
+ * \code
+ * auto functor( auto value ) noexcept
+ *     -> picolibrary::Result<picolibrary::Void, picolibrary::Error_Code>;
+ *
+ * auto functor( auto const & value ) noexcept
+ *     -> picolibrary::Result<picolibrary::Void, picolibrary::Error_Code>;
+ *
+ * auto functor( auto value ) noexcept
+ *     -> picolibrary::Result<picolibrary::Void, picolibrary::Void>;
+ *
+ * auto functor( auto const & value ) noexcept
+ *     -> picolibrary::Result<picolibrary::Void, picolibrary::Void>;
+ * \endcode
+ *
+ * \param[in] begin The beginning of the range to apply the functor to.
+ * \param[in] n The number of elements to apply the functor to.
+ * \param[in] functor The functor to apply to the range.
+ *
+ * \return The functor if application of the functor to the range succeeded.
+ * \return An error code if application of the functor to the range failed.
+ */
+template<typename Iterator, typename Size, typename Functor>
+constexpr auto for_each_n( Iterator begin, Size n, Functor functor, Return_Functor ) noexcept
+    -> Result<Functor, typename std::invoke_result_t<Functor, decltype( *std::declval<Iterator>() )>::Error>
+{
+    if constexpr ( is_contiguous_iterator_v<Iterator> ) {
+        return for_each( begin, begin + n, std::move( functor ), Return_Functor{} );
+    } else if constexpr ( std::is_same_v<typename std::invoke_result_t<Functor, decltype( *std::declval<Iterator>() )>::Error, Void> ) {
+        for ( ; n; --n, ++begin ) {
+            static_cast<void>( functor( *begin ) );
+        } // for
+
+        return functor;
+    } else {
+        for ( ; n; --n, ++begin ) {
+            auto result = functor( *begin );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // for
+
+        return functor;
+    } // else
+}
+
+/**
+ * \brief Apply a functor to the first n elements of a range.
+ *
+ * \tparam Iterator Range iterator.
+ * \tparam Size The type used to hold the number of elements to apply the functor to.
+ * \tparam Functor A unary functor that takes the iterated over type by value or const
+ *         reference, and returns either picolibrary::Result<picolibrary::Void,
+ *         picolibrary::Error_Code> or picolibrary::Result<picolibrary::Void,
+ *         picolibrary::Void>. If an error is returned by the functor, iteration halts,
+ *         and the error is returned. Illustrative signatures:
+ * \code
+ * auto functor( auto value ) noexcept
+ *     -> picolibrary::Result<picolibrary::Void, picolibrary::Error_Code>;
+ *
+ * auto functor( auto const & value ) noexcept
+ *     -> picolibrary::Result<picolibrary::Void, picolibrary::Error_Code>;
+ *
+ * auto functor( auto value ) noexcept
+ *     -> picolibrary::Result<picolibrary::Void, picolibrary::Void>;
+ *
+ * auto functor( auto const & value ) noexcept
+ *     -> picolibrary::Result<picolibrary::Void, picolibrary::Void>;
+ * \endcode
+ *
+ * \param[in] begin The beginning of the range to apply the functor to.
+ * \param[in] n The number of elements to apply the functor to.
+ * \param[in] functor The functor to apply to the range.
+ *
+ * \return Nothing if application of the functor to the range succeeded.
+ * \return An error code if application of the functor to the range failed.
+ */
+template<typename Iterator, typename Size, typename Functor>
+constexpr auto for_each_n( Iterator begin, Size n, Functor functor, Discard_Functor ) noexcept
+    -> Result<Void, typename std::invoke_result_t<Functor, decltype( *std::declval<Iterator>() )>::Error>
+{
+    if constexpr ( is_contiguous_iterator_v<Iterator> ) {
+        return for_each( begin, begin + n, std::move( functor ), Discard_Functor{} );
+    } else if constexpr ( std::is_same_v<typename std::invoke_result_t<Functor, decltype( *std::declval<Iterator>() )>::Error, Void> ) {
+        for ( ; n; --n, ++begin ) {
+            static_cast<void>( functor( *begin ) );
+        } // for
+
+        return {};
+    } else {
+        for ( ; n; --n, ++begin ) {
+            auto result = functor( *begin );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // for
+
+        return {};
+    } // else
+}
+
+/**
+ * \brief Apply a functor to the first n elements of a range.
+ *
+ * \tparam Functor_Policy The functor policy (either picolibrary::Return_Functor, or
+ *         picolibrary::Discard_Functor) to use.
+ * \tparam Iterator Range iterator.
+ * \tparam Size The type used to hold the number of elements to apply the functor to.
+ * \tparam Functor A unary functor that takes the iterated over type by value or const
+ *         reference, and returns either picolibrary::Result<picolibrary::Void,
+ *         picolibrary::Error_Code> or picolibrary::Result<picolibrary::Void,
+ *         picolibrary::Void>. If an error is returned by the functor, iteration halts,
+ *         and the error is returned. Illustrative signatures:
+ * \code
+ * auto functor( auto value ) noexcept
+ *     -> picolibrary::Result<picolibrary::Void, picolibrary::Error_Code>;
+ *
+ * auto functor( auto const & value ) noexcept
+ *     -> picolibrary::Result<picolibrary::Void, picolibrary::Error_Code>;
+ *
+ * auto functor( auto value ) noexcept
+ *     -> picolibrary::Result<picolibrary::Void, picolibrary::Void>;
+ *
+ * auto functor( auto const & value ) noexcept
+ *     -> picolibrary::Result<picolibrary::Void, picolibrary::Void>;
+ * \endcode
+ *
+ * \param[in] begin The beginning of the range to apply the functor to.
+ * \param[in] n The number of elements to apply the functor to.
+ * \param[in] functor The functor to apply to the range.
+ *
+ * \return The functor if Functor_Policy is picolibrary::Return_Functor and application of
+ *         the functor to the range succeeded.
+ * \return Nothing if Functor_Policy is picolibrary::Discard_Functor and application of
+ *         the functor to the range succeeded.
+ * \return An error code if application of the functor to the range failed.
+ */
+template<typename Functor_Policy, typename Iterator, typename Size, typename Functor>
+constexpr auto for_each_n( Iterator begin, Size n, Functor functor ) noexcept
+{
+    return for_each_n( begin, n, std::move( functor ), Functor_Policy{} );
+}
+
 /**
  * \brief Fill a range with values generated by a functor.
  *
@@ -198,18 +365,149 @@ template<typename Iterator, typename Functor>
 constexpr auto generate( Iterator begin, Iterator end, Functor functor ) noexcept
     -> Result<Void, typename std::invoke_result_t<Functor>::Error>
 {
-    while ( begin != end ) {
-        auto result = functor();
-        if ( result.is_error() ) {
-            return result.error();
-        } // if
+    if constexpr ( std::is_same_v<typename std::invoke_result_t<Functor>::Error, Void> ) {
+        while ( begin != end ) {
+            *begin++ = functor().value();
+        } // while
+    } else {
+        while ( begin != end ) {
+            auto result = functor();
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
 
-        *begin++ = result.value();
-    } // for
+            *begin++ = result.value();
+        } // while
+    }     // else
 
     return {};
 }
 
+/**
+ * \brief Write the result of applying a functor to each element of a range to another
+ *        range.
+ *
+ * \tparam Input_Iterator Input range iterator.
+ * \tparam Output_Iterator Output range iterator.
+ * \tparam Functor A unary functor that takes the iterated over type by value or const
+ *         reference, and returns either picolibrary::Result<Foo,
+ *         picolibrary::Error_Code> or picolibrary::Result<Foo, picolibrary::Void> where
+ *         Foo is a type that can be assigned to a dereferenced Output_Iterator. If an
+ *         error is returned by the functor, iteration halts, and the error is returned.
+ *         Illustrative signatures:
+ * \code
+ * auto functor( auto value ) noexcept -> picolibrary::Result<Foo, picolibrary::Error_Code>;
+ *
+ * auto functor( auto const & value ) noexcept -> picolibrary::Result<Foo, picolibrary::Void>;
+ * \endcode
+ *
+ * \param[in] begin The beginning of the range to apply the functor to.
+ * \param[in] end The end of the range to apply the functor to.
+ * \param[out] destination The beginning of the range to write the results to.
+ * \param[in] functor The functor to apply to the range.
+ *
+ * \return Nothing if transforming the range succeeded.
+ * \return An error code if transforming the range failed.
+ */
+template<typename Input_Iterator, typename Output_Iterator, typename Functor>
+constexpr auto transform( Input_Iterator begin, Input_Iterator end, Output_Iterator destination, Functor functor ) noexcept
+    -> Result<Void, typename std::invoke_result_t<Functor, decltype( *std::declval<Input_Iterator>() )>::Error>
+{
+    if constexpr ( std::is_same_v<typename std::invoke_result_t<Functor, decltype( *std::declval<Input_Iterator>() )>::Error, Void> ) {
+        for ( ; begin != end; ++begin, ++destination ) {
+            *destination = functor( *begin ).value();
+        } // for
+    } else {
+        for ( ; begin != end; ++begin, ++destination ) {
+            auto result = functor( *begin );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            *destination = result.value();
+        } // for
+    }     // else
+
+    return {};
+}
+
+/**
+ * \brief Assign a value to each element of a range.
+ *
+ * \tparam Iterator Range iterator.
+ * \tparam T The type of value to assign.
+ *
+ * \attention If Iterator is a contiguous iterator, and the iterated over type is a
+ *            trivially copyable byte sized type, the range is filled using std::memset().
+ *
+ * \param[out] begin The beginning of the range to fill.
+ * \param[out] end The end of the range to fill.
+ * \param[in] value The value to assign to each element of the range.
+ */
+template<typename Iterator, typename T>
+void fill( Iterator begin, Iterator end, T const & value ) noexcept
+{
+    using Value = std::remove_cv_t<std::remove_reference_t<decltype( *begin )>>;
+
+    if constexpr (
+        is_contiguous_iterator_v<Iterator> and std::is_trivially_copyable_v<Value>
+        and sizeof( Value ) == 1 and std::is_convertible_v<T, Value> ) {
+        if ( begin != end ) {
+            auto const byte    = static_cast<Value>( value );
+            auto       pattern = static_cast<unsigned char>( 0 );
+            std::memcpy( &pattern, &byte, 1 );
+            std::memset( &*begin, pattern, static_cast<std::size_t>( end - begin ) );
+        } // if
+    } else {
+        for ( ; begin != end; ++begin ) {
+            *begin = value;
+        } // for
+    }     // else
+}
+
+/**
+ * \brief Copy a range to another range.
+ *
+ * \tparam Input_Iterator Input range iterator.
+ * \tparam Output_Iterator Output range iterator.
+ *
+ * \attention If both Input_Iterator and Output_Iterator are contiguous iterators, and
+ *            they iterate over the same trivially copyable type, the range is copied
+ *            using std::memmove().
+ *
+ * \warning If destination is in the range [begin,end), the behavior is undefined.
+ *
+ * \param[in] begin The beginning of the range to copy.
+ * \param[in] end The end of the range to copy.
+ * \param[out] destination The beginning of the range to copy to.
+ *
+ * \return The end of the range that was copied to.
+ */
+template<typename Input_Iterator, typename Output_Iterator>
+auto copy( Input_Iterator begin, Input_Iterator end, Output_Iterator destination ) noexcept -> Output_Iterator
+{
+    using Input_Value = std::remove_cv_t<std::remove_reference_t<decltype( *begin )>>;
+    using Output_Value = std::remove_reference_t<decltype( *destination )>;
+
+    if constexpr (
+        is_contiguous_iterator_v<Input_Iterator> and is_contiguous_iterator_v<Output_Iterator>
+        and std::is_same_v<Input_Value, Output_Value> and std::is_trivially_copyable_v<Input_Value> ) {
+        auto const size = end - begin;
+
+        if ( size > 0 ) {
+            std::memmove( &*destination, &*begin, static_cast<std::size_t>( size ) * sizeof( Input_Value ) );
+        } // if
+
+        return destination + size;
+    } else {
+        for ( ; begin != end; ++begin, ++destination ) {
+            *destination = *begin;
+        } // for
+
+        return destination;
+    } // else
+}
+
 } // namespace picolibrary
 
 #endif // PICOLIBRARY_ALGORITHM_H
@@ -0,0 +1,208 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arena interface.
+ */
+
+#ifndef PICOLIBRARY_ARENA_H
+#define PICOLIBRARY_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace picolibrary {
+
+/**
+ * \brief Fixed size monotonic arena allocator.
+ *
+ * Memory is allocated by advancing a position within a statically allocated buffer.
+ * Individual allocations are never freed. Instead, the arena is rewound to a previously
+ * recorded position (e.g. at the end of a transaction), or reset.
+ *
+ * The arena's constructor is constexpr, so an arena with static storage duration is
+ * constant initialized.
+ *
+ * \tparam N The arena size (bytes).
+ */
+template<std::size_t N>
+class Arena {
+  public:
+    static_assert( N );
+
+    /**
+     * \brief Allocation size (bytes).
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief Arena position.
+     */
+    using Position = std::size_t;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Arena() noexcept = default;
+
+    Arena( Arena && ) = delete;
+
+    Arena( Arena const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Arena() noexcept = default;
+
+    auto operator=( Arena && ) = delete;
+
+    auto operator=( Arena const & ) = delete;
+
+    /**
+     * \brief Get the arena size.
+     *
+     * \return The arena size (bytes).
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get the number of bytes that have been allocated (including alignment
+     *        padding).
+     *
+     * \return The number of bytes that have been allocated.
+     */
+    constexpr auto used() const noexcept -> Size
+    {
+        return m_position;
+    }
+
+    /**
+     * \brief Get the number of bytes that have not been allocated.
+     *
+     * \return The number of bytes that have not been allocated.
+     */
+    constexpr auto available() const noexcept -> Size
+    {
+        return N - m_position;
+    }
+
+    /**
+     * \brief Allocate memory.
+     *
+     * \warning If alignment is not a power of two, the behavior is undefined.
+     *
+     * \param[in] size The size (bytes) of the memory to allocate.
+     * \param[in] alignment The alignment of the memory to allocate.
+     *
+     * \return A pointer to the allocated memory if the allocation succeeded.
+     * \return A null pointer if the arena has insufficient memory available.
+     */
+    auto allocate( Size size, Size alignment = alignof( std::max_align_t ) ) noexcept -> void *
+    {
+        auto const address = reinterpret_cast<std::uintptr_t>( &m_buffer[ 0 ] ) + m_position;
+        auto const padding = static_cast<Size>( ( alignment - ( address & ( alignment - 1 ) ) ) & ( alignment - 1 ) );
+
+        if ( padding > available() or size > available() - padding ) {
+            return nullptr;
+        } // if
+
+        auto const memory = &m_buffer[ m_position + padding ];
+
+        m_position += padding + size;
+
+        return memory;
+    }
+
+    /**
+     * \brief Allocate and construct an object.
+     *
+     * \tparam T The type of object to allocate and construct. Must be trivially
+     *         destructible since the arena never destroys objects.
+     * \tparam Arguments Object constructor argument types.
+     *
+     * \param[in] arguments Object constructor arguments.
+     *
+     * \return A pointer to the constructed object if the allocation succeeded.
+     * \return A null pointer if the arena has insufficient memory available.
+     */
+    template<typename T, typename... Arguments>
+    auto create( Arguments &&... arguments ) noexcept -> T *
+    {
+        static_assert( std::is_trivially_destructible_v<T> );
+
+        auto const memory = allocate( sizeof( T ), alignof( T ) );
+        if ( not memory ) {
+            return nullptr;
+        } // if
+
+        return new ( memory ) T( std::forward<Arguments>( arguments )... );
+    }
+
+    /**
+     * \brief Get the arena's current position.
+     *
+     * \return The arena's current position.
+     */
+    constexpr auto position() const noexcept -> Position
+    {
+        return m_position;
+    }
+
+    /**
+     * \brief Free all memory allocated after a previously recorded position.
+     *
+     * \warning If position was not previously returned by
+     *          picolibrary::Arena::position(), or memory allocated before position was
+     *          recorded has already been freed, the behavior is undefined.
+     *
+     * \param[in] position The position to rewind the arena to.
+     */
+    constexpr void rewind( Position position ) noexcept
+    {
+        m_position = position;
+    }
+
+    /**
+     * \brief Free all allocated memory.
+     */
+    constexpr void reset() noexcept
+    {
+        m_position = 0;
+    }
+
+  private:
+    /**
+     * \brief The arena's memory.
+     */
+    alignas( std::max_align_t ) unsigned char m_buffer[ N ]{};
+
+    /**
+     * \brief The arena's current position.
+     */
+    Position m_position{};
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_ARENA_H
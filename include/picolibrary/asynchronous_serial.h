@@ -23,11 +23,17 @@
 #ifndef PICOLIBRARY_ASYNCHRONOUS_SERIAL_H
 #define PICOLIBRARY_ASYNCHRONOUS_SERIAL_H
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
+#include <utility>
 
 #include "picolibrary/algorithm.h"
+#include "picolibrary/clock.h"
 #include "picolibrary/error.h"
 #include "picolibrary/result.h"
+#include "picolibrary/spsc_ring.h"
 #include "picolibrary/void.h"
 
 /**
@@ -206,6 +212,560 @@ class Transmitter : public Basic_Transmitter {
     }
 };
 
+/**
+ * \brief Asynchronous serial non-blocking transmitter concept.
+ *
+ * A non-blocking transmitter transmits blocks of data in the background (e.g. using DMA
+ * or a transmit interrupt). Starting a transmission returns immediately, and the
+ * transmitter reports the completion of the transmission by calling its completion
+ * handler, and through its transmission completion status.
+ */
+class Non_Blocking_Transmitter_Concept {
+  public:
+    /**
+     * \brief The integral type used to hold the data to be transmitted.
+     */
+    using Data = std::uint8_t;
+
+    /**
+     * \brief Transmission completion handler.
+     *
+     * \attention Transmission completion handlers may be called from an interrupt
+     *            context.
+     */
+    using Completion_Handler = void ( * )( void * context ) noexcept;
+
+    /**
+     * \brief Constructor.
+     */
+    Non_Blocking_Transmitter_Concept() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    Non_Blocking_Transmitter_Concept( Non_Blocking_Transmitter_Concept && source ) noexcept = default;
+
+    Non_Blocking_Transmitter_Concept( Non_Blocking_Transmitter_Concept const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Non_Blocking_Transmitter_Concept() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Non_Blocking_Transmitter_Concept && expression ) noexcept
+        -> Non_Blocking_Transmitter_Concept & = default;
+
+    auto operator=( Non_Blocking_Transmitter_Concept const & ) = delete;
+
+    /**
+     * \brief Initialize the transmitter's hardware.
+     *
+     * \return Nothing if transmitter hardware initialization succeeded.
+     * \return An error code if transmitter hardware initialization failed. If transmitter
+     *         hardware initialization cannot fail, return
+     *         picolibrary::Result<picolibrary::Void, picolibrary::Void>.
+     */
+    auto initialize() noexcept -> Result<Void, Error_Code>;
+
+    /**
+     * \brief Set the transmission completion handler.
+     *
+     * \param[in] handler The transmission completion handler (nullptr if no handler
+     *            should be called).
+     * \param[in] context The context to pass to the transmission completion handler.
+     */
+    void set_completion_handler( Completion_Handler handler, void * context ) noexcept;
+
+    /**
+     * \brief Start transmitting a block of data.
+     *
+     * \warning Calling this function while a transmission is in progress results in
+     *          undefined behavior.
+     *
+     * \attention The block of data must not be modified or destroyed until the
+     *            transmission is complete.
+     *
+     * \param[in] begin The beginning of the block of data to transmit.
+     * \param[in] end The end of the block of data to transmit.
+     *
+     * \return Nothing if starting the transmission succeeded.
+     * \return An error code if starting the transmission failed. If starting the
+     *         transmission cannot fail, return
+     *         picolibrary::Result<picolibrary::Void, picolibrary::Void>.
+     */
+    auto start_transmit( Data const * begin, Data const * end ) noexcept
+        -> Result<Void, Error_Code>;
+
+    /**
+     * \brief Check if the most recently started transmission is complete.
+     *
+     * \return true if no transmission is in progress.
+     * \return false if a transmission is in progress.
+     */
+    auto transmit_complete() const noexcept -> bool;
+};
+
+/**
+ * \brief Asynchronous serial basic receiver concept.
+ */
+class Basic_Receiver_Concept {
+  public:
+    /**
+     * \brief The integral type used to hold the data to be received.
+     */
+    using Data = std::uint8_t;
+
+    /**
+     * \brief Constructor.
+     */
+    Basic_Receiver_Concept() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    Basic_Receiver_Concept( Basic_Receiver_Concept && source ) noexcept = default;
+
+    Basic_Receiver_Concept( Basic_Receiver_Concept const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Basic_Receiver_Concept() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Basic_Receiver_Concept && expression ) noexcept
+        -> Basic_Receiver_Concept & = default;
+
+    auto operator=( Basic_Receiver_Concept const & ) = delete;
+
+    /**
+     * \brief Initialize the receiver's hardware.
+     *
+     * \return Nothing if receiver hardware initialization succeeded.
+     * \return An error code if receiver hardware initialization failed. If receiver
+     *         hardware initialization cannot fail, return
+     *         picolibrary::Result<picolibrary::Void, picolibrary::Void>.
+     */
+    auto initialize() noexcept -> Result<Void, Error_Code>;
+
+    /**
+     * \brief Receive data.
+     *
+     * \return The received data if data reception succeeded.
+     * \return An error code if data reception failed. If data reception cannot fail,
+     *         return picolibrary::Result<Data, picolibrary::Void>.
+     */
+    auto receive() noexcept -> Result<Data, Error_Code>;
+};
+
+/**
+ * \brief Asynchronous serial receiver concept.
+ */
+class Receiver_Concept {
+  public:
+    /**
+     * \brief The integral type used to hold the data to be received.
+     */
+    using Data = std::uint8_t;
+
+    /**
+     * \brief Constructor.
+     */
+    Receiver_Concept() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    Receiver_Concept( Receiver_Concept && source ) noexcept = default;
+
+    Receiver_Concept( Receiver_Concept const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Receiver_Concept() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Receiver_Concept && expression ) noexcept -> Receiver_Concept & = default;
+
+    auto operator=( Receiver_Concept const & ) = delete;
+
+    /**
+     * \brief Initialize the receiver's hardware.
+     *
+     * \return Nothing if receiver hardware initialization succeeded.
+     * \return An error code if receiver hardware initialization failed. If receiver
+     *         hardware initialization cannot fail, return
+     *         picolibrary::Result<picolibrary::Void, picolibrary::Void>.
+     */
+    auto initialize() noexcept -> Result<Void, Error_Code>;
+
+    /**
+     * \brief Receive data.
+     *
+     * \return The received data if data reception succeeded.
+     * \return An error code if data reception failed. If data reception cannot fail,
+     *         return picolibrary::Result<Data, picolibrary::Void>.
+     */
+    auto receive() noexcept -> Result<Data, Error_Code>;
+
+    /**
+     * \brief Receive a block of data.
+     *
+     * \param[out] begin The beginning of the block of received data.
+     * \param[out] end The end of the block of received data.
+     *
+     * \return Nothing if data reception succeeded.
+     * \return An error code if data reception failed. If data reception cannot fail,
+     *         return picolibrary::Result<picolibrary::Void, picolibrary::Void>.
+     */
+    auto receive( Data * begin, Data * end ) noexcept -> Result<Void, Error_Code>;
+};
+
+/**
+ * \brief Asynchronous serial receiver.
+ *
+ * \tparam Basic_Receiver The asynchronous serial basic receiver to add asynchronous
+ *         serial receiver functionality to.
+ */
+template<typename Basic_Receiver>
+class Receiver : public Basic_Receiver {
+  public:
+    /**
+     * \brief The integral type used to hold the data to be received.
+     */
+    using Data = typename Basic_Receiver::Data;
+
+    using Basic_Receiver::Basic_Receiver;
+
+    using Basic_Receiver::receive;
+
+    /**
+     * \brief Receive a block of data.
+     *
+     * \param[out] begin The beginning of the block of received data.
+     * \param[out] end The end of the block of received data.
+     *
+     * \return Nothing if data reception succeeded.
+     * \return An error code if data reception failed.
+     */
+    auto receive( Data * begin, Data * end ) noexcept
+    {
+        using Error = typename decltype( std::declval<Basic_Receiver &>().receive() )::Error;
+
+        for ( ; begin != end; ++begin ) {
+            auto result = receive();
+            if ( result.is_error() ) {
+                return Result<Void, Error>{ result.error() };
+            } // if
+
+            *begin = result.value();
+        } // for
+
+        return Result<Void, Error>{};
+    }
+};
+
+/**
+ * \brief Ring buffered asynchronous serial receiver.
+ *
+ * Received data is placed in the receiver's buffer by a producer (typically a receive
+ * interrupt handler or a host reader thread) using
+ * picolibrary::Asynchronous_Serial::Buffered_Receiver::fill(), and is removed from the
+ * buffer by a consumer using
+ * picolibrary::Asynchronous_Serial::Buffered_Receiver::receive().
+ * Reads that cannot be satisfied from the buffer wait for data until the receiver's
+ * timeout expires.
+ *
+ * \attention Filling the buffer and receiving from the buffer may each only be performed
+ *            by a single execution context.
+ *
+ * \tparam N The buffer capacity. Must be a power of two.
+ * \tparam Clock The type of clock used to measure timeouts (see
+ *         picolibrary::Clock_Concept).
+ * \tparam Idle The type of nullary functor that is called while waiting for data.
+ */
+template<std::size_t N, typename Clock, typename Idle = Busy_Wait>
+class Buffered_Receiver {
+  public:
+    /**
+     * \brief The integral type used to hold the data to be received.
+     */
+    using Data = std::uint8_t;
+
+    /**
+     * \brief The unsigned integral type used to report buffer sizes.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief The unsigned integer type used to represent points in time (ticks).
+     */
+    using Tick = std::remove_cv_t<std::remove_reference_t<decltype( std::declval<Clock &>()() )>>;
+
+    static_assert( std::is_unsigned_v<Tick> );
+
+    /**
+     * \brief The unsigned integral type used to count buffer overruns.
+     */
+    using Count = std::uint_fast32_t;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] clock The clock used to measure timeouts.
+     * \param[in] timeout The maximum number of ticks to wait for data.
+     * \param[in] idle The nullary functor that is called while waiting for data.
+     */
+    Buffered_Receiver( Clock clock, Tick timeout, Idle idle = Idle{} ) noexcept :
+        m_clock{ std::move( clock ) },
+        m_idle{ std::move( idle ) },
+        m_timeout{ timeout }
+    {
+    }
+
+    Buffered_Receiver( Buffered_Receiver && ) = delete;
+
+    Buffered_Receiver( Buffered_Receiver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Buffered_Receiver() noexcept = default;
+
+    auto operator=( Buffered_Receiver && ) = delete;
+
+    auto operator=( Buffered_Receiver const & ) = delete;
+
+    /**
+     * \brief Get the buffer capacity.
+     *
+     * \return The buffer capacity.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get the maximum number of ticks to wait for data.
+     *
+     * \return The maximum number of ticks to wait for data.
+     */
+    auto timeout() const noexcept -> Tick
+    {
+        return m_timeout;
+    }
+
+    /**
+     * \brief Set the maximum number of ticks to wait for data.
+     *
+     * \param[in] timeout The maximum number of ticks to wait for data.
+     */
+    void set_timeout( Tick timeout ) noexcept
+    {
+        m_timeout = timeout;
+    }
+
+    /**
+     * \brief Initialize the receiver.
+     *
+     * \return Nothing.
+     */
+    auto initialize() noexcept -> Result<Void, Void>
+    {
+        return {};
+    }
+
+    /**
+     * \brief Place received data in the buffer.
+     *
+     * \attention This function may only be called by the producer.
+     *
+     * \param[in] data The received data.
+     *
+     * \return true if the data was placed in the buffer.
+     * \return false if the buffer is full (the data is discarded and the buffer overrun
+     *         count is incremented).
+     */
+    auto fill( Data data ) noexcept -> bool
+    {
+        if ( not m_buffer.push( data ) ) {
+            m_overruns.fetch_add( 1, std::memory_order_relaxed );
+
+            return false;
+        } // if
+
+        return true;
+    }
+
+    /**
+     * \brief Place a block of received data in the buffer.
+     *
+     * \attention This function may only be called by the producer.
+     *
+     * \param[in] begin The beginning of the block of received data.
+     * \param[in] end The end of the block of received data.
+     *
+     * \return The number of data that were placed in the buffer. Data that did not fit
+     *         in the buffer is discarded, and the buffer overrun count is incremented
+     *         once for each discarded datum.
+     */
+    auto fill( Data const * begin, Data const * end ) noexcept -> Size
+    {
+        auto const filled = m_buffer.push( begin, end );
+
+        auto const discarded = static_cast<Size>( end - begin ) - filled;
+        if ( discarded ) {
+            m_overruns.fetch_add( discarded, std::memory_order_relaxed );
+        } // if
+
+        return filled;
+    }
+
+    /**
+     * \brief Get the number of data that have been discarded because the buffer was
+     *        full.
+     *
+     * \return The number of data that have been discarded because the buffer was full.
+     */
+    auto overruns() const noexcept -> Count
+    {
+        return m_overruns.load( std::memory_order_relaxed );
+    }
+
+    /**
+     * \brief Get the number of data that can be received without waiting.
+     *
+     * \attention This function may only be called by the consumer.
+     *
+     * \return The number of data that can be received without waiting.
+     */
+    auto available() const noexcept -> Size
+    {
+        return m_buffer.size();
+    }
+
+    /**
+     * \brief Receive data.
+     *
+     * \attention This function may only be called by the consumer.
+     *
+     * \return The received data if data reception succeeded.
+     * \return picolibrary::Generic_Error::OPERATION_TIMEOUT if no data was received
+     *         before the receiver's timeout expired.
+     */
+    auto receive() noexcept -> Result<Data, Error_Code>
+    {
+        auto data = Data{};
+
+        if ( not receive( &data, &data + 1 ).is_error() ) {
+            return data;
+        } // if
+
+        return Generic_Error::OPERATION_TIMEOUT;
+    }
+
+    /**
+     * \brief Receive a block of data.
+     *
+     * \attention This function may only be called by the consumer.
+     *
+     * \attention The receiver's timeout applies to the block as a whole. If the timeout
+     *            expires, the data that was received before the timeout expired has been
+     *            written to the beginning of the block and removed from the buffer.
+     *
+     * \param[out] begin The beginning of the block of received data.
+     * \param[out] end The end of the block of received data.
+     *
+     * \return Nothing if data reception succeeded.
+     * \return picolibrary::Generic_Error::OPERATION_TIMEOUT if the block was not filled
+     *         before the receiver's timeout expired.
+     */
+    auto receive( Data * begin, Data * end ) noexcept -> Result<Void, Error_Code>
+    {
+        begin += receive_available( begin, end );
+
+        for ( auto const start = m_clock(); begin != end; ) {
+            if ( static_cast<Tick>( m_clock() - start ) >= m_timeout ) {
+                return Generic_Error::OPERATION_TIMEOUT;
+            } // if
+
+            m_idle();
+
+            begin += receive_available( begin, end );
+        } // for
+
+        return {};
+    }
+
+    /**
+     * \brief Receive data that is in the buffer without waiting.
+     *
+     * \attention This function may only be called by the consumer.
+     *
+     * \param[out] begin The beginning of the block to place received data in.
+     * \param[out] end The end of the block to place received data in.
+     *
+     * \return The number of data that were received.
+     */
+    auto receive_available( Data * begin, Data * end ) noexcept -> Size
+    {
+        return m_buffer.pop( begin, end );
+    }
+
+  private:
+    /**
+     * \brief The clock used to measure timeouts.
+     */
+    Clock m_clock;
+
+    /**
+     * \brief The nullary functor that is called while waiting for data.
+     */
+    Idle m_idle;
+
+    /**
+     * \brief The maximum number of ticks to wait for data.
+     */
+    Tick m_timeout;
+
+    /**
+     * \brief The number of data that have been discarded because the buffer was full.
+     */
+    std::atomic<Count> m_overruns{};
+
+    /**
+     * \brief The buffer.
+     */
+    SPSC_Ring<Data, N> m_buffer{};
+};
+
 } // namespace picolibrary::Asynchronous_Serial
 
 #endif // PICOLIBRARY_ASYNCHRONOUS_SERIAL_H
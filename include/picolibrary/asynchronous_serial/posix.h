@@ -0,0 +1,166 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Asynchronous_Serial POSIX interface.
+ *
+ * \attention The facilities in this header require a POSIX host, and are only available
+ *            if PICOLIBRARY_ENABLE_POSIX is enabled.
+ */
+
+#ifndef PICOLIBRARY_ASYNCHRONOUS_SERIAL_POSIX_H
+#define PICOLIBRARY_ASYNCHRONOUS_SERIAL_POSIX_H
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/result.h"
+#include "picolibrary/void.h"
+
+namespace picolibrary::Asynchronous_Serial {
+
+/**
+ * \brief POSIX file descriptor asynchronous serial transmitter.
+ *
+ * Data is written to a file descriptor (e.g. a tty, a pseudo-terminal, or a pipe). A
+ * block of data is written with as few write() calls as the file descriptor allows.
+ * Partial writes and interrupted writes are resumed, and if the file descriptor is in
+ * non-blocking mode, the transmitter waits for the file descriptor to become writable
+ * before resuming.
+ *
+ * \attention The transmitter does not own the file descriptor. The file descriptor must
+ *            remain open for as long as it is used by the transmitter.
+ *
+ * \attention Writing to a pipe or pseudo-terminal whose reading end has been closed
+ *            raises SIGPIPE unless SIGPIPE is ignored or blocked.
+ */
+class Posix_Transmitter {
+  public:
+    /**
+     * \brief The integral type used to hold the data to be transmitted.
+     */
+    using Data = std::uint8_t;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Posix_Transmitter() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] file_descriptor The file descriptor to write to.
+     */
+    constexpr explicit Posix_Transmitter( int file_descriptor ) noexcept :
+        m_file_descriptor{ file_descriptor }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Posix_Transmitter( Posix_Transmitter && source ) noexcept :
+        m_file_descriptor{ source.m_file_descriptor }
+    {
+        source.m_file_descriptor = -1;
+    }
+
+    Posix_Transmitter( Posix_Transmitter const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Posix_Transmitter() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto & operator=( Posix_Transmitter && expression ) noexcept
+    {
+        if ( &expression != this ) {
+            m_file_descriptor = expression.m_file_descriptor;
+
+            expression.m_file_descriptor = -1;
+        } // if
+
+        return *this;
+    }
+
+    auto operator=( Posix_Transmitter const & ) = delete;
+
+    /**
+     * \brief Get the file descriptor that is written to.
+     *
+     * \return The file descriptor that is written to.
+     */
+    constexpr auto file_descriptor() const noexcept
+    {
+        return m_file_descriptor;
+    }
+
+    /**
+     * \brief Initialize the transmitter.
+     *
+     * \return Nothing if the file descriptor is open for writing.
+     * \return An errno error code (see picolibrary::Posix::Errno_Category) if the file
+     *         descriptor is not open for writing.
+     */
+    auto initialize() noexcept -> Result<Void, Error_Code>;
+
+    /**
+     * \brief Transmit data.
+     *
+     * \param[in] data The data to transmit.
+     *
+     * \return Nothing if data transmission succeeded.
+     * \return An errno error code (see picolibrary::Posix::Errno_Category) if data
+     *         transmission failed.
+     */
+    auto transmit( Data data ) noexcept -> Result<Void, Error_Code>
+    {
+        return transmit( &data, &data + 1 );
+    }
+
+    /**
+     * \brief Transmit a block of data.
+     *
+     * \param[in] begin The beginning of the block of data to transmit.
+     * \param[in] end The end of the block of data to transmit.
+     *
+     * \return Nothing if data transmission succeeded.
+     * \return An errno error code (see picolibrary::Posix::Errno_Category) if data
+     *         transmission failed.
+     */
+    auto transmit( Data const * begin, Data const * end ) noexcept -> Result<Void, Error_Code>;
+
+  private:
+    /**
+     * \brief The file descriptor that is written to.
+     */
+    int m_file_descriptor{ -1 };
+};
+
+} // namespace picolibrary::Asynchronous_Serial
+
+#endif // PICOLIBRARY_ASYNCHRONOUS_SERIAL_POSIX_H
@@ -23,9 +23,13 @@
 #ifndef PICOLIBRARY_ASYNCHRONOUS_SERIAL_STREAM_H
 #define PICOLIBRARY_ASYNCHRONOUS_SERIAL_STREAM_H
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <utility>
 
+#include "picolibrary/clock.h"
 #include "picolibrary/error.h"
 #include "picolibrary/result.h"
 #include "picolibrary/stream.h"
@@ -37,7 +41,9 @@ namespace picolibrary::Asynchronous_Serial {
  * \brief Unbuffered asynchronous serial output stream device access buffer.
  *
  * \tparam Transmitter The type of asynchronous serial transmitter that is abstracted by
- *         the device access buffer.
+ *         the device access buffer (see
+ *         picolibrary::Asynchronous_Serial::Transmitter_Concept). Blocks of data are
+ *         passed to the transmitter's block transmit function.
  */
 template<typename Transmitter>
 class Unbuffered_Output_Stream_Buffer : public Stream_Buffer {
@@ -99,6 +105,25 @@ class Unbuffered_Output_Stream_Buffer : public Stream_Buffer {
         return m_transmitter.transmit( character );
     }
 
+    /**
+     * \copydoc picolibrary::Stream_Buffer::put( char const *, char const * )
+     */
+    virtual auto put( char const * begin, char const * end ) noexcept
+        -> Result<Void, Error_Code> override final
+    {
+        return m_transmitter.transmit(
+            reinterpret_cast<std::uint8_t const *>( begin ),
+            reinterpret_cast<std::uint8_t const *>( end ) );
+    }
+
+    /**
+     * \copydoc picolibrary::Stream_Buffer::put( char const * )
+     */
+    virtual auto put( char const * string ) noexcept -> Result<Void, Error_Code> override final
+    {
+        return put( string, string + std::strlen( string ) );
+    }
+
     /**
      * \copydoc picolibrary::Stream_Buffer::put( std::uint8_t )
      */
@@ -107,6 +132,15 @@ class Unbuffered_Output_Stream_Buffer : public Stream_Buffer {
         return m_transmitter.transmit( value );
     }
 
+    /**
+     * \copydoc picolibrary::Stream_Buffer::put( std::uint8_t const *, std::uint8_t const * )
+     */
+    virtual auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+        -> Result<Void, Error_Code> override final
+    {
+        return m_transmitter.transmit( begin, end );
+    }
+
     /**
      * \copydoc picolibrary::Stream_Buffer::put( std::int8_t )
      */
@@ -115,6 +149,17 @@ class Unbuffered_Output_Stream_Buffer : public Stream_Buffer {
         return m_transmitter.transmit( value );
     }
 
+    /**
+     * \copydoc picolibrary::Stream_Buffer::put( std::int8_t const *, std::int8_t const * )
+     */
+    virtual auto put( std::int8_t const * begin, std::int8_t const * end ) noexcept
+        -> Result<Void, Error_Code> override final
+    {
+        return m_transmitter.transmit(
+            reinterpret_cast<std::uint8_t const *>( begin ),
+            reinterpret_cast<std::uint8_t const *>( end ) );
+    }
+
     /**
      * \copydoc picolibrary::Stream_Buffer::flush()
      */
@@ -210,6 +255,349 @@ class Unbuffered_Output_Stream : public Output_Stream {
     Unbuffered_Output_Stream_Buffer<Transmitter> m_buffer{};
 };
 
+/**
+ * \brief Double buffered asynchronous serial output stream device access buffer.
+ *
+ * Data is written to one of two buffers while the other buffer is being transmitted in
+ * the background by a non-blocking transmitter. When the buffer that is being written to
+ * fills, or when the device access buffer is flushed, transmission of the buffer is
+ * started, and writing continues in the other buffer. Writes only wait if the other
+ * buffer is still being transmitted.
+ *
+ * \attention Destroying the device access buffer waits for a transmission that is in
+ *            progress to complete. Data that has not been flushed is discarded.
+ *
+ * \tparam Non_Blocking_Transmitter The type of asynchronous serial non-blocking
+ *         transmitter that is abstracted by the device access buffer (see
+ *         picolibrary::Asynchronous_Serial::Non_Blocking_Transmitter_Concept).
+ * \tparam N The capacity of each of the two buffers.
+ * \tparam Idle The type of nullary functor that is called while waiting for a
+ *         transmission to complete.
+ */
+template<typename Non_Blocking_Transmitter, std::size_t N, typename Idle = Busy_Wait>
+class Double_Buffered_Output_Stream_Buffer : public Stream_Buffer {
+  public:
+    static_assert( N > 0 );
+
+    /**
+     * \brief The unsigned integral type used to report buffer sizes.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] transmitter The transmitter to abstract with the device access buffer.
+     * \param[in] idle The nullary functor that is called while waiting for a
+     *            transmission to complete.
+     */
+    Double_Buffered_Output_Stream_Buffer( Non_Blocking_Transmitter transmitter, Idle idle = Idle{} ) noexcept :
+        m_transmitter{ std::move( transmitter ) },
+        m_idle{ std::move( idle ) }
+    {
+    }
+
+    Double_Buffered_Output_Stream_Buffer( Double_Buffered_Output_Stream_Buffer && ) = delete;
+
+    Double_Buffered_Output_Stream_Buffer( Double_Buffered_Output_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Double_Buffered_Output_Stream_Buffer() noexcept
+    {
+        if ( m_transmission_started ) {
+            wait();
+        } // if
+    }
+
+    auto operator=( Double_Buffered_Output_Stream_Buffer && ) = delete;
+
+    auto operator=( Double_Buffered_Output_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Get the capacity of each of the two buffers.
+     *
+     * \return The capacity of each of the two buffers.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get the amount of data that is waiting to be transmitted.
+     *
+     * \return The amount of data that is waiting to be transmitted.
+     */
+    constexpr auto size() const noexcept -> Size
+    {
+        return m_size;
+    }
+
+    /**
+     * \brief Check if the most recently started transmission is complete.
+     *
+     * \return true if no transmission is in progress.
+     * \return false if a transmission is in progress.
+     */
+    auto transmit_complete() const noexcept -> bool
+    {
+        return m_transmitter.transmit_complete();
+    }
+
+    /**
+     * \copydoc picolibrary::Stream_Buffer::initialize()
+     */
+    virtual auto initialize() noexcept -> Result<Void, Error_Code> override final
+    {
+        return m_transmitter.initialize();
+    }
+
+    /**
+     * \copydoc picolibrary::Stream_Buffer::put( char )
+     */
+    virtual auto put( char character ) noexcept -> Result<Void, Error_Code> override final
+    {
+        return write( &character, &character + 1 );
+    }
+
+    /**
+     * \copydoc picolibrary::Stream_Buffer::put( char const *, char const * )
+     */
+    virtual auto put( char const * begin, char const * end ) noexcept
+        -> Result<Void, Error_Code> override final
+    {
+        return write( begin, end );
+    }
+
+    /**
+     * \copydoc picolibrary::Stream_Buffer::put( char const * )
+     */
+    virtual auto put( char const * string ) noexcept -> Result<Void, Error_Code> override final
+    {
+        return write( string, string + std::strlen( string ) );
+    }
+
+    /**
+     * \copydoc picolibrary::Stream_Buffer::put( std::uint8_t )
+     */
+    virtual auto put( std::uint8_t value ) noexcept -> Result<Void, Error_Code> override final
+    {
+        return write( &value, &value + 1 );
+    }
+
+    /**
+     * \copydoc picolibrary::Stream_Buffer::put( std::uint8_t const *, std::uint8_t const * )
+     */
+    virtual auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+        -> Result<Void, Error_Code> override final
+    {
+        return write( begin, end );
+    }
+
+    /**
+     * \copydoc picolibrary::Stream_Buffer::put( std::int8_t )
+     */
+    virtual auto put( std::int8_t value ) noexcept -> Result<Void, Error_Code> override final
+    {
+        return write( &value, &value + 1 );
+    }
+
+    /**
+     * \copydoc picolibrary::Stream_Buffer::put( std::int8_t const *, std::int8_t const * )
+     */
+    virtual auto put( std::int8_t const * begin, std::int8_t const * end ) noexcept
+        -> Result<Void, Error_Code> override final
+    {
+        return write( begin, end );
+    }
+
+    /**
+     * \brief Start transmitting any data that is waiting to be transmitted.
+     *
+     * \attention This function does not wait for the transmission to complete. It only
+     *            waits if the previously started transmission is still in progress.
+     *
+     * \return Nothing if the flush succeeded.
+     * \return An error code if the flush failed.
+     */
+    virtual auto flush() noexcept -> Result<Void, Error_Code> override final
+    {
+        if ( not m_size ) {
+            return {};
+        } // if
+
+        return swap();
+    }
+
+  private:
+    /**
+     * \brief The asynchronous serial non-blocking transmitter abstracted by the device
+     *        access buffer.
+     */
+    Non_Blocking_Transmitter m_transmitter;
+
+    /**
+     * \brief The nullary functor that is called while waiting for a transmission to
+     *        complete.
+     */
+    Idle m_idle;
+
+    /**
+     * \brief The buffers.
+     */
+    std::uint8_t m_buffers[ 2 ][ N ]{};
+
+    /**
+     * \brief The index of the buffer that is being written to.
+     */
+    std::uint_fast8_t m_active{};
+
+    /**
+     * \brief The amount of data in the buffer that is being written to.
+     */
+    Size m_size{};
+
+    /**
+     * \brief A transmission has been started.
+     */
+    bool m_transmission_started{};
+
+    /**
+     * \brief Wait for the previously started transmission to complete.
+     */
+    void wait() noexcept
+    {
+        while ( not m_transmitter.transmit_complete() ) {
+            m_idle();
+        } // while
+    }
+
+    /**
+     * \brief Write a block of data to the buffer that is being written to, starting
+     *        transmission of the buffer whenever it fills.
+     *
+     * \tparam T The type of data to write.
+     *
+     * \param[in] begin The beginning of the block of data to write.
+     * \param[in] end The end of the block of data to write.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    template<typename T>
+    auto write( T const * begin, T const * end ) noexcept -> Result<Void, Error_Code>
+    {
+        static_assert( sizeof( T ) == sizeof( std::uint8_t ) );
+
+        while ( begin != end ) {
+            if ( m_size == N ) {
+                auto result = swap();
+                if ( result.is_error() ) {
+                    return result;
+                } // if
+            }     // if
+
+            auto const size = std::min( static_cast<Size>( end - begin ), N - m_size );
+
+            std::memcpy( &m_buffers[ m_active ][ m_size ], begin, size );
+
+            begin += size;
+            m_size += size;
+        } // while
+
+        return {};
+    }
+
+    /**
+     * \brief Wait for the previously started transmission to complete, start
+     *        transmitting the buffer that is being written to, and begin writing to the
+     *        other buffer.
+     *
+     * \return Nothing if starting the transmission succeeded.
+     * \return An error code if starting the transmission failed.
+     */
+    auto swap() noexcept -> Result<Void, Error_Code>
+    {
+        wait();
+
+        auto const * const buffer = m_buffers[ m_active ];
+
+        auto result = m_transmitter.start_transmit( buffer, buffer + m_size );
+        if ( result.is_error() ) {
+            return result;
+        } // if
+
+        m_transmission_started = true;
+
+        m_active ^= 1;
+        m_size = 0;
+
+        return {};
+    }
+};
+
+/**
+ * \brief Double buffered asynchronous serial output stream.
+ *
+ * \attention Destroying the stream waits for a transmission that is in progress to
+ *            complete. Data that has not been flushed is discarded.
+ *
+ * \tparam Non_Blocking_Transmitter The type of asynchronous serial non-blocking
+ *         transmitter that is abstracted by the stream (see
+ *         picolibrary::Asynchronous_Serial::Non_Blocking_Transmitter_Concept).
+ * \tparam N The capacity of each of the stream's two buffers.
+ * \tparam Idle The type of nullary functor that is called while waiting for a
+ *         transmission to complete.
+ */
+template<typename Non_Blocking_Transmitter, std::size_t N, typename Idle = Busy_Wait>
+class Double_Buffered_Output_Stream : public Output_Stream {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] transmitter The transmitter to abstract with the stream.
+     * \param[in] idle The nullary functor that is called while waiting for a
+     *            transmission to complete.
+     */
+    Double_Buffered_Output_Stream( Non_Blocking_Transmitter transmitter, Idle idle = Idle{} ) noexcept :
+        m_buffer{ std::move( transmitter ), std::move( idle ) }
+    {
+        set_buffer( &m_buffer );
+    }
+
+    Double_Buffered_Output_Stream( Double_Buffered_Output_Stream && ) = delete;
+
+    Double_Buffered_Output_Stream( Double_Buffered_Output_Stream const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Double_Buffered_Output_Stream() noexcept = default;
+
+    auto operator=( Double_Buffered_Output_Stream && ) = delete;
+
+    auto operator=( Double_Buffered_Output_Stream const & ) = delete;
+
+    /**
+     * \brief Check if the most recently started transmission is complete.
+     *
+     * \return true if no transmission is in progress.
+     * \return false if a transmission is in progress.
+     */
+    auto transmit_complete() const noexcept -> bool
+    {
+        return m_buffer.transmit_complete();
+    }
+
+  private:
+    /**
+     * \brief The stream's device access buffer.
+     */
+    Double_Buffered_Output_Stream_Buffer<Non_Blocking_Transmitter, N, Idle> m_buffer;
+};
+
 } // namespace picolibrary::Asynchronous_Serial
 
 #endif // PICOLIBRARY_ASYNCHRONOUS_SERIAL_STREAM_H
@@ -23,33 +23,322 @@
 #ifndef PICOLIBRARY_BIT_MANIPULATION_H
 #define PICOLIBRARY_BIT_MANIPULATION_H
 
+#include <cstdint>
 #include <limits>
+#include <type_traits>
 
 namespace picolibrary {
 
+/**
+ * \brief Count the number of bits that are set in an integer.
+ *
+ * \tparam Integer The type of integer to examine (must be unsigned).
+ *
+ * \param[in] value The value to examine.
+ *
+ * \return The number of bits that are set in the value.
+ */
+template<typename Integer>
+constexpr auto popcount( Integer value ) noexcept -> std::uint_fast8_t
+{
+    static_assert( std::is_unsigned_v<Integer> );
+
+#if defined( __GNUC__ )
+    if constexpr ( std::numeric_limits<Integer>::digits <= std::numeric_limits<unsigned int>::digits ) {
+        return static_cast<std::uint_fast8_t>( __builtin_popcount( value ) );
+    } else {
+        return static_cast<std::uint_fast8_t>( __builtin_popcountll( value ) );
+    } // else
+#else
+    auto count = std::uint_fast8_t{};
+
+    for ( ; value; value &= static_cast<Integer>( value - 1 ) ) {
+        ++count;
+    } // for
+
+    return count;
+#endif // defined( __GNUC__ )
+}
+
+/**
+ * \brief Count the number of consecutive clear bits in an integer, starting with the
+ *        most significant bit.
+ *
+ * \tparam Integer The type of integer to examine (must be unsigned).
+ *
+ * \param[in] value The value to examine.
+ *
+ * \return The number of consecutive clear bits in the value, starting with the most
+ *         significant bit.
+ */
+template<typename Integer>
+constexpr auto countl_zero( Integer value ) noexcept -> std::uint_fast8_t
+{
+    static_assert( std::is_unsigned_v<Integer> );
+
+    constexpr auto digits = std::numeric_limits<Integer>::digits;
+
+    if ( not value ) {
+        return digits;
+    } // if
+
+#if defined( __GNUC__ )
+    if constexpr ( digits <= std::numeric_limits<unsigned int>::digits ) {
+        return static_cast<std::uint_fast8_t>(
+            __builtin_clz( value ) - ( std::numeric_limits<unsigned int>::digits - digits ) );
+    } else {
+        return static_cast<std::uint_fast8_t>( __builtin_clzll( value )
+                                               - ( std::numeric_limits<unsigned long long>::digits - digits ) );
+    } // else
+#else
+    auto count = std::uint_fast8_t{};
+
+    for ( ; not( value & ( Integer{ 1 } << ( digits - 1 ) ) ); value = static_cast<Integer>( value << 1 ) ) {
+        ++count;
+    } // for
+
+    return count;
+#endif // defined( __GNUC__ )
+}
+
+/**
+ * \brief Count the number of consecutive clear bits in an integer, starting with the
+ *        least significant bit.
+ *
+ * \tparam Integer The type of integer to examine (must be unsigned).
+ *
+ * \param[in] value The value to examine.
+ *
+ * \return The number of consecutive clear bits in the value, starting with the least
+ *         significant bit.
+ */
+template<typename Integer>
+constexpr auto countr_zero( Integer value ) noexcept -> std::uint_fast8_t
+{
+    static_assert( std::is_unsigned_v<Integer> );
+
+    if ( not value ) {
+        return std::numeric_limits<Integer>::digits;
+    } // if
+
+#if defined( __GNUC__ )
+    if constexpr ( std::numeric_limits<Integer>::digits <= std::numeric_limits<unsigned int>::digits ) {
+        return static_cast<std::uint_fast8_t>( __builtin_ctz( value ) );
+    } else {
+        return static_cast<std::uint_fast8_t>( __builtin_ctzll( value ) );
+    } // else
+#else
+    auto count = std::uint_fast8_t{};
+
+    for ( ; not( value & 1 ); value >>= 1 ) {
+        ++count;
+    } // for
+
+    return count;
+#endif // defined( __GNUC__ )
+}
+
+/**
+ * \brief Rotate the bits in an integer to the left.
+ *
+ * \tparam Integer The type of integer to rotate (must be unsigned).
+ *
+ * \param[in] value The value to rotate.
+ * \param[in] shift The number of bit positions to rotate the value by (taken modulo the
+ *            number of bits in Integer).
+ *
+ * \return The rotated value.
+ */
+template<typename Integer>
+constexpr auto rotl( Integer value, std::uint_fast8_t shift ) noexcept -> Integer
+{
+    static_assert( std::is_unsigned_v<Integer> );
+
+    constexpr auto digits = std::numeric_limits<Integer>::digits;
+
+    shift = static_cast<std::uint_fast8_t>( shift % digits );
+
+    if ( not shift ) {
+        return value;
+    } // if
+
+    return static_cast<Integer>( value << shift ) | static_cast<Integer>( value >> ( digits - shift ) );
+}
+
+/**
+ * \brief Rotate the bits in an integer to the right.
+ *
+ * \tparam Integer The type of integer to rotate (must be unsigned).
+ *
+ * \param[in] value The value to rotate.
+ * \param[in] shift The number of bit positions to rotate the value by (taken modulo the
+ *            number of bits in Integer).
+ *
+ * \return The rotated value.
+ */
+template<typename Integer>
+constexpr auto rotr( Integer value, std::uint_fast8_t shift ) noexcept -> Integer
+{
+    static_assert( std::is_unsigned_v<Integer> );
+
+    constexpr auto digits = std::numeric_limits<Integer>::digits;
+
+    shift = static_cast<std::uint_fast8_t>( shift % digits );
+
+    if ( not shift ) {
+        return value;
+    } // if
+
+    return static_cast<Integer>( value >> shift ) | static_cast<Integer>( value << ( digits - shift ) );
+}
+
+/**
+ * \brief Reverse the order of the bytes in an integer.
+ *
+ * \tparam Integer The type of integer to byte swap (must be unsigned).
+ *
+ * \param[in] value The value to byte swap.
+ *
+ * \return The byte swapped value.
+ */
+template<typename Integer>
+constexpr auto byte_swap( Integer value ) noexcept -> Integer
+{
+    static_assert( std::is_unsigned_v<Integer> );
+
+    constexpr auto digits = std::numeric_limits<Integer>::digits;
+
+#if defined( __GNUC__ )
+    if constexpr ( digits == 16 ) {
+        return __builtin_bswap16( value );
+    } else if constexpr ( digits == 32 ) {
+        return __builtin_bswap32( value );
+    } else if constexpr ( digits == 64 ) {
+        return __builtin_bswap64( value );
+    } else
+#endif // defined( __GNUC__ )
+    {
+        auto result = Integer{};
+
+        for ( auto byte = 0; byte < digits / 8; ++byte ) {
+            result = static_cast<Integer>( result << 8 ) | static_cast<Integer>( value & 0xFF );
+            value >>= 8;
+        } // for
+
+        return result;
+    } // else
+}
+
 /**
  * \brief Reflect the bits in an integer.
  *
- * \tparam Integer The integer type to reflect.
+ * \tparam Integer The integer type to reflect (must be unsigned).
  *
  * \param[in] value The value to reflect.
  *
  * \return The reflected value.
  */
 template<typename Integer>
-auto reflect( Integer value ) noexcept -> Integer
+constexpr auto reflect( Integer value ) noexcept -> Integer
 {
-    auto result           = value;
-    auto remaining_shifts = std::numeric_limits<Integer>::digits - 1;
+    static_assert( std::is_unsigned_v<Integer> );
 
-    for ( value >>= 1; value; value >>= 1 ) {
-        result <<= 1;
-        result |= value & 1;
+#if defined( __clang__ )
+    constexpr auto digits = std::numeric_limits<Integer>::digits;
 
-        --remaining_shifts;
-    } // for
+    if constexpr ( digits == 8 ) {
+        return __builtin_bitreverse8( value );
+    } else if constexpr ( digits == 16 ) {
+        return __builtin_bitreverse16( value );
+    } else if constexpr ( digits == 32 ) {
+        return __builtin_bitreverse32( value );
+    } else if constexpr ( digits == 64 ) {
+        return __builtin_bitreverse64( value );
+    } else
+#endif // defined( __clang__ )
+    {
+        constexpr auto ones = static_cast<Integer>( ~Integer{} );
+
+        // reflect the bits in each byte by swapping adjacent bits, then adjacent bit
+        // pairs, then adjacent nibbles, and reverse the order of the bytes
+        value = static_cast<Integer>( ( value >> 1 ) & ( ones / 3 ) )
+                | static_cast<Integer>( ( value & ( ones / 3 ) ) << 1 );
+        value = static_cast<Integer>( ( value >> 2 ) & ( ones / 5 ) )
+                | static_cast<Integer>( ( value & ( ones / 5 ) ) << 2 );
+        value = static_cast<Integer>( ( value >> 4 ) & ( ones / 17 ) )
+                | static_cast<Integer>( ( value & ( ones / 17 ) ) << 4 );
+
+        return byte_swap( value );
+    } // else
+}
+
+/**
+ * \brief Generate a bit field mask.
+ *
+ * \tparam Integer The type of integer the bit field is a part of (must be unsigned).
+ *
+ * \param[in] size The number of bits in the bit field.
+ * \param[in] bit The position of the bit field's least significant bit.
+ *
+ * \warning If the bit field does not fit in Integer, the behavior is undefined.
+ *
+ * \return The bit field mask.
+ */
+template<typename Integer>
+constexpr auto bit_field_mask( std::uint_fast8_t size, std::uint_fast8_t bit ) noexcept -> Integer
+{
+    static_assert( std::is_unsigned_v<Integer> );
+
+    if ( not size ) {
+        return 0;
+    } // if
+
+    return static_cast<Integer>(
+        static_cast<Integer>( static_cast<Integer>( ~Integer{} ) >> ( std::numeric_limits<Integer>::digits - size ) )
+        << bit );
+}
+
+/**
+ * \brief Extract a bit field from an integer.
+ *
+ * \tparam Integer The type of integer to extract the bit field from (must be unsigned).
+ *
+ * \param[in] value The value to extract the bit field from.
+ * \param[in] mask The bit field mask.
+ *
+ * \warning If mask is zero, the behavior is undefined.
+ *
+ * \return The bit field, shifted such that its least significant bit is bit 0.
+ */
+template<typename Integer>
+constexpr auto extract_bit_field( Integer value, Integer mask ) noexcept -> Integer
+{
+    static_assert( std::is_unsigned_v<Integer> );
+
+    return static_cast<Integer>( ( value & mask ) >> countr_zero( mask ) );
+}
+
+/**
+ * \brief Insert a bit field into an integer.
+ *
+ * \tparam Integer The type of integer to insert the bit field into (must be unsigned).
+ *
+ * \param[in] value The value to insert the bit field into.
+ * \param[in] mask The bit field mask.
+ * \param[in] field The bit field value, with its least significant bit at bit 0. Bits
+ *            that do not fit in the bit field are discarded.
+ *
+ * \warning If mask is zero, the behavior is undefined.
+ *
+ * \return The value with the bit field inserted.
+ */
+template<typename Integer>
+constexpr auto insert_bit_field( Integer value, Integer mask, Integer field ) noexcept -> Integer
+{
+    static_assert( std::is_unsigned_v<Integer> );
 
-    return result << remaining_shifts;
+    return static_cast<Integer>( value & static_cast<Integer>( ~mask ) )
+           | static_cast<Integer>( ( field << countr_zero( mask ) ) & mask );
 }
 
 } // namespace picolibrary
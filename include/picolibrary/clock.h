@@ -0,0 +1,318 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary clock interface.
+ */
+
+#ifndef PICOLIBRARY_CLOCK_H
+#define PICOLIBRARY_CLOCK_H
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace picolibrary {
+
+/**
+ * \brief Clock concept.
+ *
+ * A clock is a nullary functor that returns the current time as an unsigned integer
+ * number of ticks. The tick counter is allowed to wrap.
+ */
+class Clock_Concept {
+  public:
+    /**
+     * \brief The unsigned integer type used to represent points in time (ticks).
+     */
+    using Tick = std::uint32_t;
+
+    /**
+     * \brief Constructor.
+     */
+    Clock_Concept() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    Clock_Concept( Clock_Concept && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    Clock_Concept( Clock_Concept const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Clock_Concept() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Clock_Concept && expression ) noexcept -> Clock_Concept & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Clock_Concept const & expression ) noexcept -> Clock_Concept & = default;
+
+    /**
+     * \brief Get the current time.
+     *
+     * \return The current time.
+     */
+    auto operator()() noexcept -> Tick;
+};
+
+/**
+ * \brief Periodic timer idle functor that does nothing (busy-waits).
+ */
+struct Busy_Wait {
+    /**
+     * \brief Do nothing.
+     */
+    constexpr void operator()() const noexcept
+    {
+    }
+};
+
+/**
+ * \brief Periodic timer.
+ *
+ * Deadlines are absolute: each deadline is exactly one period after the previous one,
+ * regardless of when the timer's expiration was detected, so the execution time of the
+ * periodic work does not cause drift. If a deadline is detected more than one period
+ * late, the deadlines that were skipped over are counted as missed, and the next
+ * deadline is the first one that has not yet been reached.
+ *
+ * The timer is a nullary functor that waits for the next deadline, so it can be used
+ * wherever a delayer (e.g. the interactive test helpers' Delayer) is expected.
+ *
+ * A timer with a period of zero (e.g. a default constructed timer) is always expired:
+ * waiting for its next deadline returns immediately, and no deadlines are missed.
+ *
+ * \tparam Clock The type of clock used to get the current time (see
+ *         picolibrary::Clock_Concept).
+ * \tparam Idle A nullary functor called repeatedly while waiting for a deadline (e.g. to
+ *         put the system to sleep until an interrupt occurs).
+ */
+template<typename Clock, typename Idle = Busy_Wait>
+class Periodic_Timer {
+  public:
+    /**
+     * \brief The unsigned integer type used to represent points in time (ticks).
+     */
+    using Tick = std::remove_cv_t<std::remove_reference_t<decltype( std::declval<Clock &>()() )>>;
+
+    static_assert( std::is_unsigned_v<Tick> );
+
+    /**
+     * \brief The unsigned integer type used to count missed deadlines.
+     */
+    using Count = std::uint_fast32_t;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Periodic_Timer() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] clock The clock to use to get the current time.
+     * \param[in] period The timer's period (must be less than half the range of the tick
+     *            type, zero makes the timer always expired).
+     * \param[in] idle The functor to call repeatedly while waiting for a deadline.
+     */
+    Periodic_Timer( Clock clock, Tick period, Idle idle = Idle{} ) noexcept :
+        m_clock{ std::move( clock ) },
+        m_idle{ std::move( idle ) },
+        m_period{ period },
+        m_deadline{ static_cast<Tick>( m_clock() + period ) }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Periodic_Timer( Periodic_Timer && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Periodic_Timer( Periodic_Timer const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Periodic_Timer() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Periodic_Timer && expression ) noexcept -> Periodic_Timer & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Periodic_Timer const & expression ) noexcept
+        -> Periodic_Timer & = default;
+
+    /**
+     * \brief Get the timer's period.
+     *
+     * \return The timer's period.
+     */
+    constexpr auto period() const noexcept -> Tick
+    {
+        return m_period;
+    }
+
+    /**
+     * \brief Get the timer's next deadline.
+     *
+     * \return The timer's next deadline.
+     */
+    constexpr auto deadline() const noexcept -> Tick
+    {
+        return m_deadline;
+    }
+
+    /**
+     * \brief Get the number of deadlines that have been missed.
+     *
+     * \return The number of deadlines that have been missed.
+     */
+    constexpr auto missed() const noexcept -> Count
+    {
+        return m_missed;
+    }
+
+    /**
+     * \brief Restart the timer (the next deadline is one period from now, and the missed
+     *        deadline count is cleared).
+     */
+    void restart() noexcept
+    {
+        m_deadline = static_cast<Tick>( m_clock() + m_period );
+        m_missed   = 0;
+    }
+
+    /**
+     * \brief Check if the timer's next deadline has been reached without waiting. If the
+     *        deadline has been reached, the timer advances to its next deadline.
+     *
+     * \return true if the timer's next deadline has been reached.
+     * \return false if the timer's next deadline has not been reached.
+     */
+    auto expired() noexcept -> bool
+    {
+        if ( not m_period ) {
+            return true;
+        } // if
+
+        auto const lateness = static_cast<Tick>( m_clock() - m_deadline );
+
+        if ( lateness > std::numeric_limits<Tick>::max() / 2 ) {
+            return false;
+        } // if
+
+        auto const missed = static_cast<Tick>( lateness / m_period );
+
+        m_missed += missed;
+        m_deadline += static_cast<Tick>( ( missed + 1 ) * m_period );
+
+        return true;
+    }
+
+    /**
+     * \brief Wait for the timer's next deadline to be reached. The timer then advances to
+     *        its next deadline.
+     */
+    void wait() noexcept
+    {
+        while ( not expired() ) {
+            m_idle();
+        } // while
+    }
+
+    /**
+     * \brief Wait for the timer's next deadline to be reached (see
+     *        picolibrary::Periodic_Timer::wait()).
+     */
+    void operator()() noexcept
+    {
+        wait();
+    }
+
+  private:
+    /**
+     * \brief The clock used to get the current time.
+     */
+    Clock m_clock{};
+
+    /**
+     * \brief The functor called repeatedly while waiting for a deadline.
+     */
+    Idle m_idle{};
+
+    /**
+     * \brief The timer's period.
+     */
+    Tick m_period{};
+
+    /**
+     * \brief The timer's next deadline.
+     */
+    Tick m_deadline{};
+
+    /**
+     * \brief The number of deadlines that have been missed.
+     */
+    Count m_missed{};
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_CLOCK_H
@@ -28,6 +28,7 @@
 
 #include "picolibrary/bit_manipulation.h"
 #include "picolibrary/fixed_size_array.h"
+#include "picolibrary/span.h"
 
 /**
  * \brief Cyclic Redundancy Check (CRC) facilities.
@@ -325,6 +326,15 @@ class Calculator_Concept {
      */
     template<typename Iterator>
     auto calculate( Iterator begin, Iterator end ) const noexcept -> Register;
+
+    /**
+     * \brief Calculate the CRC remainder for a message.
+     *
+     * \param[in] message The message to perform the calculation on.
+     *
+     * \return The CRC remainder for the message.
+     */
+    auto calculate( Byte_View message ) const noexcept -> Register;
 };
 
 /**
@@ -416,6 +426,14 @@ class Bitwise_Calculator {
                ^ m_xor_output;
     }
 
+    /**
+     * \copydoc picolibrary::CRC::Calculator_Concept::calculate( Byte_View ) const
+     */
+    auto calculate( Byte_View message ) const noexcept -> Register
+    {
+        return calculate( message.begin(), message.end() );
+    }
+
   private:
     /**
      * \brief Calculation polynomial.
@@ -573,6 +591,14 @@ class Augmented_Nibble_Indexed_Lookup_Table_Calculator {
                ^ m_xor_output;
     }
 
+    /**
+     * \copydoc picolibrary::CRC::Calculator_Concept::calculate( Byte_View ) const
+     */
+    auto calculate( Byte_View message ) const noexcept -> Register
+    {
+        return calculate( message.begin(), message.end() );
+    }
+
   private:
     /**
      * \brief Calculation lookup table.
@@ -736,6 +762,14 @@ class Direct_Nibble_Indexed_Lookup_Table_Calculator {
         return ( *m_process_output )( remainder ) ^ m_xor_output;
     }
 
+    /**
+     * \copydoc picolibrary::CRC::Calculator_Concept::calculate( Byte_View ) const
+     */
+    auto calculate( Byte_View message ) const noexcept -> Register
+    {
+        return calculate( message.begin(), message.end() );
+    }
+
   private:
     /**
      * \brief Calculation lookup table.
@@ -887,6 +921,14 @@ class Augmented_Byte_Indexed_Lookup_Table_Calculator {
                ^ m_xor_output;
     }
 
+    /**
+     * \copydoc picolibrary::CRC::Calculator_Concept::calculate( Byte_View ) const
+     */
+    auto calculate( Byte_View message ) const noexcept -> Register
+    {
+        return calculate( message.begin(), message.end() );
+    }
+
   private:
     /**
      * \brief Calculation lookup table.
@@ -1050,6 +1092,14 @@ class Direct_Byte_Indexed_Lookup_Table_Calculator {
         return ( *m_process_output )( remainder ) ^ m_xor_output;
     }
 
+    /**
+     * \copydoc picolibrary::CRC::Calculator_Concept::calculate( Byte_View ) const
+     */
+    auto calculate( Byte_View message ) const noexcept -> Register
+    {
+        return calculate( message.begin(), message.end() );
+    }
+
   private:
     /**
      * \brief Calculation lookup table.
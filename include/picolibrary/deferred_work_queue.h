@@ -0,0 +1,166 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Deferred_Work_Queue interface.
+ */
+
+#ifndef PICOLIBRARY_DEFERRED_WORK_QUEUE_H
+#define PICOLIBRARY_DEFERRED_WORK_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "picolibrary/mpmc_queue.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Fixed capacity deferred work (deferred procedure call) queue.
+ *
+ * Interrupt service routines and other callback contexts post small closures to the
+ * queue, and the main loop or a worker thread executes them in batches, keeping the
+ * time spent in the posting context to a minimum. Closures are stored in place (type
+ * erased), so posting never allocates.
+ *
+ * Posting and executing are lock-free (see picolibrary::MPMC_Queue), so any number of
+ * contexts (e.g. nested interrupts) can post, and any number of contexts can execute.
+ * Posting from interrupt context requires std::atomic<std::size_t> to be lock-free on
+ * the target, which is checked at compile time.
+ *
+ * \tparam N The queue capacity. Must be a power of two.
+ * \tparam CLOSURE_SIZE The maximum size of a closure.
+ */
+template<std::size_t N, std::size_t CLOSURE_SIZE = 2 * sizeof( void * )>
+class Deferred_Work_Queue {
+  public:
+    static_assert(
+        std::atomic<std::size_t>::is_always_lock_free,
+        "posting from interrupt context requires lock-free std::atomic<std::size_t>" );
+
+    /**
+     * \brief The number of closures in the queue.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief Constructor.
+     */
+    Deferred_Work_Queue() noexcept = default;
+
+    Deferred_Work_Queue( Deferred_Work_Queue && ) = delete;
+
+    Deferred_Work_Queue( Deferred_Work_Queue const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * \attention Closures that have not been executed are discarded.
+     */
+    ~Deferred_Work_Queue() noexcept = default;
+
+    auto operator=( Deferred_Work_Queue && ) = delete;
+
+    auto operator=( Deferred_Work_Queue const & ) = delete;
+
+    /**
+     * \brief Get the queue's capacity.
+     *
+     * \return The queue's capacity.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Post a closure to the queue.
+     *
+     * \tparam Closure A nullary functor that returns void. Closures must be trivially
+     *         copyable (e.g. a lambda that captures pointers, references, and integers),
+     *         no larger than CLOSURE_SIZE, and must not be over-aligned.
+     *
+     * \param[in] closure The closure to post.
+     *
+     * \return true if the closure was posted.
+     * \return false if the queue is full.
+     */
+    template<typename Closure>
+    auto post( Closure closure ) noexcept
+    {
+        static_assert( std::is_trivially_copyable_v<Closure> );
+        static_assert( sizeof( Closure ) <= CLOSURE_SIZE );
+        static_assert( alignof( Closure ) <= alignof( std::max_align_t ) );
+
+        auto work = Work{};
+
+        ::new ( work.storage ) Closure{ std::move( closure ) };
+        work.execute = []( void * storage ) noexcept {
+            ( *std::launder( static_cast<Closure *>( storage ) ) )();
+        };
+
+        return m_queue.push( work );
+    }
+
+    /**
+     * \brief Execute posted closures, in posting order.
+     *
+     * \param[in] limit The maximum number of closures to execute (bounds the time spent
+     *            executing closures).
+     *
+     * \return The number of closures that were executed.
+     */
+    auto execute( Size limit = N ) noexcept -> Size
+    {
+        auto executed = Size{};
+
+        for ( auto work = Work{}; executed < limit and m_queue.pop( work ); ++executed ) {
+            work.execute( work.storage );
+        } // for
+
+        return executed;
+    }
+
+  private:
+    /**
+     * \brief Type erased closure.
+     */
+    struct Work {
+        /**
+         * \brief The closure's storage.
+         */
+        alignas( std::max_align_t ) unsigned char storage[ CLOSURE_SIZE ]{};
+
+        /**
+         * \brief The closure's execution function.
+         */
+        void ( *execute )( void * storage ) noexcept {};
+    };
+
+    /**
+     * \brief The posted closures.
+     */
+    MPMC_Queue<Work, N> m_queue{};
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_DEFERRED_WORK_QUEUE_H
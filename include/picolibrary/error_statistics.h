@@ -0,0 +1,343 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Error_Statistics interface.
+ */
+
+#ifndef PICOLIBRARY_ERROR_STATISTICS_H
+#define PICOLIBRARY_ERROR_STATISTICS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/format.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+#include "picolibrary/void.h"
+
+#ifndef PICOLIBRARY_ERROR_STATISTICS_CAPACITY
+#define PICOLIBRARY_ERROR_STATISTICS_CAPACITY 32
+#endif // PICOLIBRARY_ERROR_STATISTICS_CAPACITY
+
+namespace picolibrary {
+
+/**
+ * \brief Error statistics.
+ *
+ * Counts the number of errors that have been recorded for each error category / error
+ * ID pair using a fixed-size table. Recording is lock-free, and may be performed from
+ * interrupt context if std::atomic is lock-free on the target.
+ *
+ * If PICOLIBRARY_ENABLE_ERROR_STATISTICS is defined, each failure is recorded once with
+ * the picolibrary::Error_Statistics::instance() table: when a picolibrary::Result is
+ * constructed from something other than an error code (e.g. an error code enum), or when
+ * an existing error code is reported using picolibrary::make_error(). Propagating an
+ * error code from one picolibrary::Result to another is not recorded. Drivers that
+ * substitute a device specific error for a generic error (e.g.
+ * picolibrary::I2C::Device's nonresponsive device error) report the substituted error
+ * using picolibrary::make_error().
+ *
+ * \attention If two threads of execution record a previously unrecorded error category /
+ *            error ID pair at the same time, the pair may occupy two table entries.
+ */
+class Error_Statistics {
+  public:
+    /**
+     * \brief The maximum number of error category / error ID pairs that can be tracked.
+     */
+    static constexpr auto CAPACITY = std::size_t{ PICOLIBRARY_ERROR_STATISTICS_CAPACITY };
+
+    /**
+     * \brief Error count.
+     */
+    using Count = std::uint_fast32_t;
+
+    /**
+     * \brief Get a reference to the error statistics instance that picolibrary::Result
+     *        records errors with.
+     *
+     * \return A reference to the error statistics instance.
+     */
+    static constexpr auto & instance() noexcept
+    {
+        return INSTANCE;
+    }
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Error_Statistics() noexcept = default;
+
+    Error_Statistics( Error_Statistics && ) = delete;
+
+    Error_Statistics( Error_Statistics const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Error_Statistics() noexcept = default;
+
+    auto operator=( Error_Statistics && ) = delete;
+
+    auto operator=( Error_Statistics const & ) = delete;
+
+    /**
+     * \brief Record an error.
+     *
+     * \param[in] error The error to record.
+     */
+    void record( Error_Code const & error ) noexcept
+    {
+        auto const category = &error.category();
+        auto const id       = error.id();
+
+        for ( auto & entry : m_entries ) {
+            auto state = entry.state.load( std::memory_order_acquire );
+
+            if ( state == State::UNUSED ) {
+                if ( entry.state.compare_exchange_strong(
+                         state, State::CLAIMED, std::memory_order_acquire, std::memory_order_acquire ) ) {
+                    entry.category = category;
+                    entry.id       = id;
+                    entry.count.fetch_add( 1, std::memory_order_relaxed );
+
+                    entry.state.store( State::IN_USE, std::memory_order_release );
+
+                    return;
+                } // if
+            }     // if
+
+            if ( state == State::IN_USE and entry.category == category and entry.id == id ) {
+                entry.count.fetch_add( 1, std::memory_order_relaxed );
+
+                return;
+            } // if
+        }     // for
+
+        m_dropped.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    /**
+     * \brief Get the number of errors that could not be recorded because the table was
+     *        full.
+     *
+     * \return The number of errors that could not be recorded because the table was
+     *         full.
+     */
+    auto dropped() const noexcept -> Count
+    {
+        return m_dropped.load( std::memory_order_relaxed );
+    }
+
+    /**
+     * \brief Get the number of times an error has been recorded.
+     *
+     * \param[in] error The error whose count is to be got.
+     *
+     * \return The number of times the error has been recorded.
+     */
+    auto count( Error_Code const & error ) const noexcept -> Count
+    {
+        auto count = Count{};
+
+        for ( auto const & entry : m_entries ) {
+            if ( entry.state.load( std::memory_order_acquire ) == State::IN_USE
+                 and entry.category == &error.category() and entry.id == error.id() ) {
+                count += entry.count.load( std::memory_order_relaxed );
+            } // if
+        }     // for
+
+        return count;
+    }
+
+    /**
+     * \brief Apply a functor to each recorded error.
+     *
+     * \tparam Functor A binary functor that takes a recorded error
+     *         (picolibrary::Error_Code) and the number of times it has been recorded
+     *         (picolibrary::Error_Statistics::Count), and returns either
+     *         picolibrary::Result<picolibrary::Void, picolibrary::Error_Code> or
+     *         picolibrary::Result<picolibrary::Void, picolibrary::Void>. If an error is
+     *         returned by the functor, iteration halts, and the error is returned.
+     *
+     * \param[in] functor The functor to apply to each recorded error.
+     *
+     * \return Nothing if application of the functor succeeded.
+     * \return An error code if application of the functor failed.
+     */
+    template<typename Functor>
+    auto for_each( Functor functor ) const noexcept -> Result<Void, Error_Code>
+    {
+        for ( auto const & entry : m_entries ) {
+            if ( entry.state.load( std::memory_order_acquire ) == State::IN_USE ) {
+                auto result = functor(
+                    Error_Code{ *entry.category, entry.id },
+                    entry.count.load( std::memory_order_relaxed ) );
+                if ( result.is_error() ) {
+                    return result.error();
+                } // if
+            }     // if
+        }         // for
+
+        return {};
+    }
+
+    /**
+     * \brief Reset all error counts to zero.
+     *
+     * \attention Table entries remain assigned to the error category / error ID pairs
+     *            that have already been recorded.
+     */
+    void reset() noexcept
+    {
+        for ( auto & entry : m_entries ) {
+            entry.count.store( 0, std::memory_order_relaxed );
+        } // for
+
+        m_dropped.store( 0, std::memory_order_relaxed );
+    }
+
+  private:
+    /**
+     * \brief Table entry state.
+     */
+    enum class State : std::uint_fast8_t {
+        UNUSED,  ///< Unused.
+        CLAIMED, ///< Claimed, but not yet initialized.
+        IN_USE,  ///< In use.
+    };
+
+    /**
+     * \brief Table entry.
+     */
+    struct Entry {
+        /**
+         * \brief The entry's state.
+         */
+        std::atomic<State> state{ State::UNUSED };
+
+        /**
+         * \brief The recorded error's category.
+         */
+        Error_Category const * category{};
+
+        /**
+         * \brief The recorded error's ID.
+         */
+        Error_ID id{};
+
+        /**
+         * \brief The number of times the error has been recorded.
+         */
+        std::atomic<Count> count{};
+    };
+
+    /**
+     * \brief The error statistics instance that picolibrary::Result records errors with.
+     */
+    static Error_Statistics INSTANCE;
+
+    /**
+     * \brief The table entries.
+     */
+    Entry m_entries[ CAPACITY ]{};
+
+    /**
+     * \brief The number of errors that could not be recorded because the table was full.
+     */
+    std::atomic<Count> m_dropped{};
+};
+
+/**
+ * \brief picolibrary::Error_Statistics output formatter.
+ *
+ * picolibrary::Error_Statistics only supports the default format specification ("{}").
+ * Each recorded error is written on its own line, followed by the number of errors that
+ * could not be recorded because the table was full.
+ */
+template<>
+class Output_Formatter<Error_Statistics> {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Output_Formatter() noexcept = default;
+
+    Output_Formatter( Output_Formatter && ) = delete;
+
+    Output_Formatter( Output_Formatter const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Output_Formatter() noexcept = default;
+
+    auto operator=( Output_Formatter && ) = delete;
+
+    auto operator=( Output_Formatter const & ) = delete;
+
+    /**
+     * \brief Parse the format specification for the picolibrary::Error_Statistics to be
+     *        formatted.
+     *
+     * \param[in] format The format specification for the picolibrary::Error_Statistics
+     *            to be formatted.
+     *
+     * \return format.
+     */
+    constexpr auto parse( char const * format ) noexcept -> Result<char const *, Void>
+    {
+        return format;
+    }
+
+    /**
+     * \brief Write the picolibrary::Error_Statistics to the stream.
+     *
+     * \param[in] stream The stream to write the picolibrary::Error_Statistics to.
+     * \param[in] statistics The picolibrary::Error_Statistics to write to the stream.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto print( Output_Stream & stream, Error_Statistics const & statistics ) noexcept
+        -> Result<Void, Error_Code>
+    {
+        {
+            auto result = statistics.for_each(
+                [ &stream ]( Error_Code const & error, Error_Statistics::Count count ) noexcept {
+                    return stream.print(
+                        "{} ({}): {}\n",
+                        error,
+                        Format::Decimal{ error.id() },
+                        Format::Decimal{ count } );
+                } );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }
+
+        return stream.print( "dropped: {}\n", Format::Decimal{ statistics.dropped() } );
+    }
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_ERROR_STATISTICS_H
@@ -0,0 +1,387 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Event_Loop interface.
+ */
+
+#ifndef PICOLIBRARY_EVENT_LOOP_H
+#define PICOLIBRARY_EVENT_LOOP_H
+
+#include <type_traits>
+
+#include "picolibrary/intrusive_list.h"
+#include "picolibrary/timer_queue.h"
+
+namespace picolibrary {
+
+template<typename Tick_Type>
+class Event_Loop;
+
+/**
+ * \brief Event loop task.
+ *
+ * Tasks are run to completion: picolibrary::Event_Loop_Task::run() must not block (e.g.
+ * busy-wait delay). A task that needs to wait for time to pass schedules itself
+ * (picolibrary::Event_Loop::schedule()), and a task that needs to wait for a
+ * non-blocking driver to become ready is watched (picolibrary::Event_Loop::watch()) and
+ * reports the driver's readiness from picolibrary::Event_Loop_Task::ready().
+ *
+ * A task can be posted to, scheduled in, and watched by at most one event loop at a
+ * time.
+ *
+ * \tparam Tick_Type The unsigned integer type used to represent points in time (ticks).
+ */
+template<typename Tick_Type>
+class Event_Loop_Task :
+    public Intrusive_Forward_List_Node,
+    public Intrusive_List_Node,
+    public Timer_Queue_Node<Tick_Type> {
+  public:
+    /**
+     * \brief The unsigned integer type used to represent points in time (ticks).
+     */
+    using Tick = Tick_Type;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Event_Loop_Task() noexcept = default;
+
+    Event_Loop_Task( Event_Loop_Task && ) = delete;
+
+    Event_Loop_Task( Event_Loop_Task const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * \warning Destroying a task that is posted, scheduled, or watched results in
+     *          undefined behavior.
+     */
+    ~Event_Loop_Task() noexcept = default;
+
+    auto operator=( Event_Loop_Task && ) = delete;
+
+    auto operator=( Event_Loop_Task const & ) = delete;
+
+    /**
+     * \brief Check if the task is posted (waiting to be run).
+     *
+     * \return true if the task is posted.
+     * \return false if the task is not posted.
+     */
+    constexpr auto posted() const noexcept -> bool
+    {
+        return m_posted;
+    }
+
+    /**
+     * \brief Check if the task is watched.
+     *
+     * \return true if the task is watched.
+     * \return false if the task is not watched.
+     */
+    constexpr auto watched() const noexcept -> bool
+    {
+        return Intrusive_List_Node::linked();
+    }
+
+    /**
+     * \brief Run the task.
+     */
+    virtual void run() noexcept = 0;
+
+    /**
+     * \brief Check if the task is ready to run (readiness hook).
+     *
+     * This function is called once per event loop iteration while the task is watched.
+     * If it returns true, the task is posted.
+     *
+     * \return true if the task is ready to run.
+     * \return false if the task is not ready to run.
+     */
+    virtual auto ready() noexcept -> bool
+    {
+        return false;
+    }
+
+  private:
+    template<typename>
+    friend class Event_Loop;
+
+    /**
+     * \brief The task's posting state.
+     */
+    bool m_posted{};
+};
+
+/**
+ * \brief Cooperative, single-threaded event loop.
+ *
+ * Each iteration of the loop:
+ * -# posts each scheduled task whose expiration time has been reached,
+ * -# posts each watched task that reports that it is ready,
+ * -# runs each task that was posted when the iteration started, in posting order.
+ *
+ * Tasks posted while an iteration's tasks are being run (including a task that reposts
+ * itself) are run during the next iteration, so a task cannot starve timers, watched
+ * tasks, or other tasks.
+ *
+ * \tparam Tick_Type The unsigned integer type used to represent points in time (ticks).
+ *
+ * \attention The event loop is not interrupt safe. Interrupt handlers should set flags
+ *            that watched tasks check from picolibrary::Event_Loop_Task::ready().
+ */
+template<typename Tick_Type>
+class Event_Loop {
+  public:
+    static_assert( std::is_unsigned_v<Tick_Type> );
+
+    /**
+     * \brief The unsigned integer type used to represent points in time (ticks).
+     */
+    using Tick = Tick_Type;
+
+    /**
+     * \brief The event loop task type.
+     */
+    using Task = Event_Loop_Task<Tick>;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Event_Loop() noexcept = default;
+
+    Event_Loop( Event_Loop && ) = delete;
+
+    Event_Loop( Event_Loop const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * \attention Posted, scheduled, and watched tasks are not run, canceled, or
+     *            unwatched.
+     */
+    ~Event_Loop() noexcept = default;
+
+    auto operator=( Event_Loop && ) = delete;
+
+    auto operator=( Event_Loop const & ) = delete;
+
+    /**
+     * \brief Check if the event loop is idle (no tasks are posted).
+     *
+     * \return true if the event loop is idle.
+     * \return false if the event loop is not idle.
+     */
+    constexpr auto idle() const noexcept -> bool
+    {
+        return m_posted.empty();
+    }
+
+    /**
+     * \brief Check if any tasks are scheduled.
+     *
+     * \return true if any tasks are scheduled.
+     * \return false if no tasks are scheduled.
+     */
+    constexpr auto scheduled() const noexcept -> bool
+    {
+        return not m_scheduled.empty();
+    }
+
+    /**
+     * \brief Get the expiration time of the scheduled task that will expire next.
+     *
+     * Idle handlers can use this to determine how long they can sleep for.
+     *
+     * \warning Calling this function when no tasks are scheduled results in undefined
+     *          behavior.
+     *
+     * \return The expiration time of the scheduled task that will expire next.
+     */
+    constexpr auto next_expiration() const noexcept -> Tick
+    {
+        return m_scheduled.next_expiration();
+    }
+
+    /**
+     * \brief Check if any tasks are watched.
+     *
+     * \return true if any tasks are watched.
+     * \return false if no tasks are watched.
+     */
+    constexpr auto watching() const noexcept -> bool
+    {
+        return not m_watched.empty();
+    }
+
+    /**
+     * \brief Post a task (run it during the next iteration).
+     *
+     * \param[in] task The task to post (posting a task that is already posted has no
+     *            effect).
+     */
+    constexpr void post( Task & task ) noexcept
+    {
+        if ( not task.m_posted ) {
+            task.m_posted = true;
+
+            m_posted.push_back( task );
+        } // if
+    }
+
+    /**
+     * \brief Schedule a task (post it when its expiration time is reached).
+     *
+     * If the task is already scheduled, it is rescheduled.
+     *
+     * \param[in] task The task to schedule.
+     * \param[in] expiration The task's expiration time.
+     */
+    constexpr void schedule( Task & task, Tick expiration ) noexcept
+    {
+        m_scheduled.schedule( task, expiration );
+    }
+
+    /**
+     * \brief Cancel a task's scheduling.
+     *
+     * \param[in] task The task to cancel the scheduling of (may be unscheduled).
+     */
+    constexpr void cancel( Task & task ) noexcept
+    {
+        m_scheduled.cancel( task );
+    }
+
+    /**
+     * \brief Watch a task (post it whenever it reports that it is ready).
+     *
+     * \param[in] task The task to watch (watching a task that is already watched has no
+     *            effect).
+     */
+    constexpr void watch( Task & task ) noexcept
+    {
+        if ( not task.watched() ) {
+            m_watched.push_back( task );
+        } // if
+    }
+
+    /**
+     * \brief Stop watching a task.
+     *
+     * \param[in] task The task to stop watching (may be unwatched).
+     */
+    constexpr void unwatch( Task & task ) noexcept
+    {
+        if ( task.watched() ) {
+            m_watched.erase( task );
+        } // if
+    }
+
+    /**
+     * \brief Perform a single event loop iteration.
+     *
+     * \param[in] now The current time.
+     *
+     * \return true if any tasks were run.
+     * \return false if no tasks were run.
+     */
+    auto poll( Tick now ) noexcept -> bool
+    {
+        m_scheduled.expire( now, [ this ]( Task & task ) noexcept { post( task ); } );
+
+        for ( auto & task : m_watched ) {
+            if ( task.ready() ) {
+                post( task );
+            } // if
+        }     // for
+
+        auto const tasks = m_posted.size();
+
+        for ( auto i = tasks; i; --i ) {
+            auto & task = m_posted.pop_front();
+
+            task.m_posted = false;
+
+            task.run();
+        } // for
+
+        return tasks != 0;
+    }
+
+    /**
+     * \brief Run the event loop until it is stopped.
+     *
+     * \tparam Clock A nullary functor that returns the current time.
+     * \tparam Idle A nullary functor that is called after each iteration in which no
+     *         tasks were run (no tasks are posted at that point). The functor can put the
+     *         system to sleep until the next scheduled task expires
+     *         (picolibrary::Event_Loop::next_expiration()) or an interrupt occurs. If
+     *         tasks are watched (picolibrary::Event_Loop::watching()), the functor must
+     *         not sleep for longer than the watched tasks can tolerate.
+     *
+     * \param[in] clock The clock to use to get the current time.
+     * \param[in] idle The idle functor.
+     */
+    template<typename Clock, typename Idle>
+    void run( Clock clock, Idle idle ) noexcept
+    {
+        m_stopped = false;
+
+        while ( not m_stopped ) {
+            if ( not poll( clock() ) ) {
+                idle();
+            } // if
+        }     // while
+    }
+
+    /**
+     * \brief Stop the event loop (picolibrary::Event_Loop::run() returns after the
+     *        current iteration completes).
+     */
+    constexpr void stop() noexcept
+    {
+        m_stopped = true;
+    }
+
+  private:
+    /**
+     * \brief The posted tasks.
+     */
+    Intrusive_Forward_List<Task> m_posted{};
+
+    /**
+     * \brief The scheduled tasks.
+     */
+    Timer_Queue<Task> m_scheduled{};
+
+    /**
+     * \brief The watched tasks.
+     */
+    Intrusive_List<Task> m_watched{};
+
+    /**
+     * \brief The event loop's stop request state.
+     */
+    bool m_stopped{};
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_EVENT_LOOP_H
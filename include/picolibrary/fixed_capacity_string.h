@@ -0,0 +1,779 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Fixed_Capacity_String interface.
+ */
+
+#ifndef PICOLIBRARY_FIXED_CAPACITY_STRING_H
+#define PICOLIBRARY_FIXED_CAPACITY_STRING_H
+
+#include <cstddef>
+
+#include "picolibrary/error.h"
+#include "picolibrary/iterator.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+#include "picolibrary/void.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Fixed capacity null-terminated string.
+ *
+ * A variable length string whose characters are stored inline. No dynamic memory
+ * allocation is performed.
+ *
+ * \tparam N The maximum number of characters in the string (excluding the null
+ *         terminator).
+ *
+ * \attention picolibrary::Fixed_Capacity_String is trivially copyable.
+ */
+template<std::size_t N>
+class Fixed_Capacity_String {
+  public:
+    /**
+     * \brief The string character type.
+     */
+    using Value = char;
+
+    /**
+     * \brief The number of characters in the string.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief A string character position.
+     */
+    using Position = std::size_t;
+
+    /**
+     * \brief A reference to a string character.
+     */
+    using Reference = Value &;
+
+    /**
+     * \brief A reference to a const string character.
+     */
+    using Const_Reference = Value const &;
+
+    /**
+     * \brief A pointer to a string character.
+     */
+    using Pointer = Value *;
+
+    /**
+     * \brief A pointer to a const string character.
+     */
+    using Const_Pointer = Value const *;
+
+    /**
+     * \brief A string iterator.
+     */
+    using Iterator = Pointer;
+
+    /**
+     * \brief A const string iterator.
+     */
+    using Const_Iterator = Const_Pointer;
+
+    /**
+     * \brief A string reverse iterator.
+     */
+    using Reverse_Iterator = ::picolibrary::Reverse_Iterator<Iterator>;
+
+    /**
+     * \brief A string const reverse iterator.
+     */
+    using Const_Reverse_Iterator = ::picolibrary::Reverse_Iterator<Const_Iterator>;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Fixed_Capacity_String() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \warning If the length of string is greater than N, the behavior is undefined.
+     *
+     * \param[in] string The null-terminated string to initialize the string with.
+     */
+    constexpr Fixed_Capacity_String( char const * string ) noexcept
+    {
+        append( string );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \warning If size is greater than N, the behavior is undefined.
+     *
+     * \param[in] size The number of characters in the string.
+     * \param[in] character The character to initialize the string's characters with.
+     */
+    constexpr Fixed_Capacity_String( Size size, char character ) noexcept
+    {
+        resize( size, character );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Fixed_Capacity_String( Fixed_Capacity_String && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Fixed_Capacity_String( Fixed_Capacity_String const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fixed_Capacity_String() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Fixed_Capacity_String && expression ) noexcept
+        -> Fixed_Capacity_String & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Fixed_Capacity_String const & expression ) noexcept
+        -> Fixed_Capacity_String & = default;
+
+    /**
+     * \brief Access the character at the specified position in the string.
+     *
+     * \warning Bounds checking is not performed.
+     *
+     * \param[in] position The position of the string character to access.
+     *
+     * \return The character at the specified position in the string.
+     */
+    constexpr auto operator[]( Position position ) noexcept -> Reference
+    {
+        return m_string[ position ];
+    }
+
+    /**
+     * \brief Access the character at the specified position in the string.
+     *
+     * \warning Bounds checking is not performed.
+     *
+     * \param[in] position The position of the string character to access.
+     *
+     * \return The character at the specified position in the string.
+     */
+    constexpr auto operator[]( Position position ) const noexcept -> Const_Reference
+    {
+        return m_string[ position ];
+    }
+
+    /**
+     * \brief Access the first character of the string.
+     *
+     * \warning Calling this function on an empty string results in undefined behavior.
+     *
+     * \return The first character of the string.
+     */
+    constexpr auto front() noexcept -> Reference
+    {
+        return *begin();
+    }
+
+    /**
+     * \brief Access the first character of the string.
+     *
+     * \warning Calling this function on an empty string results in undefined behavior.
+     *
+     * \return The first character of the string.
+     */
+    constexpr auto front() const noexcept -> Const_Reference
+    {
+        return *begin();
+    }
+
+    /**
+     * \brief Access the last character of the string.
+     *
+     * \warning Calling this function on an empty string results in undefined behavior.
+     *
+     * \return The last character of the string.
+     */
+    constexpr auto back() noexcept -> Reference
+    {
+        return *( end() - 1 );
+    }
+
+    /**
+     * \brief Access the last character of the string.
+     *
+     * \warning Calling this function on an empty string results in undefined behavior.
+     *
+     * \return The last character of the string.
+     */
+    constexpr auto back() const noexcept -> Const_Reference
+    {
+        return *( end() - 1 );
+    }
+
+    /**
+     * \brief Access the underlying null-terminated string.
+     *
+     * \return The underlying null-terminated string.
+     */
+    constexpr auto data() noexcept -> Pointer
+    {
+        return &m_string[ 0 ];
+    }
+
+    /**
+     * \brief Access the underlying null-terminated string.
+     *
+     * \return The underlying null-terminated string.
+     */
+    constexpr auto data() const noexcept -> Const_Pointer
+    {
+        return &m_string[ 0 ];
+    }
+
+    /**
+     * \brief Access the underlying null-terminated string.
+     *
+     * \return The underlying null-terminated string.
+     */
+    constexpr auto c_str() const noexcept -> Const_Pointer
+    {
+        return data();
+    }
+
+    /**
+     * \brief Get an iterator to the first character of the string.
+     *
+     * \return An iterator to the first character of the string.
+     */
+    constexpr auto begin() noexcept -> Iterator
+    {
+        return data();
+    }
+
+    /**
+     * \brief Get an iterator to the first character of the string.
+     *
+     * \return An iterator to the first character of the string.
+     */
+    constexpr auto begin() const noexcept -> Const_Iterator
+    {
+        return data();
+    }
+
+    /**
+     * \brief Get an iterator to the first character of the string.
+     *
+     * \return An iterator to the first character of the string.
+     */
+    constexpr auto cbegin() const noexcept -> Const_Iterator
+    {
+        return data();
+    }
+
+    /**
+     * \brief Get an iterator to the character following the last character of the
+     *        string.
+     *
+     * \return An iterator to the character following the last character of the string
+     *         (the null terminator).
+     */
+    constexpr auto end() noexcept -> Iterator
+    {
+        return begin() + size();
+    }
+
+    /**
+     * \brief Get an iterator to the character following the last character of the
+     *        string.
+     *
+     * \return An iterator to the character following the last character of the string
+     *         (the null terminator).
+     */
+    constexpr auto end() const noexcept -> Const_Iterator
+    {
+        return begin() + size();
+    }
+
+    /**
+     * \brief Get an iterator to the character following the last character of the
+     *        string.
+     *
+     * \return An iterator to the character following the last character of the string
+     *         (the null terminator).
+     */
+    constexpr auto cend() const noexcept -> Const_Iterator
+    {
+        return begin() + size();
+    }
+
+    /**
+     * \brief Get an iterator to the first character of the reversed string.
+     *
+     * \return An iterator to the first character of the reversed string.
+     */
+    constexpr auto rbegin() noexcept
+    {
+        return Reverse_Iterator{ end() };
+    }
+
+    /**
+     * \brief Get an iterator to the first character of the reversed string.
+     *
+     * \return An iterator to the first character of the reversed string.
+     */
+    constexpr auto rbegin() const noexcept
+    {
+        return Const_Reverse_Iterator{ end() };
+    }
+
+    /**
+     * \brief Get an iterator to the first character of the reversed string.
+     *
+     * \return An iterator to the first character of the reversed string.
+     */
+    constexpr auto crbegin() const noexcept
+    {
+        return Const_Reverse_Iterator{ cend() };
+    }
+
+    /**
+     * \brief Get an iterator to the character following the last character of the
+     *        reversed string.
+     *
+     * \warning Attempting to access the character following the last character of a
+     *          reversed string results in undefined behavior.
+     *
+     * \return An iterator to the character following the last character of the reversed
+     *         string.
+     */
+    constexpr auto rend() noexcept
+    {
+        return Reverse_Iterator{ begin() };
+    }
+
+    /**
+     * \brief Get an iterator to the character following the last character of the
+     *        reversed string.
+     *
+     * \warning Attempting to access the character following the last character of a
+     *          reversed string results in undefined behavior.
+     *
+     * \return An iterator to the character following the last character of the reversed
+     *         string.
+     */
+    constexpr auto rend() const noexcept
+    {
+        return Const_Reverse_Iterator{ begin() };
+    }
+
+    /**
+     * \brief Get an iterator to the character following the last character of the
+     *        reversed string.
+     *
+     * \warning Attempting to access the character following the last character of a
+     *          reversed string results in undefined behavior.
+     *
+     * \return An iterator to the character following the last character of the reversed
+     *         string.
+     */
+    constexpr auto crend() const noexcept
+    {
+        return Const_Reverse_Iterator{ cbegin() };
+    }
+
+    /**
+     * \brief Check if the string is empty.
+     *
+     * \return true if the string is empty.
+     * \return false if the string is not empty.
+     */
+    [[nodiscard]] constexpr auto empty() const noexcept
+    {
+        return not size();
+    }
+
+    /**
+     * \brief Check if the string is full.
+     *
+     * \return true if the string is full.
+     * \return false if the string is not full.
+     */
+    constexpr auto full() const noexcept
+    {
+        return size() == max_size();
+    }
+
+    /**
+     * \brief Get the number of characters in the string.
+     *
+     * \return The number of characters in the string.
+     */
+    constexpr auto size() const noexcept -> Size
+    {
+        return m_size;
+    }
+
+    /**
+     * \brief Get the maximum number of characters in the string.
+     *
+     * \return The maximum number of characters in the string.
+     */
+    static constexpr auto max_size() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get the maximum number of characters in the string.
+     *
+     * \return The maximum number of characters in the string.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Remove all characters from the string.
+     */
+    constexpr void clear() noexcept
+    {
+        resize( 0 );
+    }
+
+    /**
+     * \brief Append a character to the end of the string.
+     *
+     * \warning Calling this function on a full string results in undefined behavior.
+     *
+     * \param[in] character The character to append to the end of the string.
+     */
+    constexpr void push_back( char character ) noexcept
+    {
+        m_string[ m_size++ ] = character;
+        m_string[ m_size ]   = '\0';
+    }
+
+    /**
+     * \brief Remove the last character of the string.
+     *
+     * \warning Calling this function on an empty string results in undefined behavior.
+     */
+    constexpr void pop_back() noexcept
+    {
+        m_string[ --m_size ] = '\0';
+    }
+
+    /**
+     * \brief Append a null-terminated string to the end of the string.
+     *
+     * \warning If the resulting length is greater than N, the behavior is undefined.
+     *
+     * \param[in] string The null-terminated string to append to the end of the string.
+     *
+     * \return The string.
+     */
+    constexpr auto append( char const * string ) noexcept -> Fixed_Capacity_String &
+    {
+        for ( ; *string; ++string ) {
+            m_string[ m_size++ ] = *string;
+        } // for
+
+        m_string[ m_size ] = '\0';
+
+        return *this;
+    }
+
+    /**
+     * \brief Append a character to the end of the string.
+     *
+     * \warning Calling this function on a full string results in undefined behavior.
+     *
+     * \param[in] character The character to append to the end of the string.
+     *
+     * \return The string.
+     */
+    constexpr auto operator+=( char character ) noexcept -> Fixed_Capacity_String &
+    {
+        push_back( character );
+
+        return *this;
+    }
+
+    /**
+     * \brief Append a null-terminated string to the end of the string.
+     *
+     * \warning If the resulting length is greater than N, the behavior is undefined.
+     *
+     * \param[in] string The null-terminated string to append to the end of the string.
+     *
+     * \return The string.
+     */
+    constexpr auto operator+=( char const * string ) noexcept -> Fixed_Capacity_String &
+    {
+        return append( string );
+    }
+
+    /**
+     * \brief Change the number of characters in the string.
+     *
+     * \warning If size is greater than N, the behavior is undefined.
+     *
+     * \param[in] size The new number of characters in the string. If characters are
+     *            added, they are null characters.
+     */
+    constexpr void resize( Size size ) noexcept
+    {
+        resize( size, '\0' );
+    }
+
+    /**
+     * \brief Change the number of characters in the string.
+     *
+     * \warning If size is greater than N, the behavior is undefined.
+     *
+     * \param[in] size The new number of characters in the string.
+     * \param[in] character The character to initialize added characters with.
+     */
+    constexpr void resize( Size size, char character ) noexcept
+    {
+        for ( ; m_size < size; ++m_size ) {
+            m_string[ m_size ] = character;
+        } // for
+
+        m_size             = size;
+        m_string[ m_size ] = '\0';
+    }
+
+  private:
+    /**
+     * \brief The underlying null-terminated string.
+     */
+    char m_string[ N + 1 ]{};
+
+    /**
+     * \brief The number of characters in the string.
+     */
+    Size m_size{};
+};
+
+/**
+ * \brief Equality operator.
+ *
+ * \relatedalso picolibrary::Fixed_Capacity_String
+ *
+ * \param[in] lhs The left hand side of the comparison.
+ * \param[in] rhs The right hand side of the comparison.
+ *
+ * \return true if lhs is equal to rhs.
+ * \return false if lhs is not equal to rhs.
+ */
+template<std::size_t N>
+constexpr auto operator==( Fixed_Capacity_String<N> const & lhs, char const * rhs ) noexcept
+{
+    for ( auto const character : lhs ) {
+        if ( not *rhs or character != *rhs ) {
+            return false;
+        } // if
+
+        ++rhs;
+    } // for
+
+    return not *rhs;
+}
+
+/**
+ * \brief Equality operator.
+ *
+ * \relatedalso picolibrary::Fixed_Capacity_String
+ *
+ * \param[in] lhs The left hand side of the comparison.
+ * \param[in] rhs The right hand side of the comparison.
+ *
+ * \return true if lhs is equal to rhs.
+ * \return false if lhs is not equal to rhs.
+ */
+template<std::size_t N>
+constexpr auto operator==( char const * lhs, Fixed_Capacity_String<N> const & rhs ) noexcept
+{
+    return rhs == lhs;
+}
+
+/**
+ * \brief Equality operator.
+ *
+ * \relatedalso picolibrary::Fixed_Capacity_String
+ *
+ * \param[in] lhs The left hand side of the comparison.
+ * \param[in] rhs The right hand side of the comparison.
+ *
+ * \return true if lhs is equal to rhs.
+ * \return false if lhs is not equal to rhs.
+ */
+template<std::size_t N, std::size_t M>
+constexpr auto operator==( Fixed_Capacity_String<N> const & lhs, Fixed_Capacity_String<M> const & rhs ) noexcept
+{
+    if ( lhs.size() != rhs.size() ) {
+        return false;
+    } // if
+
+    auto rhs_character = rhs.begin();
+    for ( auto const character : lhs ) {
+        if ( character != *rhs_character ) {
+            return false;
+        } // if
+
+        ++rhs_character;
+    } // for
+
+    return true;
+}
+
+/**
+ * \brief Inequality operator.
+ *
+ * \relatedalso picolibrary::Fixed_Capacity_String
+ *
+ * \param[in] lhs The left hand side of the comparison.
+ * \param[in] rhs The right hand side of the comparison.
+ *
+ * \return true if lhs is not equal to rhs.
+ * \return false if lhs is equal to rhs.
+ */
+template<std::size_t N>
+constexpr auto operator!=( Fixed_Capacity_String<N> const & lhs, char const * rhs ) noexcept
+{
+    return not( lhs == rhs );
+}
+
+/**
+ * \brief Inequality operator.
+ *
+ * \relatedalso picolibrary::Fixed_Capacity_String
+ *
+ * \param[in] lhs The left hand side of the comparison.
+ * \param[in] rhs The right hand side of the comparison.
+ *
+ * \return true if lhs is not equal to rhs.
+ * \return false if lhs is equal to rhs.
+ */
+template<std::size_t N>
+constexpr auto operator!=( char const * lhs, Fixed_Capacity_String<N> const & rhs ) noexcept
+{
+    return not( lhs == rhs );
+}
+
+/**
+ * \brief Inequality operator.
+ *
+ * \relatedalso picolibrary::Fixed_Capacity_String
+ *
+ * \param[in] lhs The left hand side of the comparison.
+ * \param[in] rhs The right hand side of the comparison.
+ *
+ * \return true if lhs is not equal to rhs.
+ * \return false if lhs is equal to rhs.
+ */
+template<std::size_t N, std::size_t M>
+constexpr auto operator!=( Fixed_Capacity_String<N> const & lhs, Fixed_Capacity_String<M> const & rhs ) noexcept
+{
+    return not( lhs == rhs );
+}
+
+/**
+ * \brief picolibrary::Fixed_Capacity_String output formatter.
+ *
+ * \tparam N The maximum number of characters in the string.
+ *
+ * picolibrary::Fixed_Capacity_String only supports the default format specification
+ * ("{}").
+ */
+template<std::size_t N>
+class Output_Formatter<Fixed_Capacity_String<N>> {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Output_Formatter() noexcept = default;
+
+    Output_Formatter( Output_Formatter && ) = delete;
+
+    Output_Formatter( Output_Formatter const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Output_Formatter() noexcept = default;
+
+    auto operator=( Output_Formatter && ) = delete;
+
+    auto operator=( Output_Formatter const & ) = delete;
+
+    /**
+     * \brief Parse the format specification for the string to be formatted.
+     *
+     * \param[in] format The format specification for the string to be formatted.
+     *
+     * \return format.
+     */
+    constexpr auto parse( char const * format ) noexcept -> Result<char const *, Void>
+    {
+        return format;
+    }
+
+    /**
+     * \brief Write the string to the stream.
+     *
+     * \param[in] stream The stream to write the string to.
+     * \param[in] string The string to write to the stream.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto print( Output_Stream & stream, Fixed_Capacity_String<N> const & string ) noexcept
+        -> Result<Void, Error_Code>
+    {
+        return stream.put( string.begin(), string.end() );
+    }
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_FIXED_CAPACITY_STRING_H
@@ -0,0 +1,865 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Fixed_Capacity_Vector interface.
+ */
+
+#ifndef PICOLIBRARY_FIXED_CAPACITY_VECTOR_H
+#define PICOLIBRARY_FIXED_CAPACITY_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "picolibrary/iterator.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Fixed capacity vector element storage.
+ *
+ * \tparam T The vector element type.
+ * \tparam N The maximum number of elements in the vector.
+ *
+ * Trivially copyable element types use trivially copyable storage so that the vector
+ * is trivially copyable when its element type is.
+ */
+template<typename T, std::size_t N, bool = std::is_trivially_copyable_v<T>>
+class Fixed_Capacity_Vector_Storage;
+
+/**
+ * \brief Fixed capacity vector element storage specialized for trivially copyable
+ *        element types.
+ *
+ * \tparam T The vector element type.
+ * \tparam N The maximum number of elements in the vector.
+ */
+template<typename T, std::size_t N>
+class Fixed_Capacity_Vector_Storage<T, N, true> {
+  protected:
+    /**
+     * \brief Constructor.
+     */
+    Fixed_Capacity_Vector_Storage() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    Fixed_Capacity_Vector_Storage( Fixed_Capacity_Vector_Storage && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    Fixed_Capacity_Vector_Storage( Fixed_Capacity_Vector_Storage const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fixed_Capacity_Vector_Storage() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Fixed_Capacity_Vector_Storage && expression ) noexcept
+        -> Fixed_Capacity_Vector_Storage & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Fixed_Capacity_Vector_Storage const & expression ) noexcept
+        -> Fixed_Capacity_Vector_Storage & = default;
+
+    /**
+     * \brief Access the element storage.
+     *
+     * \return The element storage.
+     */
+    auto elements() noexcept -> T *
+    {
+        return std::launder( reinterpret_cast<T *>( &m_storage ) );
+    }
+
+    /**
+     * \brief Access the element storage.
+     *
+     * \return The element storage.
+     */
+    auto elements() const noexcept -> T const *
+    {
+        return std::launder( reinterpret_cast<T const *>( &m_storage ) );
+    }
+
+    /**
+     * \brief The number of elements in the vector.
+     */
+    std::size_t m_size{};
+
+    /**
+     * \brief The element storage.
+     */
+    std::aligned_storage_t<sizeof( T ), alignof( T )> m_storage[ N ? N : 1 ];
+};
+
+/**
+ * \brief Fixed capacity vector element storage specialized for non-trivially copyable
+ *        element types.
+ *
+ * \tparam T The vector element type.
+ * \tparam N The maximum number of elements in the vector.
+ */
+template<typename T, std::size_t N>
+class Fixed_Capacity_Vector_Storage<T, N, false> {
+  protected:
+    /**
+     * \brief Constructor.
+     */
+    Fixed_Capacity_Vector_Storage() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    Fixed_Capacity_Vector_Storage( Fixed_Capacity_Vector_Storage && source ) noexcept
+    {
+        construct( std::move( source ) );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    Fixed_Capacity_Vector_Storage( Fixed_Capacity_Vector_Storage const & original ) noexcept
+    {
+        construct( original );
+    }
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fixed_Capacity_Vector_Storage() noexcept
+    {
+        destroy();
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Fixed_Capacity_Vector_Storage && expression ) noexcept
+        -> Fixed_Capacity_Vector_Storage &
+    {
+        if ( &expression != this ) {
+            destroy();
+
+            construct( std::move( expression ) );
+        } // if
+
+        return *this;
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Fixed_Capacity_Vector_Storage const & expression ) noexcept
+        -> Fixed_Capacity_Vector_Storage &
+    {
+        if ( &expression != this ) {
+            destroy();
+
+            construct( expression );
+        } // if
+
+        return *this;
+    }
+
+    /**
+     * \brief Access the element storage.
+     *
+     * \return The element storage.
+     */
+    auto elements() noexcept -> T *
+    {
+        return std::launder( reinterpret_cast<T *>( &m_storage ) );
+    }
+
+    /**
+     * \brief Access the element storage.
+     *
+     * \return The element storage.
+     */
+    auto elements() const noexcept -> T const *
+    {
+        return std::launder( reinterpret_cast<T const *>( &m_storage ) );
+    }
+
+    /**
+     * \brief The number of elements in the vector.
+     */
+    std::size_t m_size{};
+
+    /**
+     * \brief The element storage.
+     */
+    std::aligned_storage_t<sizeof( T ), alignof( T )> m_storage[ N ? N : 1 ];
+
+  private:
+    /**
+     * \brief Construct this storage's elements from another storage's elements.
+     *
+     * \tparam Storage The type of the storage to construct this storage's elements from.
+     *
+     * \param[in] storage The storage to construct this storage's elements from.
+     */
+    template<typename Storage>
+    void construct( Storage && storage ) noexcept
+    {
+        for ( auto position = std::size_t{}; position < storage.m_size; ++position ) {
+            if constexpr ( std::is_rvalue_reference_v<Storage &&> ) {
+                new ( &m_storage[ position ] ) T( std::move( storage.elements()[ position ] ) );
+            } else {
+                new ( &m_storage[ position ] ) T( storage.elements()[ position ] );
+            } // else
+        }     // for
+
+        m_size = storage.m_size;
+    }
+
+    /**
+     * \brief Destroy this storage's elements.
+     */
+    void destroy() noexcept
+    {
+        for ( auto position = std::size_t{}; position < m_size; ++position ) {
+            elements()[ position ].~T();
+        } // for
+
+        m_size = 0;
+    }
+};
+
+/**
+ * \brief Fixed capacity vector.
+ *
+ * A variable length sequence of elements that are stored inline. No dynamic memory
+ * allocation is performed.
+ *
+ * \tparam T The vector element type.
+ * \tparam N The maximum number of elements in the vector.
+ *
+ * \attention picolibrary::Fixed_Capacity_Vector is trivially copyable if T is trivially
+ *            copyable.
+ */
+template<typename T, std::size_t N>
+class Fixed_Capacity_Vector : private Fixed_Capacity_Vector_Storage<T, N> {
+  public:
+    /**
+     * \brief The vector element type.
+     */
+    using Value = T;
+
+    /**
+     * \brief The number of elements in the vector.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief A vector element position.
+     */
+    using Position = std::size_t;
+
+    /**
+     * \brief A reference to a vector element.
+     */
+    using Reference = Value &;
+
+    /**
+     * \brief A reference to a const vector element.
+     */
+    using Const_Reference = Value const &;
+
+    /**
+     * \brief A pointer to a vector element.
+     */
+    using Pointer = Value *;
+
+    /**
+     * \brief A pointer to a const vector element.
+     */
+    using Const_Pointer = Value const *;
+
+    /**
+     * \brief A vector iterator.
+     */
+    using Iterator = Pointer;
+
+    /**
+     * \brief A const vector iterator.
+     */
+    using Const_Iterator = Const_Pointer;
+
+    /**
+     * \brief A vector reverse iterator.
+     */
+    using Reverse_Iterator = ::picolibrary::Reverse_Iterator<Iterator>;
+
+    /**
+     * \brief A vector const reverse iterator.
+     */
+    using Const_Reverse_Iterator = ::picolibrary::Reverse_Iterator<Const_Iterator>;
+
+    /**
+     * \brief Constructor.
+     */
+    Fixed_Capacity_Vector() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \warning If size is greater than N, the behavior is undefined.
+     *
+     * \param[in] size The number of elements in the vector.
+     * \param[in] value The value to initialize the vector's elements with.
+     */
+    Fixed_Capacity_Vector( Size size, Const_Reference value ) noexcept
+    {
+        resize( size, value );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \warning If the number of values is greater than N, the behavior is undefined.
+     *
+     * \param[in] values The values to initialize the vector's elements with.
+     */
+    Fixed_Capacity_Vector( std::initializer_list<Value> values ) noexcept
+    {
+        for ( auto const & value : values ) {
+            push_back( value );
+        } // for
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    Fixed_Capacity_Vector( Fixed_Capacity_Vector && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    Fixed_Capacity_Vector( Fixed_Capacity_Vector const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fixed_Capacity_Vector() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Fixed_Capacity_Vector && expression ) noexcept
+        -> Fixed_Capacity_Vector & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Fixed_Capacity_Vector const & expression ) noexcept
+        -> Fixed_Capacity_Vector & = default;
+
+    /**
+     * \brief Access the element at the specified position in the vector.
+     *
+     * \warning Bounds checking is not performed.
+     *
+     * \param[in] position The position of the vector element to access.
+     *
+     * \return The element at the specified position in the vector.
+     */
+    auto operator[]( Position position ) noexcept -> Reference
+    {
+        return data()[ position ];
+    }
+
+    /**
+     * \brief Access the element at the specified position in the vector.
+     *
+     * \warning Bounds checking is not performed.
+     *
+     * \param[in] position The position of the vector element to access.
+     *
+     * \return The element at the specified position in the vector.
+     */
+    auto operator[]( Position position ) const noexcept -> Const_Reference
+    {
+        return data()[ position ];
+    }
+
+    /**
+     * \brief Access the first element of the vector.
+     *
+     * \warning Calling this function on an empty vector results in undefined behavior.
+     *
+     * \return The first element of the vector.
+     */
+    auto front() noexcept -> Reference
+    {
+        return *begin();
+    }
+
+    /**
+     * \brief Access the first element of the vector.
+     *
+     * \warning Calling this function on an empty vector results in undefined behavior.
+     *
+     * \return The first element of the vector.
+     */
+    auto front() const noexcept -> Const_Reference
+    {
+        return *begin();
+    }
+
+    /**
+     * \brief Access the last element of the vector.
+     *
+     * \warning Calling this function on an empty vector results in undefined behavior.
+     *
+     * \return The last element of the vector.
+     */
+    auto back() noexcept -> Reference
+    {
+        return *( end() - 1 );
+    }
+
+    /**
+     * \brief Access the last element of the vector.
+     *
+     * \warning Calling this function on an empty vector results in undefined behavior.
+     *
+     * \return The last element of the vector.
+     */
+    auto back() const noexcept -> Const_Reference
+    {
+        return *( end() - 1 );
+    }
+
+    /**
+     * \brief Access the underlying array.
+     *
+     * \return The underlying array.
+     */
+    auto data() noexcept -> Pointer
+    {
+        return this->elements();
+    }
+
+    /**
+     * \brief Access the underlying array.
+     *
+     * \return The underlying array.
+     */
+    auto data() const noexcept -> Const_Pointer
+    {
+        return this->elements();
+    }
+
+    /**
+     * \brief Get an iterator to the first element of the vector.
+     *
+     * \return An iterator to the first element of the vector.
+     */
+    auto begin() noexcept -> Iterator
+    {
+        return data();
+    }
+
+    /**
+     * \brief Get an iterator to the first element of the vector.
+     *
+     * \return An iterator to the first element of the vector.
+     */
+    auto begin() const noexcept -> Const_Iterator
+    {
+        return data();
+    }
+
+    /**
+     * \brief Get an iterator to the first element of the vector.
+     *
+     * \return An iterator to the first element of the vector.
+     */
+    auto cbegin() const noexcept -> Const_Iterator
+    {
+        return data();
+    }
+
+    /**
+     * \brief Get an iterator to the element following the last element of the vector.
+     *
+     * \warning Attempting to access the element following the last element of a vector
+     *          results in undefined behavior.
+     *
+     * \return An iterator to the element following the last element of the vector.
+     */
+    auto end() noexcept -> Iterator
+    {
+        return begin() + size();
+    }
+
+    /**
+     * \brief Get an iterator to the element following the last element of the vector.
+     *
+     * \warning Attempting to access the element following the last element of a vector
+     *          results in undefined behavior.
+     *
+     * \return An iterator to the element following the last element of the vector.
+     */
+    auto end() const noexcept -> Const_Iterator
+    {
+        return begin() + size();
+    }
+
+    /**
+     * \brief Get an iterator to the element following the last element of the vector.
+     *
+     * \warning Attempting to access the element following the last element of a vector
+     *          results in undefined behavior.
+     *
+     * \return An iterator to the element following the last element of the vector.
+     */
+    auto cend() const noexcept -> Const_Iterator
+    {
+        return begin() + size();
+    }
+
+    /**
+     * \brief Get an iterator to the first element of the reversed vector.
+     *
+     * \return An iterator to the first element of the reversed vector.
+     */
+    auto rbegin() noexcept
+    {
+        return Reverse_Iterator{ end() };
+    }
+
+    /**
+     * \brief Get an iterator to the first element of the reversed vector.
+     *
+     * \return An iterator to the first element of the reversed vector.
+     */
+    auto rbegin() const noexcept
+    {
+        return Const_Reverse_Iterator{ end() };
+    }
+
+    /**
+     * \brief Get an iterator to the first element of the reversed vector.
+     *
+     * \return An iterator to the first element of the reversed vector.
+     */
+    auto crbegin() const noexcept
+    {
+        return Const_Reverse_Iterator{ cend() };
+    }
+
+    /**
+     * \brief Get an iterator to the element following the last element of the reversed
+     *        vector.
+     *
+     * \warning Attempting to access the element following the last element of a reversed
+     *          vector results in undefined behavior.
+     *
+     * \return An iterator to the element following the last element of the reversed
+     *         vector.
+     */
+    auto rend() noexcept
+    {
+        return Reverse_Iterator{ begin() };
+    }
+
+    /**
+     * \brief Get an iterator to the element following the last element of the reversed
+     *        vector.
+     *
+     * \warning Attempting to access the element following the last element of a reversed
+     *          vector results in undefined behavior.
+     *
+     * \return An iterator to the element following the last element of the reversed
+     *         vector.
+     */
+    auto rend() const noexcept
+    {
+        return Const_Reverse_Iterator{ begin() };
+    }
+
+    /**
+     * \brief Get an iterator to the element following the last element of the reversed
+     *        vector.
+     *
+     * \warning Attempting to access the element following the last element of a reversed
+     *          vector results in undefined behavior.
+     *
+     * \return An iterator to the element following the last element of the reversed
+     *         vector.
+     */
+    auto crend() const noexcept
+    {
+        return Const_Reverse_Iterator{ cbegin() };
+    }
+
+    /**
+     * \brief Check if the vector is empty.
+     *
+     * \return true if the vector is empty.
+     * \return false if the vector is not empty.
+     */
+    [[nodiscard]] auto empty() const noexcept
+    {
+        return not size();
+    }
+
+    /**
+     * \brief Check if the vector is full.
+     *
+     * \return true if the vector is full.
+     * \return false if the vector is not full.
+     */
+    auto full() const noexcept
+    {
+        return size() == max_size();
+    }
+
+    /**
+     * \brief Get the number of elements in the vector.
+     *
+     * \return The number of elements in the vector.
+     */
+    auto size() const noexcept -> Size
+    {
+        return this->m_size;
+    }
+
+    /**
+     * \brief Get the maximum number of elements in the vector.
+     *
+     * \return The maximum number of elements in the vector.
+     */
+    static constexpr auto max_size() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get the maximum number of elements in the vector.
+     *
+     * \return The maximum number of elements in the vector.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Remove all elements from the vector.
+     */
+    void clear() noexcept
+    {
+        while ( not empty() ) {
+            pop_back();
+        } // while
+    }
+
+    /**
+     * \brief Append an element to the end of the vector.
+     *
+     * \warning Calling this function on a full vector results in undefined behavior.
+     *
+     * \param[in] value The element to append to the end of the vector.
+     */
+    void push_back( Const_Reference value ) noexcept
+    {
+        emplace_back( value );
+    }
+
+    /**
+     * \brief Append an element to the end of the vector.
+     *
+     * \warning Calling this function on a full vector results in undefined behavior.
+     *
+     * \param[in] value The element to append to the end of the vector.
+     */
+    void push_back( Value && value ) noexcept
+    {
+        emplace_back( std::move( value ) );
+    }
+
+    /**
+     * \brief Construct an element in place at the end of the vector.
+     *
+     * \tparam Arguments Element constructor argument types.
+     *
+     * \warning Calling this function on a full vector results in undefined behavior.
+     *
+     * \param[in] arguments Element constructor arguments.
+     *
+     * \return The constructed element.
+     */
+    template<typename... Arguments>
+    auto emplace_back( Arguments &&... arguments ) noexcept -> Reference
+    {
+        auto & element = *new ( &this->m_storage[ size() ] )
+                              Value( std::forward<Arguments>( arguments )... );
+
+        ++this->m_size;
+
+        return element;
+    }
+
+    /**
+     * \brief Remove the last element of the vector.
+     *
+     * \warning Calling this function on an empty vector results in undefined behavior.
+     */
+    void pop_back() noexcept
+    {
+        back().~Value();
+
+        --this->m_size;
+    }
+
+    /**
+     * \brief Change the number of elements in the vector.
+     *
+     * \warning If size is greater than N, the behavior is undefined.
+     *
+     * \param[in] size The new number of elements in the vector. If elements are added,
+     *            they are value-initialized.
+     */
+    void resize( Size size ) noexcept
+    {
+        while ( this->size() > size ) {
+            pop_back();
+        } // while
+
+        while ( this->size() < size ) {
+            emplace_back();
+        } // while
+    }
+
+    /**
+     * \brief Change the number of elements in the vector.
+     *
+     * \warning If size is greater than N, the behavior is undefined.
+     *
+     * \param[in] size The new number of elements in the vector.
+     * \param[in] value The value to initialize added elements with.
+     */
+    void resize( Size size, Const_Reference value ) noexcept
+    {
+        while ( this->size() > size ) {
+            pop_back();
+        } // while
+
+        while ( this->size() < size ) {
+            emplace_back( value );
+        } // while
+    }
+};
+
+/**
+ * \brief Equality operator.
+ *
+ * \relatedalso picolibrary::Fixed_Capacity_Vector
+ *
+ * \param[in] lhs The left hand side of the comparison.
+ * \param[in] rhs The right hand side of the comparison.
+ *
+ * \return true if lhs is equal to rhs.
+ * \return false if lhs is not equal to rhs.
+ */
+template<typename T, std::size_t N>
+auto operator==( Fixed_Capacity_Vector<T, N> const & lhs, Fixed_Capacity_Vector<T, N> const & rhs ) noexcept
+{
+    if ( lhs.size() != rhs.size() ) {
+        return false;
+    } // if
+
+    for ( auto position = std::size_t{}; position < lhs.size(); ++position ) {
+        if ( not( lhs[ position ] == rhs[ position ] ) ) {
+            return false;
+        } // if
+    }     // for
+
+    return true;
+}
+
+/**
+ * \brief Inequality operator.
+ *
+ * \relatedalso picolibrary::Fixed_Capacity_Vector
+ *
+ * \param[in] lhs The left hand side of the comparison.
+ * \param[in] rhs The right hand side of the comparison.
+ *
+ * \return true if lhs is not equal to rhs.
+ * \return false if lhs is equal to rhs.
+ */
+template<typename T, std::size_t N>
+auto operator!=( Fixed_Capacity_Vector<T, N> const & lhs, Fixed_Capacity_Vector<T, N> const & rhs ) noexcept
+{
+    return not( lhs == rhs );
+}
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_FIXED_CAPACITY_VECTOR_H
@@ -0,0 +1,321 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Fixed_Object_Pool interface.
+ */
+
+#ifndef PICOLIBRARY_FIXED_OBJECT_POOL_H
+#define PICOLIBRARY_FIXED_OBJECT_POOL_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace picolibrary {
+
+/**
+ * \brief Fixed size object pool.
+ *
+ * Objects are allocated from, and returned to, a fixed number of statically allocated
+ * slots in constant time using an intrusive free list. Allocated objects are owned by
+ * picolibrary::Fixed_Object_Pool::Handle objects that return the object to the pool when
+ * they are destroyed.
+ *
+ * The pool's constructor is constexpr, and initializes no slots, so a pool with static
+ * storage duration is constant initialized (zero-initialized storage).
+ *
+ * \tparam T The pool object type.
+ * \tparam N The number of objects in the pool.
+ *
+ * \attention Handles must not outlive the pool that they were allocated from.
+ */
+template<typename T, std::size_t N>
+class Fixed_Object_Pool {
+  public:
+    /**
+     * \brief The pool object type.
+     */
+    using Value = T;
+
+    /**
+     * \brief The number of objects in the pool.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief Pool object handle.
+     */
+    class Handle {
+      public:
+        /**
+         * \brief Constructor.
+         */
+        constexpr Handle() noexcept = default;
+
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] source The source of the move.
+         */
+        constexpr Handle( Handle && source ) noexcept :
+            m_pool{ source.m_pool },
+            m_value{ source.m_value }
+        {
+            source.m_pool  = nullptr;
+            source.m_value = nullptr;
+        }
+
+        Handle( Handle const & ) = delete;
+
+        /**
+         * \brief Destructor.
+         */
+        ~Handle() noexcept
+        {
+            reset();
+        }
+
+        /**
+         * \brief Assignment operator.
+         *
+         * \param[in] expression The expression to be assigned.
+         *
+         * \return The assigned to object.
+         */
+        auto operator=( Handle && expression ) noexcept -> Handle &
+        {
+            if ( &expression != this ) {
+                reset();
+
+                m_pool  = expression.m_pool;
+                m_value = expression.m_value;
+
+                expression.m_pool  = nullptr;
+                expression.m_value = nullptr;
+            } // if
+
+            return *this;
+        }
+
+        auto operator=( Handle const & ) = delete;
+
+        /**
+         * \brief Check if the handle owns an object.
+         *
+         * \return true if the handle owns an object.
+         * \return false if the handle does not own an object.
+         */
+        constexpr explicit operator bool() const noexcept
+        {
+            return m_value;
+        }
+
+        /**
+         * \brief Access the owned object.
+         *
+         * \return A pointer to the owned object, or a null pointer if the handle does not
+         *         own an object.
+         */
+        constexpr auto get() const noexcept -> Value *
+        {
+            return m_value;
+        }
+
+        /**
+         * \brief Access the owned object.
+         *
+         * \warning Calling this function on a handle that does not own an object results
+         *          in undefined behavior.
+         *
+         * \return The owned object.
+         */
+        constexpr auto operator*() const noexcept -> Value &
+        {
+            return *m_value;
+        }
+
+        /**
+         * \brief Access the owned object.
+         *
+         * \warning Calling this function on a handle that does not own an object results
+         *          in undefined behavior.
+         *
+         * \return A pointer to the owned object.
+         */
+        constexpr auto operator->() const noexcept -> Value *
+        {
+            return m_value;
+        }
+
+        /**
+         * \brief Destroy the owned object (if any), and return it to its pool.
+         */
+        void reset() noexcept
+        {
+            if ( m_value ) {
+                m_pool->deallocate( m_value );
+
+                m_pool  = nullptr;
+                m_value = nullptr;
+            } // if
+        }
+
+      private:
+        friend class Fixed_Object_Pool;
+
+        /**
+         * \brief The pool that the owned object was allocated from.
+         */
+        Fixed_Object_Pool * m_pool{};
+
+        /**
+         * \brief The owned object.
+         */
+        Value * m_value{};
+
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] pool The pool that the owned object was allocated from.
+         * \param[in] value The owned object.
+         */
+        constexpr Handle( Fixed_Object_Pool & pool, Value * value ) noexcept :
+            m_pool{ &pool },
+            m_value{ value }
+        {
+        }
+    };
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Fixed_Object_Pool() noexcept = default;
+
+    Fixed_Object_Pool( Fixed_Object_Pool && ) = delete;
+
+    Fixed_Object_Pool( Fixed_Object_Pool const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fixed_Object_Pool() noexcept = default;
+
+    auto operator=( Fixed_Object_Pool && ) = delete;
+
+    auto operator=( Fixed_Object_Pool const & ) = delete;
+
+    /**
+     * \brief Get the number of objects in the pool.
+     *
+     * \return The number of objects in the pool.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get the number of objects that are available for allocation.
+     *
+     * \return The number of objects that are available for allocation.
+     */
+    constexpr auto available() const noexcept -> Size
+    {
+        return N - m_allocated;
+    }
+
+    /**
+     * \brief Allocate and construct an object.
+     *
+     * \tparam Arguments Object constructor argument types.
+     *
+     * \param[in] arguments Object constructor arguments.
+     *
+     * \return A handle that owns the allocated object if an object was available.
+     * \return An empty handle if no objects were available.
+     */
+    template<typename... Arguments>
+    auto allocate( Arguments &&... arguments ) noexcept -> Handle
+    {
+        auto slot = m_free;
+
+        if ( slot ) {
+            m_free = *std::launder( reinterpret_cast<Slot **>( slot ) );
+        } else if ( m_unused < N ) {
+            slot = &m_slots[ m_unused++ ];
+        } else {
+            return {};
+        } // else
+
+        ++m_allocated;
+
+        return { *this, new ( slot ) Value( std::forward<Arguments>( arguments )... ) };
+    }
+
+  private:
+    /**
+     * \brief Object slot (either an object, or a pointer to the next free slot).
+     */
+    using Slot = std::aligned_storage_t<
+        ( sizeof( Value ) > sizeof( void * ) ? sizeof( Value ) : sizeof( void * ) ),
+        ( alignof( Value ) > alignof( void * ) ? alignof( Value ) : alignof( void * ) )>;
+
+    /**
+     * \brief The object slots.
+     */
+    Slot m_slots[ N ]{};
+
+    /**
+     * \brief The number of slots that have never been allocated.
+     */
+    Size m_unused{};
+
+    /**
+     * \brief The first free slot.
+     */
+    Slot * m_free{};
+
+    /**
+     * \brief The number of allocated objects.
+     */
+    Size m_allocated{};
+
+    /**
+     * \brief Destroy an object, and return it to the pool.
+     *
+     * \param[in] value The object to destroy and return to the pool.
+     */
+    void deallocate( Value * value ) noexcept
+    {
+        value->~Value();
+
+        auto const slot = static_cast<Slot *>( static_cast<void *>( value ) );
+
+        new ( slot ) Slot *{ m_free };
+
+        m_free = slot;
+
+        --m_allocated;
+    }
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_FIXED_OBJECT_POOL_H
@@ -0,0 +1,807 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Fixed_Size_Bitset interface.
+ */
+
+#ifndef PICOLIBRARY_FIXED_SIZE_BITSET_H
+#define PICOLIBRARY_FIXED_SIZE_BITSET_H
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/iterator.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Fixed size bitset.
+ *
+ * The bits are stored in an array of words, and bulk operations operate on a word at a
+ * time. Bits beyond N in the last word are always clear.
+ *
+ * \tparam N The number of bits in the bitset.
+ * \tparam Word The unsigned integer type used to store the bits (defaults to the target's
+ *         natural word size).
+ */
+template<std::size_t N, typename Word = unsigned int>
+class Fixed_Size_Bitset {
+  public:
+    static_assert( N );
+
+    static_assert( std::is_unsigned_v<Word> );
+
+    /**
+     * \brief The number of bits in the bitset.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief A bit position.
+     */
+    using Position = std::size_t;
+
+    /**
+     * \brief The number of bits in a word.
+     */
+    static constexpr auto WORD_BITS = Size{ std::numeric_limits<Word>::digits };
+
+    /**
+     * \brief The number of words used to store the bits.
+     */
+    static constexpr auto WORDS = Size{ ( N + WORD_BITS - 1 ) / WORD_BITS };
+
+    /**
+     * \brief Set bit iterator.
+     */
+    class Set_Bit_Iterator {
+      public:
+        /**
+         * \brief Type that can be used to identify the distance between two iterators.
+         */
+        using Difference = std::ptrdiff_t;
+
+        /**
+         * \brief The iterated over type (the position of a set bit).
+         */
+        using Value = Position;
+
+        /**
+         * \brief Pointer to the iterated over type.
+         */
+        using Pointer = Value const *;
+
+        /**
+         * \brief Reference to the iterated over type.
+         */
+        using Reference = Value;
+
+        /**
+         * \brief Iterator category tag.
+         */
+        using Iterator_Category = Forward_Iterator_Tag;
+
+        /**
+         * \brief Constructor.
+         */
+        constexpr Set_Bit_Iterator() noexcept = default;
+
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] words The bitset's words.
+         * \param[in] word The position of the word to start searching for set bits in.
+         */
+        constexpr Set_Bit_Iterator( Word const * words, Size word ) noexcept :
+            m_words{ words },
+            m_word{ word }
+        {
+            advance();
+        }
+
+        /**
+         * \brief Get the position of the set bit the iterator refers to.
+         *
+         * \return The position of the set bit the iterator refers to.
+         */
+        constexpr auto operator*() const noexcept -> Reference
+        {
+            return m_word * WORD_BITS + countr_zero( m_remaining );
+        }
+
+        /**
+         * \brief Advance the iterator to the next set bit.
+         *
+         * \return The advanced iterator.
+         */
+        constexpr auto & operator++() noexcept
+        {
+            m_remaining = static_cast<Word>( m_remaining & ( m_remaining - 1 ) );
+
+            if ( not m_remaining ) {
+                ++m_word;
+                advance();
+            } // if
+
+            return *this;
+        }
+
+        /**
+         * \brief Advance the iterator to the next set bit.
+         *
+         * \return The iterator before it was advanced.
+         */
+        constexpr auto operator++( int ) noexcept
+        {
+            auto const iterator = *this;
+
+            ++( *this );
+
+            return iterator;
+        }
+
+        /**
+         * \brief Equality operator.
+         *
+         * \param[in] rhs The right hand side of the comparison.
+         *
+         * \return true if the iterators refer to the same set bit.
+         * \return false if the iterators do not refer to the same set bit.
+         */
+        constexpr auto operator==( Set_Bit_Iterator const & rhs ) const noexcept
+        {
+            return m_word == rhs.m_word and m_remaining == rhs.m_remaining;
+        }
+
+        /**
+         * \brief Inequality operator.
+         *
+         * \param[in] rhs The right hand side of the comparison.
+         *
+         * \return true if the iterators do not refer to the same set bit.
+         * \return false if the iterators refer to the same set bit.
+         */
+        constexpr auto operator!=( Set_Bit_Iterator const & rhs ) const noexcept
+        {
+            return not( *this == rhs );
+        }
+
+      private:
+        /**
+         * \brief The bitset's words.
+         */
+        Word const * m_words{};
+
+        /**
+         * \brief The position of the word that contains the set bit the iterator refers
+         *        to.
+         */
+        Size m_word{ WORDS };
+
+        /**
+         * \brief The set bits in the word that have not been iterated over.
+         */
+        Word m_remaining{};
+
+        /**
+         * \brief Find the next word, starting with the current word, that contains a set
+         *        bit.
+         */
+        constexpr void advance() noexcept
+        {
+            for ( ; m_word < WORDS; ++m_word ) {
+                m_remaining = m_words[ m_word ];
+
+                if ( m_remaining ) {
+                    return;
+                } // if
+            }     // for
+
+            m_remaining = 0;
+        }
+    };
+
+    /**
+     * \brief Range of the positions of the set bits in a bitset.
+     */
+    class Set_Bits {
+      public:
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] words The bitset's words.
+         */
+        constexpr explicit Set_Bits( Word const * words ) noexcept : m_words{ words }
+        {
+        }
+
+        /**
+         * \brief Get an iterator to the position of the first set bit.
+         *
+         * \return An iterator to the position of the first set bit.
+         */
+        constexpr auto begin() const noexcept
+        {
+            return Set_Bit_Iterator{ m_words, 0 };
+        }
+
+        /**
+         * \brief Get an iterator to the position following the position of the last set
+         *        bit.
+         *
+         * \return An iterator to the position following the position of the last set
+         *         bit.
+         */
+        constexpr auto end() const noexcept
+        {
+            return Set_Bit_Iterator{};
+        }
+
+      private:
+        /**
+         * \brief The bitset's words.
+         */
+        Word const * m_words{};
+    };
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Fixed_Size_Bitset() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \tparam Integer The type of integer to initialize the bitset with.
+     *
+     * \param[in] value The integer to initialize the bitset with (e.g. an 8-bit
+     *            register mask). Bit n of the bitset is initialized to bit n of value.
+     *            Bits of value beyond N are discarded.
+     */
+    template<typename Integer, typename = std::enable_if_t<std::is_unsigned_v<Integer>>>
+    constexpr explicit Fixed_Size_Bitset( Integer value ) noexcept
+    {
+        for ( auto word = Size{}; word < WORDS and value; ++word ) {
+            m_words[ word ] = static_cast<Word>( value );
+
+            if constexpr ( std::numeric_limits<Integer>::digits > WORD_BITS ) {
+                value >>= WORD_BITS;
+            } else {
+                value = 0;
+            } // else
+        }     // for
+
+        clear_unused_bits();
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Fixed_Size_Bitset( Fixed_Size_Bitset && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Fixed_Size_Bitset( Fixed_Size_Bitset const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fixed_Size_Bitset() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Fixed_Size_Bitset && expression ) noexcept
+        -> Fixed_Size_Bitset & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Fixed_Size_Bitset const & expression ) noexcept
+        -> Fixed_Size_Bitset & = default;
+
+    /**
+     * \brief Get the number of bits in the bitset.
+     *
+     * \return The number of bits in the bitset.
+     */
+    static constexpr auto size() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Get the value of a bit.
+     *
+     * \warning Bounds checking is not performed.
+     *
+     * \param[in] position The position of the bit to get.
+     *
+     * \return The value of the bit.
+     */
+    constexpr auto test( Position position ) const noexcept -> bool
+    {
+        return m_words[ position / WORD_BITS ] & bit( position );
+    }
+
+    /**
+     * \brief Get the value of a bit.
+     *
+     * \warning Bounds checking is not performed.
+     *
+     * \param[in] position The position of the bit to get.
+     *
+     * \return The value of the bit.
+     */
+    constexpr auto operator[]( Position position ) const noexcept -> bool
+    {
+        return test( position );
+    }
+
+    /**
+     * \brief Check if all bits are set.
+     *
+     * \return true if all bits are set.
+     * \return false if not all bits are set.
+     */
+    constexpr auto all() const noexcept -> bool
+    {
+        for ( auto word = Size{}; word + 1 < WORDS; ++word ) {
+            if ( m_words[ word ] != static_cast<Word>( ~Word{} ) ) {
+                return false;
+            } // if
+        }     // for
+
+        return m_words[ WORDS - 1 ] == LAST_WORD_MASK;
+    }
+
+    /**
+     * \brief Check if any bits are set.
+     *
+     * \return true if any bits are set.
+     * \return false if no bits are set.
+     */
+    constexpr auto any() const noexcept -> bool
+    {
+        for ( auto const word : m_words ) {
+            if ( word ) {
+                return true;
+            } // if
+        }     // for
+
+        return false;
+    }
+
+    /**
+     * \brief Check if no bits are set.
+     *
+     * \return true if no bits are set.
+     * \return false if any bits are set.
+     */
+    constexpr auto none() const noexcept -> bool
+    {
+        return not any();
+    }
+
+    /**
+     * \brief Get the number of bits that are set.
+     *
+     * \return The number of bits that are set.
+     */
+    constexpr auto count() const noexcept -> Size
+    {
+        auto count = Size{};
+
+        for ( auto const word : m_words ) {
+            count += popcount( word );
+        } // for
+
+        return count;
+    }
+
+    /**
+     * \brief Set all bits.
+     *
+     * \return The bitset.
+     */
+    constexpr auto set() noexcept -> Fixed_Size_Bitset &
+    {
+        for ( auto & word : m_words ) {
+            word = static_cast<Word>( ~Word{} );
+        } // for
+
+        clear_unused_bits();
+
+        return *this;
+    }
+
+    /**
+     * \brief Set or clear a bit.
+     *
+     * \warning Bounds checking is not performed.
+     *
+     * \param[in] position The position of the bit to set or clear.
+     * \param[in] value The value to set the bit to.
+     *
+     * \return The bitset.
+     */
+    constexpr auto set( Position position, bool value = true ) noexcept
+        -> Fixed_Size_Bitset &
+    {
+        auto & word = m_words[ position / WORD_BITS ];
+
+        word = value ? static_cast<Word>( word | bit( position ) )
+                     : static_cast<Word>( word & static_cast<Word>( ~bit( position ) ) );
+
+        return *this;
+    }
+
+    /**
+     * \brief Clear all bits.
+     *
+     * \return The bitset.
+     */
+    constexpr auto reset() noexcept -> Fixed_Size_Bitset &
+    {
+        for ( auto & word : m_words ) {
+            word = 0;
+        } // for
+
+        return *this;
+    }
+
+    /**
+     * \brief Clear a bit.
+     *
+     * \warning Bounds checking is not performed.
+     *
+     * \param[in] position The position of the bit to clear.
+     *
+     * \return The bitset.
+     */
+    constexpr auto reset( Position position ) noexcept -> Fixed_Size_Bitset &
+    {
+        return set( position, false );
+    }
+
+    /**
+     * \brief Toggle all bits.
+     *
+     * \return The bitset.
+     */
+    constexpr auto flip() noexcept -> Fixed_Size_Bitset &
+    {
+        for ( auto & word : m_words ) {
+            word = static_cast<Word>( ~word );
+        } // for
+
+        clear_unused_bits();
+
+        return *this;
+    }
+
+    /**
+     * \brief Toggle a bit.
+     *
+     * \warning Bounds checking is not performed.
+     *
+     * \param[in] position The position of the bit to toggle.
+     *
+     * \return The bitset.
+     */
+    constexpr auto flip( Position position ) noexcept -> Fixed_Size_Bitset &
+    {
+        auto & word = m_words[ position / WORD_BITS ];
+
+        word = static_cast<Word>( word ^ bit( position ) );
+
+        return *this;
+    }
+
+    /**
+     * \brief Get the positions of the set bits.
+     *
+     * \attention The range is invalidated if the bitset is modified or destroyed.
+     *
+     * \return A range of the positions of the set bits, in ascending order.
+     */
+    constexpr auto set_bits() const noexcept
+    {
+        return Set_Bits{ m_words };
+    }
+
+    /**
+     * \brief Get the position of the first set bit.
+     *
+     * \return The position of the first set bit if any bits are set.
+     * \return size() if no bits are set.
+     */
+    constexpr auto find_first() const noexcept -> Position
+    {
+        auto const set_bits = this->set_bits();
+        auto const first    = set_bits.begin();
+
+        return first != set_bits.end() ? *first : N;
+    }
+
+    /**
+     * \brief Get the position of the first set bit following a position.
+     *
+     * \param[in] position The position to start searching after.
+     *
+     * \return The position of the first set bit following position if there is one.
+     * \return size() if there are no set bits following position.
+     */
+    constexpr auto find_next( Position position ) const noexcept -> Position
+    {
+        ++position;
+
+        if ( position >= N ) {
+            return N;
+        } // if
+
+        auto const word      = position / WORD_BITS;
+        auto const remaining = static_cast<Word>(
+            m_words[ word ]
+            & static_cast<Word>(
+                static_cast<Word>( ~Word{} ) << ( position % WORD_BITS ) ) );
+
+        if ( remaining ) {
+            return word * WORD_BITS + countr_zero( remaining );
+        } // if
+
+        auto const next = Set_Bit_Iterator{ m_words, word + 1 };
+
+        return next != Set_Bit_Iterator{} ? *next : N;
+    }
+
+    /**
+     * \brief Convert the bitset to an integer.
+     *
+     * \tparam Integer The type of integer to convert the bitset to.
+     *
+     * \return An integer whose bit n is bit n of the bitset (e.g. an 8-bit register
+     *         mask). Bits of the bitset beyond the width of Integer are discarded.
+     */
+    template<typename Integer>
+    constexpr auto to_integer() const noexcept -> Integer
+    {
+        static_assert( std::is_unsigned_v<Integer> );
+
+        auto value = Integer{};
+
+        for ( auto word = Size{};
+              word < WORDS and word * WORD_BITS < std::numeric_limits<Integer>::digits;
+              ++word ) {
+            value = static_cast<Integer>(
+                value
+                | static_cast<Integer>(
+                    static_cast<Integer>( m_words[ word ] ) << ( word * WORD_BITS ) ) );
+        } // for
+
+        return value;
+    }
+
+    /**
+     * \brief Access the words used to store the bits.
+     *
+     * \return The words used to store the bits (bit n of the bitset is bit n % WORD_BITS
+     *         of word n / WORD_BITS).
+     */
+    constexpr auto words() const noexcept -> Word const *
+    {
+        return m_words;
+    }
+
+    /**
+     * \brief Bitwise AND assignment operator.
+     *
+     * \param[in] expression The expression to be ANDed with the bitset.
+     *
+     * \return The bitset.
+     */
+    constexpr auto operator&=( Fixed_Size_Bitset const & expression ) noexcept
+        -> Fixed_Size_Bitset &
+    {
+        for ( auto word = Size{}; word < WORDS; ++word ) {
+            m_words[ word ] &= expression.m_words[ word ];
+        } // for
+
+        return *this;
+    }
+
+    /**
+     * \brief Bitwise OR assignment operator.
+     *
+     * \param[in] expression The expression to be ORed with the bitset.
+     *
+     * \return The bitset.
+     */
+    constexpr auto operator|=( Fixed_Size_Bitset const & expression ) noexcept
+        -> Fixed_Size_Bitset &
+    {
+        for ( auto word = Size{}; word < WORDS; ++word ) {
+            m_words[ word ] |= expression.m_words[ word ];
+        } // for
+
+        return *this;
+    }
+
+    /**
+     * \brief Bitwise XOR assignment operator.
+     *
+     * \param[in] expression The expression to be XORed with the bitset.
+     *
+     * \return The bitset.
+     */
+    constexpr auto operator^=( Fixed_Size_Bitset const & expression ) noexcept
+        -> Fixed_Size_Bitset &
+    {
+        for ( auto word = Size{}; word < WORDS; ++word ) {
+            m_words[ word ] ^= expression.m_words[ word ];
+        } // for
+
+        return *this;
+    }
+
+    /**
+     * \brief Bitwise NOT operator.
+     *
+     * \return A copy of the bitset with all bits toggled.
+     */
+    constexpr auto operator~() const noexcept
+    {
+        return Fixed_Size_Bitset{ *this }.flip();
+    }
+
+    /**
+     * \brief Equality operator.
+     *
+     * \param[in] rhs The right hand side of the comparison.
+     *
+     * \return true if the bitsets are equal.
+     * \return false if the bitsets are not equal.
+     */
+    constexpr auto operator==( Fixed_Size_Bitset const & rhs ) const noexcept
+    {
+        for ( auto word = Size{}; word < WORDS; ++word ) {
+            if ( m_words[ word ] != rhs.m_words[ word ] ) {
+                return false;
+            } // if
+        }     // for
+
+        return true;
+    }
+
+    /**
+     * \brief Inequality operator.
+     *
+     * \param[in] rhs The right hand side of the comparison.
+     *
+     * \return true if the bitsets are not equal.
+     * \return false if the bitsets are equal.
+     */
+    constexpr auto operator!=( Fixed_Size_Bitset const & rhs ) const noexcept
+    {
+        return not( *this == rhs );
+    }
+
+  private:
+    /**
+     * \brief The mask identifying the used bits in the last word.
+     */
+    static constexpr auto LAST_WORD_MASK = bit_field_mask<Word>(
+        static_cast<std::uint_fast8_t>( N - ( WORDS - 1 ) * WORD_BITS ),
+        0 );
+
+    /**
+     * \brief The words used to store the bits.
+     */
+    Word m_words[ WORDS ]{};
+
+    /**
+     * \brief Get the mask identifying a bit within its word.
+     *
+     * \param[in] position The position of the bit.
+     *
+     * \return The mask identifying the bit within its word.
+     */
+    static constexpr auto bit( Position position ) noexcept -> Word
+    {
+        return static_cast<Word>( Word{ 1 } << ( position % WORD_BITS ) );
+    }
+
+    /**
+     * \brief Clear the bits beyond N in the last word.
+     */
+    constexpr void clear_unused_bits() noexcept
+    {
+        m_words[ WORDS - 1 ] &= LAST_WORD_MASK;
+    }
+};
+
+/**
+ * \brief Bitwise AND operator.
+ *
+ * \relatedalso picolibrary::Fixed_Size_Bitset
+ *
+ * \param[in] lhs The left hand side of the operation.
+ * \param[in] rhs The right hand side of the operation.
+ *
+ * \return lhs ANDed with rhs.
+ */
+template<std::size_t N, typename Word>
+constexpr auto operator&( Fixed_Size_Bitset<N, Word> lhs,
+                          Fixed_Size_Bitset<N, Word> const & rhs ) noexcept
+{
+    return lhs &= rhs;
+}
+
+/**
+ * \brief Bitwise OR operator.
+ *
+ * \relatedalso picolibrary::Fixed_Size_Bitset
+ *
+ * \param[in] lhs The left hand side of the operation.
+ * \param[in] rhs The right hand side of the operation.
+ *
+ * \return lhs ORed with rhs.
+ */
+template<std::size_t N, typename Word>
+constexpr auto operator|( Fixed_Size_Bitset<N, Word> lhs,
+                          Fixed_Size_Bitset<N, Word> const & rhs ) noexcept
+{
+    return lhs |= rhs;
+}
+
+/**
+ * \brief Bitwise XOR operator.
+ *
+ * \relatedalso picolibrary::Fixed_Size_Bitset
+ *
+ * \param[in] lhs The left hand side of the operation.
+ * \param[in] rhs The right hand side of the operation.
+ *
+ * \return lhs XORed with rhs.
+ */
+template<std::size_t N, typename Word>
+constexpr auto operator^( Fixed_Size_Bitset<N, Word> lhs,
+                          Fixed_Size_Bitset<N, Word> const & rhs ) noexcept
+{
+    return lhs ^= rhs;
+}
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_FIXED_SIZE_BITSET_H
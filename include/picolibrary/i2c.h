@@ -29,6 +29,8 @@
 #include "picolibrary/algorithm.h"
 #include "picolibrary/error.h"
 #include "picolibrary/result.h"
+#include "picolibrary/span.h"
+#include "picolibrary/trace.h"
 #include "picolibrary/void.h"
 
 /**
@@ -647,6 +649,20 @@ class Controller : public Basic_Controller {
         } );
     }
 
+    /**
+     * \brief Read a block of data from a device.
+     *
+     * \param[out] data The block of read data.
+     * \param[in] response The response to send after the last byte of the block is read.
+     *
+     * \return Nothing if the read succeeded.
+     * \return An error code if the read failed.
+     */
+    auto read( Span<std::uint8_t> data, Response response ) noexcept
+    {
+        return read( data.begin(), data.end(), response );
+    }
+
     using Basic_Controller::write;
 
     /**
@@ -667,6 +683,23 @@ class Controller : public Basic_Controller {
         return for_each<Discard_Functor>(
             begin, end, [ this ]( auto data ) noexcept { return write( data ); } );
     }
+
+    /**
+     * \brief Write a block of data to a device.
+     *
+     * \param[in] data The block of data to write.
+     *
+     * \return Nothing if the write succeeded.
+     * \return picolibrary::Generic_Error::ARBITRATION_LOST if the controller lost
+     *         arbitration during the write.
+     * \return picolibrary::Generic_Error::NONRESPONSIVE_DEVICE if the device did not
+     *         acknowledge the write.
+     * \return An error code if the write failed for any other reason.
+     */
+    auto write( Byte_View data ) noexcept
+    {
+        return write( data.begin(), data.end() );
+    }
 };
 
 /**
@@ -736,7 +769,7 @@ class Bus_Control_Guard {
      *
      * \return The assigned to object.
      */
-    constexpr auto & operator=( Bus_Control_Guard && expression ) noexcept
+    auto & operator=( Bus_Control_Guard && expression ) noexcept
     {
         if ( &expression != this ) {
             stop();
@@ -779,18 +812,21 @@ class Bus_Control_Guard {
      *
      * \param[in] controller The I2C controller used to interact with the bus.
      */
-    constexpr Bus_Control_Guard( Controller & controller ) noexcept :
+    Bus_Control_Guard( Controller & controller ) noexcept :
         m_controller{ &controller }
     {
+        PICOLIBRARY_TRACE_BEGIN( "I2C::Bus_Control_Guard" );
     }
 
     /**
      * \brief Transmit a stop condition.
      */
-    constexpr void stop() noexcept
+    void stop() noexcept
     {
         if ( m_controller ) {
             static_cast<void>( m_controller->stop() );
+
+            PICOLIBRARY_TRACE_END( "I2C::Bus_Control_Guard" );
         } // if
     }
 };
@@ -799,12 +835,9 @@ template<typename Controller>
 auto make_bus_control_guard( Controller & controller ) noexcept
     -> Result<Bus_Control_Guard<Controller>, typename decltype( std::declval<Controller>().start() )::Error, false>
 {
-    auto result = controller.start();
-    if ( result.is_error() ) {
-        return result.error();
-    } // if
-
-    return Bus_Control_Guard{ controller };
+    return map( controller.start(), [ &controller ]() noexcept {
+        return Bus_Control_Guard{ controller };
+    } );
 }
 
 /**
@@ -827,31 +860,21 @@ template<typename Controller>
 auto ping( Controller & controller, Address address, Operation operation ) noexcept
     -> Result<Void, Error_Code>
 {
-    auto guard = Bus_Control_Guard<Controller>{};
-    {
-        auto result = make_bus_control_guard( controller );
-        if ( result.is_error() ) {
-            return result.error();
-        } // if
-
-        guard = std::move( result ).value();
-    }
-
-    {
-        auto result = controller.address( address, operation );
-        if ( result.is_error() ) {
-            return result.error();
-        } // if
-    }
-
-    if ( operation == Operation::READ ) {
-        auto result = controller.read( Response::NACK );
-        if ( result.is_error() ) {
-            return result.error();
-        } // if
-    }     // if
+    return and_then( make_bus_control_guard( controller ), [ &controller, address, operation ]( auto guard ) noexcept {
+        static_cast<void>( guard );
+
+        return sequence(
+            [ &controller, address, operation ]() noexcept {
+                return controller.address( address, operation );
+            },
+            [ &controller, operation ]() noexcept -> Result<Void, Error_Code> {
+                if ( operation == Operation::READ ) {
+                    return map( controller.read( Response::NACK ), []( auto ) noexcept {} );
+                } // if
 
-    return {};
+                return {};
+            } );
+    } );
 }
 
 /**
@@ -980,25 +1003,9 @@ class Device<Bus_Multiplexer_Aligner, Controller, std::uint8_t> {
      */
     auto ping( Operation operation ) const noexcept -> Result<Void, Error_Code>
     {
-        {
-            auto result = m_align_bus_multiplexer();
-            if ( result.is_error() ) {
-                return result.error();
-            } // if
-        }
-
-        {
-            auto result = I2C::ping( *m_controller, m_address, operation );
-            if ( result.is_error() ) {
-                if ( result.error() == Generic_Error::NONRESPONSIVE_DEVICE ) {
-                    return m_nonresponsive_device_error;
-                } // if
-
-                return result.error();
-            } // if
-        }
-
-        return {};
+        return and_then( m_align_bus_multiplexer(), [ this, operation ]() noexcept {
+            return map_nonresponsive_device_error( I2C::ping( *m_controller, m_address, operation ) );
+        } );
     }
 
     /**
@@ -1014,19 +1021,9 @@ class Device<Bus_Multiplexer_Aligner, Controller, std::uint8_t> {
      */
     auto ping() const noexcept -> Result<Void, Error_Code>
     {
-        Operation const operations[]{
-            Operation::READ,
-            Operation::WRITE,
-        };
-
-        for ( auto const operation : operations ) {
-            auto result = ping( operation );
-            if ( result.is_error() ) {
-                return result.error();
-            } // if
-        }     // for
-
-        return {};
+        return sequence(
+            [ this ]() noexcept { return ping( Operation::READ ); },
+            [ this ]() noexcept { return ping( Operation::WRITE ); } );
     }
 
   protected:
@@ -1140,66 +1137,17 @@ class Device<Bus_Multiplexer_Aligner, Controller, std::uint8_t> {
      */
     auto read( std::uint8_t register_address ) const noexcept -> Result<std::uint8_t, Error_Code>
     {
-        {
-            auto result = m_align_bus_multiplexer();
-            if ( result.is_error() ) {
-                return result.error();
-            } // if
-        }
-
-        auto guard = Bus_Control_Guard<Controller>{};
-        {
-            auto result = make_bus_control_guard( *m_controller );
-            if ( result.is_error() ) {
-                return result.error();
-            } // if
-
-            guard = std::move( result ).value();
-        }
-
-        {
-            auto result = m_controller->address( m_address, Operation::WRITE );
-            if ( result.is_error() ) {
-                if ( result.error() == Generic_Error::NONRESPONSIVE_DEVICE ) {
-                    return m_nonresponsive_device_error;
-                } // if
-
-                return result.error();
-            } // if
-        }
-
-        {
-            auto result = m_controller->write( register_address );
-            if ( result.is_error() ) {
-                if ( result.error() == Generic_Error::NONRESPONSIVE_DEVICE ) {
-                    return m_nonresponsive_device_error;
-                } // if
-
-                return result.error();
-            } // if
-        }
-
-        {
-            auto result = guard.repeated_start();
-            if ( result.is_error() ) {
-                return result.error();
-            } // if
-        }
-
-        {
-            auto result = m_controller->address( m_address, Operation::READ );
-            if ( result.is_error() ) {
-                if ( result.error() == Generic_Error::NONRESPONSIVE_DEVICE ) {
-                    return m_nonresponsive_device_error;
-                } // if
-
-                return result.error();
-            } // if
-        }
-
-        {
-            return m_controller->read( Response::NACK );
-        }
+        PICOLIBRARY_TRACE_SCOPE( "I2C::Device::read" );
+
+        return communicate( [ this, register_address ]( auto & guard ) noexcept {
+            return sequence(
+                [ this, register_address ]() noexcept {
+                    return select_register( register_address );
+                },
+                [ &guard ]() noexcept { return guard.repeated_start(); },
+                [ this ]() noexcept { return address_device( Operation::READ ); },
+                [ this ]() noexcept { return m_controller->read( Response::NACK ); } );
+        } );
     }
 
     /**
@@ -1225,66 +1173,44 @@ class Device<Bus_Multiplexer_Aligner, Controller, std::uint8_t> {
     auto read( std::uint8_t register_address, std::uint8_t * begin, std::uint8_t * end ) const noexcept
         -> Result<Void, Error_Code>
     {
-        {
-            auto result = m_align_bus_multiplexer();
-            if ( result.is_error() ) {
-                return result.error();
-            } // if
-        }
-
-        auto guard = Bus_Control_Guard<Controller>{};
-        {
-            auto result = make_bus_control_guard( *m_controller );
-            if ( result.is_error() ) {
-                return result.error();
-            } // if
-
-            guard = std::move( result ).value();
-        }
-
-        {
-            auto result = m_controller->address( m_address, Operation::WRITE );
-            if ( result.is_error() ) {
-                if ( result.error() == Generic_Error::NONRESPONSIVE_DEVICE ) {
-                    return m_nonresponsive_device_error;
-                } // if
-
-                return result.error();
-            } // if
-        }
-
-        {
-            auto result = m_controller->write( register_address );
-            if ( result.is_error() ) {
-                if ( result.error() == Generic_Error::NONRESPONSIVE_DEVICE ) {
-                    return m_nonresponsive_device_error;
-                } // if
-
-                return result.error();
-            } // if
-        }
-
-        {
-            auto result = guard.repeated_start();
-            if ( result.is_error() ) {
-                return result.error();
-            } // if
-        }
-
-        {
-            auto result = m_controller->address( m_address, Operation::READ );
-            if ( result.is_error() ) {
-                if ( result.error() == Generic_Error::NONRESPONSIVE_DEVICE ) {
-                    return m_nonresponsive_device_error;
-                } // if
-
-                return result.error();
-            } // if
-        }
+        PICOLIBRARY_TRACE_SCOPE( "I2C::Device::read" );
+
+        return communicate( [ this, register_address, begin, end ]( auto & guard ) noexcept {
+            return sequence(
+                [ this, register_address ]() noexcept {
+                    return select_register( register_address );
+                },
+                [ &guard ]() noexcept { return guard.repeated_start(); },
+                [ this ]() noexcept { return address_device( Operation::READ ); },
+                [ this, begin, end ]() noexcept {
+                    return m_controller->read( begin, end, Response::NACK );
+                } );
+        } );
+    }
 
-        {
-            return m_controller->read( begin, end, Response::NACK );
-        }
+    /**
+     * \brief Read a block of registers.
+     *
+     * \param[in] register_address The address of the block of registers to read.
+     * \param[out] data The data read from the block of registers.
+     *
+     * \warning This function does not verify that the register block size is non-zero. If
+     *          the register block size is zero, a NACK terminated read will never be
+     *          performed which results in the device retaining control of the SDA signal,
+     *          locking up the bus.
+     *
+     * \return Nothing if the read succeeded.
+     * \return picolibrary::I2C::Device<Bus_Multiplexer_Aligner, Controller,
+     *         std::uint8_t>::nonresponsive_device_error() if the device is not
+     *         responsive.
+     * \return picolibrary::Generic_Error::ARBITRATION_LOST if the controller lost
+     *         arbitration while attempting to communicate with the device.
+     * \return An error code if the read failed for any other reason.
+     */
+    auto read( std::uint8_t register_address, Span<std::uint8_t> data ) const noexcept
+        -> Result<Void, Error_Code>
+    {
+        return read( register_address, data.begin(), data.end() );
     }
 
     /**
@@ -1303,57 +1229,17 @@ class Device<Bus_Multiplexer_Aligner, Controller, std::uint8_t> {
      */
     auto write( std::uint8_t register_address, std::uint8_t data ) noexcept -> Result<Void, Error_Code>
     {
-        {
-            auto result = m_align_bus_multiplexer();
-            if ( result.is_error() ) {
-                return result.error();
-            } // if
-        }
-
-        auto guard = Bus_Control_Guard<Controller>{};
-        {
-            auto result = make_bus_control_guard( *m_controller );
-            if ( result.is_error() ) {
-                return result.error();
-            } // if
-
-            guard = std::move( result ).value();
-        }
-
-        {
-            auto result = m_controller->address( m_address, Operation::WRITE );
-            if ( result.is_error() ) {
-                if ( result.error() == Generic_Error::NONRESPONSIVE_DEVICE ) {
-                    return m_nonresponsive_device_error;
-                } // if
-
-                return result.error();
-            } // if
-        }
-
-        {
-            auto result = m_controller->write( register_address );
-            if ( result.is_error() ) {
-                if ( result.error() == Generic_Error::NONRESPONSIVE_DEVICE ) {
-                    return m_nonresponsive_device_error;
-                } // if
-
-                return result.error();
-            } // if
-        }
-
-        {
-            auto result = m_controller->write( data );
-            if ( result.is_error() ) {
-                if ( result.error() == Generic_Error::NONRESPONSIVE_DEVICE ) {
-                    return m_nonresponsive_device_error;
-                } // if
-
-                return result.error();
-            } // if
-        }
-
-        return {};
+        PICOLIBRARY_TRACE_SCOPE( "I2C::Device::write" );
+
+        return communicate( [ this, register_address, data ]( auto & ) noexcept {
+            return sequence(
+                [ this, register_address ]() noexcept {
+                    return select_register( register_address );
+                },
+                [ this, data ]() noexcept {
+                    return map_nonresponsive_device_error( m_controller->write( data ) );
+                } );
+        } );
     }
 
     /**
@@ -1374,57 +1260,36 @@ class Device<Bus_Multiplexer_Aligner, Controller, std::uint8_t> {
     auto write( std::uint8_t register_address, std::uint8_t const * begin, std::uint8_t const * end ) noexcept
         -> Result<Void, Error_Code>
     {
-        {
-            auto result = m_align_bus_multiplexer();
-            if ( result.is_error() ) {
-                return result.error();
-            } // if
-        }
-
-        auto guard = Bus_Control_Guard<Controller>{};
-        {
-            auto result = make_bus_control_guard( *m_controller );
-            if ( result.is_error() ) {
-                return result.error();
-            } // if
-
-            guard = std::move( result ).value();
-        }
-
-        {
-            auto result = m_controller->address( m_address, Operation::WRITE );
-            if ( result.is_error() ) {
-                if ( result.error() == Generic_Error::NONRESPONSIVE_DEVICE ) {
-                    return m_nonresponsive_device_error;
-                } // if
-
-                return result.error();
-            } // if
-        }
-
-        {
-            auto result = m_controller->write( register_address );
-            if ( result.is_error() ) {
-                if ( result.error() == Generic_Error::NONRESPONSIVE_DEVICE ) {
-                    return m_nonresponsive_device_error;
-                } // if
-
-                return result.error();
-            } // if
-        }
-
-        {
-            auto result = m_controller->write( begin, end );
-            if ( result.is_error() ) {
-                if ( result.error() == Generic_Error::NONRESPONSIVE_DEVICE ) {
-                    return m_nonresponsive_device_error;
-                } // if
-
-                return result.error();
-            } // if
-        }
+        PICOLIBRARY_TRACE_SCOPE( "I2C::Device::write" );
+
+        return communicate( [ this, register_address, begin, end ]( auto & ) noexcept {
+            return sequence(
+                [ this, register_address ]() noexcept {
+                    return select_register( register_address );
+                },
+                [ this, begin, end ]() noexcept {
+                    return map_nonresponsive_device_error( m_controller->write( begin, end ) );
+                } );
+        } );
+    }
 
-        return {};
+    /**
+     * \brief Write to a block of registers.
+     *
+     * \param[in] register_address The address of the block of registers to write to.
+     * \param[in] data The data to write to the block of registers.
+     *
+     * \return Nothing if the write succeeded.
+     * \return picolibrary::I2C::Device<Bus_Multiplexer_Aligner, Controller,
+     *         std::uint8_t>::nonresponsive_device_error() if the device is not
+     *         responsive.
+     * \return picolibrary::Generic_Error::ARBITRATION_LOST if the controller lost
+     *         arbitration while attempting to communicate with the device.
+     * \return An error code if the read failed for any other reason.
+     */
+    auto write( std::uint8_t register_address, Byte_View data ) noexcept -> Result<Void, Error_Code>
+    {
+        return write( register_address, data.begin(), data.end() );
     }
 
   private:
@@ -1449,6 +1314,87 @@ class Device<Bus_Multiplexer_Aligner, Controller, std::uint8_t> {
      *        addressed, or does does not acknowledge a write.
      */
     Error_Code m_nonresponsive_device_error{};
+
+    /**
+     * \brief Replace picolibrary::Generic_Error::NONRESPONSIVE_DEVICE errors with the
+     *        device's nonresponsive device error.
+     *
+     * \tparam Result_Type The operation result type.
+     *
+     * \param[in] result The operation result.
+     *
+     * \return The operation result with picolibrary::Generic_Error::NONRESPONSIVE_DEVICE
+     *         errors replaced with the device's nonresponsive device error.
+     */
+    template<typename Result_Type>
+    auto map_nonresponsive_device_error( Result_Type && result ) const noexcept
+    {
+        return map_error( std::forward<Result_Type>( result ), [ this ]( Error_Code const & error ) noexcept {
+            return error == Generic_Error::NONRESPONSIVE_DEVICE ? make_error( m_nonresponsive_device_error ) : error;
+        } );
+    }
+
+    /**
+     * \brief Align the I2C bus's multiplexer(s) (if any), take control of the bus, and
+     *        communicate with the device.
+     *
+     * \tparam Functor A unary functor that takes a reference to the bus's
+     *         picolibrary::I2C::Bus_Control_Guard, communicates with the device, and
+     *         returns a picolibrary::Result.
+     *
+     * \param[in] functor The functor to use to communicate with the device.
+     *
+     * \return The result returned by the functor if alignment and taking control of the
+     *         bus succeeded.
+     * \return An error code if alignment or taking control of the bus failed.
+     */
+    template<typename Functor>
+    auto communicate( Functor functor ) const noexcept
+    {
+        return and_then( m_align_bus_multiplexer(), [ this, &functor ]() noexcept {
+            return and_then(
+                make_bus_control_guard( *m_controller ),
+                [ &functor ]( auto guard ) noexcept { return functor( guard ); } );
+        } );
+    }
+
+    /**
+     * \brief Address the device.
+     *
+     * \param[in] operation The operation that will be performed once the device has been
+     *            addressed.
+     *
+     * \return Nothing if addressing the device succeeded.
+     * \return picolibrary::I2C::Device<Bus_Multiplexer_Aligner, Controller,
+     *         std::uint8_t>::nonresponsive_device_error() if the device is not
+     *         responsive.
+     * \return An error code if addressing the device failed for any other reason.
+     */
+    auto address_device( Operation operation ) const noexcept
+    {
+        return map_nonresponsive_device_error( m_controller->address( m_address, operation ) );
+    }
+
+    /**
+     * \brief Address the device for writing, and write the address of the register to
+     *        access.
+     *
+     * \param[in] register_address The address of the register to access.
+     *
+     * \return Nothing if register selection succeeded.
+     * \return picolibrary::I2C::Device<Bus_Multiplexer_Aligner, Controller,
+     *         std::uint8_t>::nonresponsive_device_error() if the device is not
+     *         responsive.
+     * \return An error code if register selection failed for any other reason.
+     */
+    auto select_register( std::uint8_t register_address ) const noexcept -> Result<Void, Error_Code>
+    {
+        return sequence(
+            [ this ]() noexcept { return address_device( Operation::WRITE ); },
+            [ this, register_address ]() noexcept {
+                return map_nonresponsive_device_error( m_controller->write( register_address ) );
+            } );
+    }
 };
 
 } // namespace picolibrary::I2C
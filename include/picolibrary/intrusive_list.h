@@ -0,0 +1,1023 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary intrusive list interface.
+ */
+
+#ifndef PICOLIBRARY_INTRUSIVE_LIST_H
+#define PICOLIBRARY_INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <type_traits>
+
+#include "picolibrary/iterator.h"
+
+namespace picolibrary {
+
+template<typename T>
+class Intrusive_Forward_List;
+
+template<typename T>
+class Intrusive_List;
+
+/**
+ * \brief Intrusive singly linked list node.
+ *
+ * Objects are made storable in a picolibrary::Intrusive_Forward_List by deriving from
+ * this class. An object can be stored in at most one list at a time.
+ */
+class Intrusive_Forward_List_Node {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Intrusive_Forward_List_Node() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \attention Links are not copied, the constructed node is not linked.
+     */
+    constexpr Intrusive_Forward_List_Node( Intrusive_Forward_List_Node const & ) noexcept
+    {
+    }
+
+    /**
+     * \brief Destructor.
+     *
+     * \warning Destroying a node that is stored in a list results in undefined behavior.
+     */
+    ~Intrusive_Forward_List_Node() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \attention Links are not assigned, the assigned to node's links are not changed.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Intrusive_Forward_List_Node const & ) noexcept
+        -> Intrusive_Forward_List_Node &
+    {
+        return *this;
+    }
+
+  private:
+    template<typename>
+    friend class Intrusive_Forward_List;
+
+    /**
+     * \brief The next node in the list.
+     */
+    Intrusive_Forward_List_Node * m_next{};
+};
+
+/**
+ * \brief Intrusive singly linked list.
+ *
+ * The list does not own, allocate, or copy the objects stored in it. Insertion at the
+ * front and back and removal from the front are O(1).
+ *
+ * \tparam T The list object type (must publicly derive from
+ *         picolibrary::Intrusive_Forward_List_Node).
+ */
+template<typename T>
+class Intrusive_Forward_List {
+  private:
+    template<typename U, typename Node>
+    class Basic_Iterator;
+
+  public:
+    static_assert( std::is_base_of_v<Intrusive_Forward_List_Node, T> );
+
+    /**
+     * \brief The list object type.
+     */
+    using Value = T;
+
+    /**
+     * \brief The number of objects in the list.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief List iterator.
+     */
+    using Iterator = Basic_Iterator<Value, Intrusive_Forward_List_Node>;
+
+    /**
+     * \brief List const iterator.
+     */
+    using Const_Iterator = Basic_Iterator<Value const, Intrusive_Forward_List_Node const>;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Intrusive_Forward_List() noexcept = default;
+
+    Intrusive_Forward_List( Intrusive_Forward_List && ) = delete;
+
+    Intrusive_Forward_List( Intrusive_Forward_List const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * \attention Objects stored in the list are not destroyed, but are unlinked.
+     */
+    ~Intrusive_Forward_List() noexcept
+    {
+        clear();
+    }
+
+    auto operator=( Intrusive_Forward_List && ) = delete;
+
+    auto operator=( Intrusive_Forward_List const & ) = delete;
+
+    /**
+     * \brief Check if the list is empty.
+     *
+     * \return true if the list is empty.
+     * \return false if the list is not empty.
+     */
+    constexpr auto empty() const noexcept -> bool
+    {
+        return not m_head;
+    }
+
+    /**
+     * \brief Get the number of objects in the list.
+     *
+     * \return The number of objects in the list.
+     */
+    constexpr auto size() const noexcept -> Size
+    {
+        return m_size;
+    }
+
+    /**
+     * \brief Access the first object in the list.
+     *
+     * \warning Calling this function on an empty list results in undefined behavior.
+     *
+     * \return The first object in the list.
+     */
+    constexpr auto front() noexcept -> Value &
+    {
+        return static_cast<Value &>( *m_head );
+    }
+
+    /**
+     * \brief Access the first object in the list.
+     *
+     * \warning Calling this function on an empty list results in undefined behavior.
+     *
+     * \return The first object in the list.
+     */
+    constexpr auto front() const noexcept -> Value const &
+    {
+        return static_cast<Value const &>( *m_head );
+    }
+
+    /**
+     * \brief Access the last object in the list.
+     *
+     * \warning Calling this function on an empty list results in undefined behavior.
+     *
+     * \return The last object in the list.
+     */
+    constexpr auto back() noexcept -> Value &
+    {
+        return static_cast<Value &>( *m_tail );
+    }
+
+    /**
+     * \brief Access the last object in the list.
+     *
+     * \warning Calling this function on an empty list results in undefined behavior.
+     *
+     * \return The last object in the list.
+     */
+    constexpr auto back() const noexcept -> Value const &
+    {
+        return static_cast<Value const &>( *m_tail );
+    }
+
+    /**
+     * \brief Get an iterator to the first object in the list.
+     *
+     * \return An iterator to the first object in the list.
+     */
+    constexpr auto begin() noexcept
+    {
+        return Iterator{ m_head };
+    }
+
+    /**
+     * \brief Get an iterator to the first object in the list.
+     *
+     * \return An iterator to the first object in the list.
+     */
+    constexpr auto begin() const noexcept
+    {
+        return Const_Iterator{ m_head };
+    }
+
+    /**
+     * \brief Get an iterator to the object following the last object in the list.
+     *
+     * \return An iterator to the object following the last object in the list.
+     */
+    constexpr auto end() noexcept
+    {
+        return Iterator{};
+    }
+
+    /**
+     * \brief Get an iterator to the object following the last object in the list.
+     *
+     * \return An iterator to the object following the last object in the list.
+     */
+    constexpr auto end() const noexcept
+    {
+        return Const_Iterator{};
+    }
+
+    /**
+     * \brief Insert an object at the front of the list.
+     *
+     * \warning Inserting an object that is already stored in a list results in undefined
+     *          behavior.
+     *
+     * \param[in] value The object to insert.
+     */
+    constexpr void push_front( Value & value ) noexcept
+    {
+        Intrusive_Forward_List_Node & node = value;
+
+        node.m_next = m_head;
+        m_head      = &node;
+
+        if ( not m_tail ) {
+            m_tail = &node;
+        } // if
+
+        ++m_size;
+    }
+
+    /**
+     * \brief Insert an object at the back of the list.
+     *
+     * \warning Inserting an object that is already stored in a list results in undefined
+     *          behavior.
+     *
+     * \param[in] value The object to insert.
+     */
+    constexpr void push_back( Value & value ) noexcept
+    {
+        Intrusive_Forward_List_Node & node = value;
+
+        node.m_next = nullptr;
+
+        if ( m_tail ) {
+            m_tail->m_next = &node;
+        } else {
+            m_head = &node;
+        } // else
+
+        m_tail = &node;
+
+        ++m_size;
+    }
+
+    /**
+     * \brief Remove the first object from the list.
+     *
+     * \warning Calling this function on an empty list results in undefined behavior.
+     *
+     * \return The removed object.
+     */
+    constexpr auto pop_front() noexcept -> Value &
+    {
+        auto & node = *m_head;
+
+        m_head = node.m_next;
+
+        if ( not m_head ) {
+            m_tail = nullptr;
+        } // if
+
+        node.m_next = nullptr;
+
+        --m_size;
+
+        return static_cast<Value &>( node );
+    }
+
+    /**
+     * \brief Remove all objects from the list.
+     */
+    constexpr void clear() noexcept
+    {
+        while ( m_head ) {
+            pop_front();
+        } // while
+    }
+
+  private:
+    /**
+     * \brief List iterator.
+     *
+     * \tparam U The iterated over type.
+     * \tparam Node The list node type.
+     */
+    template<typename U, typename Node>
+    class Basic_Iterator {
+      public:
+        /**
+         * \brief Type that can be used to identify the distance between two iterators.
+         */
+        using Difference = std::ptrdiff_t;
+
+        /**
+         * \brief The iterated over type.
+         */
+        using Value = U;
+
+        /**
+         * \brief Pointer to the iterated over type.
+         */
+        using Pointer = Value *;
+
+        /**
+         * \brief Reference to the iterated over type.
+         */
+        using Reference = Value &;
+
+        /**
+         * \brief Iterator category tag.
+         */
+        using Iterator_Category = Forward_Iterator_Tag;
+
+        /**
+         * \brief Constructor.
+         */
+        constexpr Basic_Iterator() noexcept = default;
+
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] node The node the iterator refers to.
+         */
+        constexpr explicit Basic_Iterator( Node * node ) noexcept : m_node{ node }
+        {
+        }
+
+        /**
+         * \brief Access the object the iterator refers to.
+         *
+         * \return The object the iterator refers to.
+         */
+        constexpr auto operator*() const noexcept -> Reference
+        {
+            return static_cast<Reference>( *m_node );
+        }
+
+        /**
+         * \brief Access the object the iterator refers to.
+         *
+         * \return A pointer to the object the iterator refers to.
+         */
+        constexpr auto operator->() const noexcept -> Pointer
+        {
+            return &**this;
+        }
+
+        /**
+         * \brief Advance the iterator to the next object in the list.
+         *
+         * \return The advanced iterator.
+         */
+        constexpr auto & operator++() noexcept
+        {
+            m_node = m_node->m_next;
+
+            return *this;
+        }
+
+        /**
+         * \brief Advance the iterator to the next object in the list.
+         *
+         * \return The iterator before it was advanced.
+         */
+        constexpr auto operator++( int ) noexcept
+        {
+            auto const iterator = *this;
+
+            ++( *this );
+
+            return iterator;
+        }
+
+        /**
+         * \brief Equality operator.
+         *
+         * \param[in] rhs The right hand side of the comparison.
+         *
+         * \return true if the iterators refer to the same object.
+         * \return false if the iterators do not refer to the same object.
+         */
+        constexpr auto operator==( Basic_Iterator const & rhs ) const noexcept
+        {
+            return m_node == rhs.m_node;
+        }
+
+        /**
+         * \brief Inequality operator.
+         *
+         * \param[in] rhs The right hand side of the comparison.
+         *
+         * \return true if the iterators do not refer to the same object.
+         * \return false if the iterators refer to the same object.
+         */
+        constexpr auto operator!=( Basic_Iterator const & rhs ) const noexcept
+        {
+            return not( *this == rhs );
+        }
+
+      private:
+        /**
+         * \brief The node the iterator refers to.
+         */
+        Node * m_node{};
+    };
+
+    /**
+     * \brief The first node in the list.
+     */
+    Intrusive_Forward_List_Node * m_head{};
+
+    /**
+     * \brief The last node in the list.
+     */
+    Intrusive_Forward_List_Node * m_tail{};
+
+    /**
+     * \brief The number of objects in the list.
+     */
+    Size m_size{};
+};
+
+/**
+ * \brief Intrusive doubly linked list node.
+ *
+ * Objects are made storable in a picolibrary::Intrusive_List by deriving from this
+ * class. An object can be stored in at most one list at a time.
+ */
+class Intrusive_List_Node {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Intrusive_List_Node() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \attention Links are not copied, the constructed node is not linked.
+     */
+    constexpr Intrusive_List_Node( Intrusive_List_Node const & ) noexcept
+    {
+    }
+
+    /**
+     * \brief Destructor.
+     *
+     * \warning Destroying a node that is stored in a list results in undefined behavior.
+     */
+    ~Intrusive_List_Node() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \attention Links are not assigned, the assigned to node's links are not changed.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Intrusive_List_Node const & ) noexcept
+        -> Intrusive_List_Node &
+    {
+        return *this;
+    }
+
+    /**
+     * \brief Check if the node is stored in a list.
+     *
+     * \return true if the node is stored in a list.
+     * \return false if the node is not stored in a list.
+     */
+    constexpr auto linked() const noexcept -> bool
+    {
+        return m_next;
+    }
+
+  private:
+    template<typename>
+    friend class Intrusive_List;
+
+    /**
+     * \brief The previous node in the list.
+     */
+    Intrusive_List_Node * m_previous{};
+
+    /**
+     * \brief The next node in the list.
+     */
+    Intrusive_List_Node * m_next{};
+};
+
+/**
+ * \brief Intrusive doubly linked list.
+ *
+ * The list does not own, allocate, or copy the objects stored in it. Insertion and
+ * removal at either end, and removal of an arbitrary object, are O(1).
+ *
+ * \tparam T The list object type (must publicly derive from
+ *         picolibrary::Intrusive_List_Node).
+ */
+template<typename T>
+class Intrusive_List {
+  private:
+    template<typename U, typename Node>
+    class Basic_Iterator;
+
+  public:
+    static_assert( std::is_base_of_v<Intrusive_List_Node, T> );
+
+    /**
+     * \brief The list object type.
+     */
+    using Value = T;
+
+    /**
+     * \brief The number of objects in the list.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief List iterator.
+     */
+    using Iterator = Basic_Iterator<Value, Intrusive_List_Node>;
+
+    /**
+     * \brief List const iterator.
+     */
+    using Const_Iterator = Basic_Iterator<Value const, Intrusive_List_Node const>;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Intrusive_List() noexcept
+    {
+        m_sentinel.m_previous = &m_sentinel;
+        m_sentinel.m_next     = &m_sentinel;
+    }
+
+    Intrusive_List( Intrusive_List && ) = delete;
+
+    Intrusive_List( Intrusive_List const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * \attention Objects stored in the list are not destroyed, but are unlinked.
+     */
+    ~Intrusive_List() noexcept
+    {
+        clear();
+    }
+
+    auto operator=( Intrusive_List && ) = delete;
+
+    auto operator=( Intrusive_List const & ) = delete;
+
+    /**
+     * \brief Check if the list is empty.
+     *
+     * \return true if the list is empty.
+     * \return false if the list is not empty.
+     */
+    constexpr auto empty() const noexcept -> bool
+    {
+        return m_sentinel.m_next == &m_sentinel;
+    }
+
+    /**
+     * \brief Get the number of objects in the list.
+     *
+     * \return The number of objects in the list.
+     */
+    constexpr auto size() const noexcept -> Size
+    {
+        return m_size;
+    }
+
+    /**
+     * \brief Access the first object in the list.
+     *
+     * \warning Calling this function on an empty list results in undefined behavior.
+     *
+     * \return The first object in the list.
+     */
+    constexpr auto front() noexcept -> Value &
+    {
+        return static_cast<Value &>( *m_sentinel.m_next );
+    }
+
+    /**
+     * \brief Access the first object in the list.
+     *
+     * \warning Calling this function on an empty list results in undefined behavior.
+     *
+     * \return The first object in the list.
+     */
+    constexpr auto front() const noexcept -> Value const &
+    {
+        return static_cast<Value const &>( *m_sentinel.m_next );
+    }
+
+    /**
+     * \brief Access the last object in the list.
+     *
+     * \warning Calling this function on an empty list results in undefined behavior.
+     *
+     * \return The last object in the list.
+     */
+    constexpr auto back() noexcept -> Value &
+    {
+        return static_cast<Value &>( *m_sentinel.m_previous );
+    }
+
+    /**
+     * \brief Access the last object in the list.
+     *
+     * \warning Calling this function on an empty list results in undefined behavior.
+     *
+     * \return The last object in the list.
+     */
+    constexpr auto back() const noexcept -> Value const &
+    {
+        return static_cast<Value const &>( *m_sentinel.m_previous );
+    }
+
+    /**
+     * \brief Get an iterator to the first object in the list.
+     *
+     * \return An iterator to the first object in the list.
+     */
+    constexpr auto begin() noexcept
+    {
+        return Iterator{ m_sentinel.m_next };
+    }
+
+    /**
+     * \brief Get an iterator to the first object in the list.
+     *
+     * \return An iterator to the first object in the list.
+     */
+    constexpr auto begin() const noexcept
+    {
+        return Const_Iterator{ m_sentinel.m_next };
+    }
+
+    /**
+     * \brief Get an iterator to the object following the last object in the list.
+     *
+     * \return An iterator to the object following the last object in the list.
+     */
+    constexpr auto end() noexcept
+    {
+        return Iterator{ &m_sentinel };
+    }
+
+    /**
+     * \brief Get an iterator to the object following the last object in the list.
+     *
+     * \return An iterator to the object following the last object in the list.
+     */
+    constexpr auto end() const noexcept
+    {
+        return Const_Iterator{ &m_sentinel };
+    }
+
+    /**
+     * \brief Insert an object at the front of the list.
+     *
+     * \warning Inserting an object that is already stored in a list results in undefined
+     *          behavior.
+     *
+     * \param[in] value The object to insert.
+     */
+    constexpr void push_front( Value & value ) noexcept
+    {
+        link( *m_sentinel.m_next, value );
+    }
+
+    /**
+     * \brief Insert an object at the back of the list.
+     *
+     * \warning Inserting an object that is already stored in a list results in undefined
+     *          behavior.
+     *
+     * \param[in] value The object to insert.
+     */
+    constexpr void push_back( Value & value ) noexcept
+    {
+        link( m_sentinel, value );
+    }
+
+    /**
+     * \brief Insert an object before another object.
+     *
+     * \warning Inserting an object that is already stored in a list results in undefined
+     *          behavior.
+     *
+     * \param[in] position The iterator to the object to insert the object before.
+     * \param[in] value The object to insert.
+     *
+     * \return An iterator to the inserted object.
+     */
+    constexpr auto insert( Iterator position, Value & value ) noexcept
+    {
+        link( *position.m_node, value );
+
+        return Iterator{ &value };
+    }
+
+    /**
+     * \brief Remove the first object from the list.
+     *
+     * \warning Calling this function on an empty list results in undefined behavior.
+     *
+     * \return The removed object.
+     */
+    constexpr auto pop_front() noexcept -> Value &
+    {
+        auto & value = front();
+
+        erase( value );
+
+        return value;
+    }
+
+    /**
+     * \brief Remove the last object from the list.
+     *
+     * \warning Calling this function on an empty list results in undefined behavior.
+     *
+     * \return The removed object.
+     */
+    constexpr auto pop_back() noexcept -> Value &
+    {
+        auto & value = back();
+
+        erase( value );
+
+        return value;
+    }
+
+    /**
+     * \brief Remove an object from the list.
+     *
+     * \warning Removing an object that is not stored in the list results in undefined
+     *          behavior.
+     *
+     * \param[in] value The object to remove.
+     */
+    constexpr void erase( Value & value ) noexcept
+    {
+        Intrusive_List_Node & node = value;
+
+        node.m_previous->m_next = node.m_next;
+        node.m_next->m_previous = node.m_previous;
+
+        node.m_previous = nullptr;
+        node.m_next     = nullptr;
+
+        --m_size;
+    }
+
+    /**
+     * \brief Remove all objects from the list.
+     */
+    constexpr void clear() noexcept
+    {
+        while ( not empty() ) {
+            pop_front();
+        } // while
+    }
+
+  private:
+    /**
+     * \brief List iterator.
+     *
+     * \tparam U The iterated over type.
+     * \tparam Node The list node type.
+     */
+    template<typename U, typename Node>
+    class Basic_Iterator {
+      public:
+        /**
+         * \brief Type that can be used to identify the distance between two iterators.
+         */
+        using Difference = std::ptrdiff_t;
+
+        /**
+         * \brief The iterated over type.
+         */
+        using Value = U;
+
+        /**
+         * \brief Pointer to the iterated over type.
+         */
+        using Pointer = Value *;
+
+        /**
+         * \brief Reference to the iterated over type.
+         */
+        using Reference = Value &;
+
+        /**
+         * \brief Iterator category tag.
+         */
+        using Iterator_Category = Bidirectional_Iterator_Tag;
+
+        /**
+         * \brief Constructor.
+         */
+        constexpr Basic_Iterator() noexcept = default;
+
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] node The node the iterator refers to.
+         */
+        constexpr explicit Basic_Iterator( Node * node ) noexcept : m_node{ node }
+        {
+        }
+
+        /**
+         * \brief Access the object the iterator refers to.
+         *
+         * \return The object the iterator refers to.
+         */
+        constexpr auto operator*() const noexcept -> Reference
+        {
+            return static_cast<Reference>( *m_node );
+        }
+
+        /**
+         * \brief Access the object the iterator refers to.
+         *
+         * \return A pointer to the object the iterator refers to.
+         */
+        constexpr auto operator->() const noexcept -> Pointer
+        {
+            return &**this;
+        }
+
+        /**
+         * \brief Advance the iterator to the next object in the list.
+         *
+         * \return The advanced iterator.
+         */
+        constexpr auto & operator++() noexcept
+        {
+            m_node = m_node->m_next;
+
+            return *this;
+        }
+
+        /**
+         * \brief Advance the iterator to the next object in the list.
+         *
+         * \return The iterator before it was advanced.
+         */
+        constexpr auto operator++( int ) noexcept
+        {
+            auto const iterator = *this;
+
+            ++( *this );
+
+            return iterator;
+        }
+
+        /**
+         * \brief Move the iterator to the previous object in the list.
+         *
+         * \return The moved iterator.
+         */
+        constexpr auto & operator--() noexcept
+        {
+            m_node = m_node->m_previous;
+
+            return *this;
+        }
+
+        /**
+         * \brief Move the iterator to the previous object in the list.
+         *
+         * \return The iterator before it was moved.
+         */
+        constexpr auto operator--( int ) noexcept
+        {
+            auto const iterator = *this;
+
+            --( *this );
+
+            return iterator;
+        }
+
+        /**
+         * \brief Equality operator.
+         *
+         * \param[in] rhs The right hand side of the comparison.
+         *
+         * \return true if the iterators refer to the same object.
+         * \return false if the iterators do not refer to the same object.
+         */
+        constexpr auto operator==( Basic_Iterator const & rhs ) const noexcept
+        {
+            return m_node == rhs.m_node;
+        }
+
+        /**
+         * \brief Inequality operator.
+         *
+         * \param[in] rhs The right hand side of the comparison.
+         *
+         * \return true if the iterators do not refer to the same object.
+         * \return false if the iterators refer to the same object.
+         */
+        constexpr auto operator!=( Basic_Iterator const & rhs ) const noexcept
+        {
+            return not( *this == rhs );
+        }
+
+      private:
+        friend class Intrusive_List;
+
+        /**
+         * \brief The node the iterator refers to.
+         */
+        Node * m_node{};
+    };
+
+    /**
+     * \brief The list's sentinel node (the node preceding the first node and following
+     *        the last node).
+     */
+    Intrusive_List_Node m_sentinel{};
+
+    /**
+     * \brief The number of objects in the list.
+     */
+    Size m_size{};
+
+    /**
+     * \brief Link an object into the list before a node.
+     *
+     * \param[in] next The node to link the object before.
+     * \param[in] value The object to link into the list.
+     */
+    constexpr void link( Intrusive_List_Node & next, Value & value ) noexcept
+    {
+        Intrusive_List_Node & node = value;
+
+        node.m_previous         = next.m_previous;
+        node.m_next             = &next;
+        next.m_previous->m_next = &node;
+        next.m_previous         = &node;
+
+        ++m_size;
+    }
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_INTRUSIVE_LIST_H
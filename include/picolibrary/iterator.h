@@ -138,6 +138,29 @@ struct Iterator_Traits<T *> {
     using Iterator_Category = Contiguous_Iterator_Tag;
 };
 
+/**
+ * \brief Check if an iterator is a contiguous iterator.
+ *
+ * \tparam Iterator The iterator type to check.
+ */
+template<typename Iterator, typename = std::void_t<>>
+struct is_contiguous_iterator : std::false_type {
+};
+
+/**
+ * \copydoc picolibrary::is_contiguous_iterator
+ */
+template<typename Iterator>
+struct is_contiguous_iterator<Iterator, std::void_t<typename Iterator_Traits<Iterator>::Iterator_Category>> :
+    std::is_base_of<Contiguous_Iterator_Tag, typename Iterator_Traits<Iterator>::Iterator_Category> {
+};
+
+/**
+ * \copydoc picolibrary::is_contiguous_iterator
+ */
+template<typename Iterator>
+constexpr auto is_contiguous_iterator_v = is_contiguous_iterator<Iterator>::value;
+
 /**
  * \brief Reverse iterator adapter.
  *
@@ -26,11 +26,13 @@
 #include <cstdint>
 #include <utility>
 
+#include "picolibrary/bit_manipulation.h"
 #include "picolibrary/error.h"
 #include "picolibrary/fixed_size_array.h"
 #include "picolibrary/gpio.h"
 #include "picolibrary/i2c.h"
 #include "picolibrary/result.h"
+#include "picolibrary/trace.h"
 #include "picolibrary/void.h"
 
 /**
@@ -170,15 +172,15 @@ struct IOCON {
      * \brief Field bit masks.
      */
     struct Mask {
-        static constexpr auto RESERVED0 = std::uint8_t{ 0b1 << Bit::RESERVED0 }; ///< Reserved.
-        static constexpr auto INTPOL = std::uint8_t{ 0b1 << Bit::INTPOL }; ///< INTPOL.
-        static constexpr auto ODR    = std::uint8_t{ 0b1 << Bit::ODR };    ///< ODR.
-        static constexpr auto RESERVED3 = std::uint8_t{ 0b1 << Bit::RESERVED3 }; ///< Reserved.
-        static constexpr auto DISSLW = std::uint8_t{ 0b1 << Bit::DISSLW }; ///< DISSLW.
-        static constexpr auto SEQOP  = std::uint8_t{ 0b1 << Bit::SEQOP };  ///< SEQOP.
-        static constexpr auto RESERVED6 = std::uint8_t{ 0b11 << Bit::RESERVED6 }; ///< Reserved.
-
-        static constexpr auto INTERRUPT_MODE = std::uint8_t{ 0b11 << Bit::INTERRUPT_MODE }; ///< Interrupt mode.
+        static constexpr auto RESERVED0 = bit_field_mask<std::uint8_t>( Size::RESERVED0, Bit::RESERVED0 ); ///< Reserved.
+        static constexpr auto INTPOL = bit_field_mask<std::uint8_t>( Size::INTPOL, Bit::INTPOL ); ///< INTPOL.
+        static constexpr auto ODR = bit_field_mask<std::uint8_t>( Size::ODR, Bit::ODR ); ///< ODR.
+        static constexpr auto RESERVED3 = bit_field_mask<std::uint8_t>( Size::RESERVED3, Bit::RESERVED3 ); ///< Reserved.
+        static constexpr auto DISSLW = bit_field_mask<std::uint8_t>( Size::DISSLW, Bit::DISSLW ); ///< DISSLW.
+        static constexpr auto SEQOP = bit_field_mask<std::uint8_t>( Size::SEQOP, Bit::SEQOP ); ///< SEQOP.
+        static constexpr auto RESERVED6 = bit_field_mask<std::uint8_t>( Size::RESERVED6, Bit::RESERVED6 ); ///< Reserved.
+
+        static constexpr auto INTERRUPT_MODE = bit_field_mask<std::uint8_t>( Size::INTERRUPT_MODE, Bit::INTERRUPT_MODE ); ///< Interrupt mode.
     };
 };
 
@@ -1101,6 +1103,8 @@ class Driver : public Device, public Register_Cache {
      */
     auto read_interrupt_context() const noexcept -> Result<Interrupt_Context, Error_Code>
     {
+        PICOLIBRARY_TRACE_SCOPE( "MCP23008::Driver::read_interrupt_context" );
+
         auto buffer = Fixed_Size_Array<std::uint8_t, 2>{};
 
         auto result = this->read( INTF::ADDRESS, buffer.begin(), buffer.end() );
@@ -1133,6 +1137,8 @@ class Driver : public Device, public Register_Cache {
         SDA_Slew_Rate_Control     sda_slew_rate_control_configuration,
         Interrupt_Mode            interrupt_mode )
     {
+        PICOLIBRARY_TRACE_SCOPE( "MCP23008::Driver::configure" );
+
         return write_iocon(
             static_cast<std::uint8_t>( sequential_operation_mode_configuration )
             | static_cast<std::uint8_t>( sda_slew_rate_control_configuration )
@@ -1157,6 +1163,8 @@ class Driver : public Device, public Register_Cache {
      */
     auto configure_pin_as_internally_pulled_up_input( std::uint8_t mask ) noexcept
     {
+        PICOLIBRARY_TRACE_SCOPE( "MCP23008::Driver::configure_pin_as_internally_pulled_up_input" );
+
         return write_iodir( this->iodir() | mask );
     }
 
@@ -1177,6 +1185,8 @@ class Driver : public Device, public Register_Cache {
      */
     auto configure_pin_as_open_drain_output( std::uint8_t mask ) noexcept
     {
+        PICOLIBRARY_TRACE_SCOPE( "MCP23008::Driver::configure_pin_as_open_drain_output" );
+
         return write_gpio( this->gpio() & ~mask );
     }
 
@@ -1197,6 +1207,8 @@ class Driver : public Device, public Register_Cache {
      */
     auto configure_pin_as_push_pull_output( std::uint8_t mask ) noexcept
     {
+        PICOLIBRARY_TRACE_SCOPE( "MCP23008::Driver::configure_pin_as_push_pull_output" );
+
         return write_iodir( this->iodir() & ~mask );
     }
 
@@ -1218,6 +1230,8 @@ class Driver : public Device, public Register_Cache {
      */
     auto enable_pull_up( std::uint8_t mask ) noexcept
     {
+        PICOLIBRARY_TRACE_SCOPE( "MCP23008::Driver::enable_pull_up" );
+
         return write_gppu( this->gppu() | mask );
     }
 
@@ -1239,6 +1253,8 @@ class Driver : public Device, public Register_Cache {
      */
     auto disable_pull_up( std::uint8_t mask ) noexcept
     {
+        PICOLIBRARY_TRACE_SCOPE( "MCP23008::Driver::disable_pull_up" );
+
         return write_gppu( this->gppu() & ~mask );
     }
 
@@ -1257,6 +1273,8 @@ class Driver : public Device, public Register_Cache {
      */
     auto state( std::uint8_t mask ) const noexcept -> Result<std::uint8_t, Error_Code>
     {
+        PICOLIBRARY_TRACE_SCOPE( "MCP23008::Driver::state" );
+
         auto result = read_gpio();
         if ( result.is_error() ) {
             return result.error();
@@ -1283,6 +1301,8 @@ class Driver : public Device, public Register_Cache {
      */
     auto transition_open_drain_output_to_high( std::uint8_t mask ) noexcept
     {
+        PICOLIBRARY_TRACE_SCOPE( "MCP23008::Driver::transition_open_drain_output_to_high" );
+
         return write_iodir( this->iodir() | mask );
     }
 
@@ -1304,6 +1324,8 @@ class Driver : public Device, public Register_Cache {
      */
     auto transition_push_pull_output_to_high( std::uint8_t mask ) noexcept
     {
+        PICOLIBRARY_TRACE_SCOPE( "MCP23008::Driver::transition_push_pull_output_to_high" );
+
         return write_gpio( this->gpio() | mask );
     }
 
@@ -1325,6 +1347,8 @@ class Driver : public Device, public Register_Cache {
      */
     auto transition_open_drain_output_to_low( std::uint8_t mask ) noexcept
     {
+        PICOLIBRARY_TRACE_SCOPE( "MCP23008::Driver::transition_open_drain_output_to_low" );
+
         return write_iodir( this->iodir() & ~mask );
     }
 
@@ -1346,6 +1370,8 @@ class Driver : public Device, public Register_Cache {
      */
     auto transition_push_pull_output_to_low( std::uint8_t mask ) noexcept
     {
+        PICOLIBRARY_TRACE_SCOPE( "MCP23008::Driver::transition_push_pull_output_to_low" );
+
         return write_gpio( this->gpio() & ~mask );
     }
 
@@ -1367,6 +1393,8 @@ class Driver : public Device, public Register_Cache {
      */
     auto toggle_open_drain_output( std::uint8_t mask ) noexcept
     {
+        PICOLIBRARY_TRACE_SCOPE( "MCP23008::Driver::toggle_open_drain_output" );
+
         return write_iodir( this->iodir() ^ mask );
     }
 
@@ -1388,6 +1416,8 @@ class Driver : public Device, public Register_Cache {
      */
     auto toggle_push_pull_output( std::uint8_t mask ) noexcept
     {
+        PICOLIBRARY_TRACE_SCOPE( "MCP23008::Driver::toggle_push_pull_output" );
+
         return write_gpio( this->gpio() ^ mask );
     }
 };
@@ -31,6 +31,7 @@
 #include "picolibrary/fixed_size_array.h"
 #include "picolibrary/result.h"
 #include "picolibrary/spi.h"
+#include "picolibrary/trace.h"
 #include "picolibrary/void.h"
 
 /**
@@ -276,6 +277,8 @@ class Driver : public Device {
     {
         // #lizard forgives the length
 
+        PICOLIBRARY_TRACE_SCOPE( "MCP3008::Driver::sample" );
+
         {
             auto result = this->configure();
             if ( result.is_error() ) {
@@ -309,7 +312,7 @@ class Driver : public Device {
         }
 
         if ( data[ 1 ] & 0b100 ) {
-            return m_nonresponsive;
+            return make_error( m_nonresponsive );
         } // if
 
         return Sample{ ( static_cast<Sample::Value>( data[ 1 ] & 0b11 )
@@ -0,0 +1,229 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::MPMC_Queue interface.
+ */
+
+#ifndef PICOLIBRARY_MPMC_QUEUE_H
+#define PICOLIBRARY_MPMC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+#include "picolibrary/utility.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Bounded lock-free multiple producer, multiple consumer queue.
+ *
+ * Each queue element is paired with a sequence number that tells producers and
+ * consumers whether the element is ready to be written or read (Vyukov's bounded MPMC
+ * queue), so producers only contend with producers, and consumers only contend with
+ * consumers, on a single compare-and-swap each.
+ *
+ * \tparam T The queue element type.
+ * \tparam N The queue capacity. Must be a power of two.
+ */
+template<typename T, std::size_t N>
+class MPMC_Queue {
+  public:
+    static_assert( N and not( N & ( N - 1 ) ), "N must be a power of two" );
+
+    /**
+     * \brief The queue element type.
+     */
+    using Value = T;
+
+    /**
+     * \brief The number of elements in the queue.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief Constructor.
+     */
+    MPMC_Queue() noexcept
+    {
+        for ( auto position = Size{}; position < N; ++position ) {
+            m_cells[ position ].sequence.store( position, std::memory_order_relaxed );
+        } // for
+    }
+
+    MPMC_Queue( MPMC_Queue && ) = delete;
+
+    MPMC_Queue( MPMC_Queue const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~MPMC_Queue() noexcept = default;
+
+    auto operator=( MPMC_Queue && ) = delete;
+
+    auto operator=( MPMC_Queue const & ) = delete;
+
+    /**
+     * \brief Get the queue's capacity.
+     *
+     * \return The queue's capacity.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Push an element into the queue.
+     *
+     * \param[in] value The element to push into the queue.
+     *
+     * \return true if the element was pushed into the queue.
+     * \return false if the queue is full.
+     */
+    auto push( Value const & value ) noexcept
+    {
+        return emplace( value );
+    }
+
+    /**
+     * \brief Push an element into the queue.
+     *
+     * \param[in] value The element to push into the queue.
+     *
+     * \return true if the element was pushed into the queue.
+     * \return false if the queue is full.
+     */
+    auto push( Value && value ) noexcept
+    {
+        return emplace( std::move( value ) );
+    }
+
+    /**
+     * \brief Pop an element from the queue.
+     *
+     * \param[out] value The popped element.
+     *
+     * \return true if an element was popped from the queue.
+     * \return false if the queue is empty.
+     */
+    auto pop( Value & value ) noexcept
+    {
+        auto position = m_dequeue_position.load( std::memory_order_relaxed );
+
+        for ( ;; ) {
+            auto &     cell     = m_cells[ position & MASK ];
+            auto const sequence = cell.sequence.load( std::memory_order_acquire );
+            auto const lag = static_cast<std::ptrdiff_t>( sequence - ( position + 1 ) );
+
+            if ( lag == 0 ) {
+                if ( m_dequeue_position.compare_exchange_weak(
+                         position, position + 1, std::memory_order_relaxed ) ) {
+                    value = std::move( cell.value );
+
+                    cell.sequence.store( position + N, std::memory_order_release );
+
+                    return true;
+                } // if
+            } else if ( lag < 0 ) {
+                return false;
+            } else {
+                position = m_dequeue_position.load( std::memory_order_relaxed );
+            } // else
+        }     // for
+    }
+
+  private:
+    /**
+     * \brief The mask used to convert a position to a cell index.
+     */
+    static constexpr auto MASK = Size{ N - 1 };
+
+    /**
+     * \brief Queue cell.
+     */
+    struct Cell {
+        /**
+         * \brief The cell's sequence number.
+         */
+        std::atomic<Size> sequence{};
+
+        /**
+         * \brief The cell's element.
+         */
+        Value value{};
+    };
+
+    /**
+     * \brief The queue cells.
+     */
+    Cell m_cells[ N ]{};
+
+    /**
+     * \brief The position of the next element to be written.
+     */
+    alignas( CACHE_LINE_SIZE ) std::atomic<Size> m_enqueue_position{};
+
+    /**
+     * \brief The position of the next element to be read.
+     */
+    alignas( CACHE_LINE_SIZE ) std::atomic<Size> m_dequeue_position{};
+
+    /**
+     * \brief Push an element into the queue.
+     *
+     * \tparam V The type of the element to push into the queue.
+     *
+     * \param[in] value The element to push into the queue.
+     *
+     * \return true if the element was pushed into the queue.
+     * \return false if the queue is full.
+     */
+    template<typename V>
+    auto emplace( V && value ) noexcept
+    {
+        auto position = m_enqueue_position.load( std::memory_order_relaxed );
+
+        for ( ;; ) {
+            auto &     cell     = m_cells[ position & MASK ];
+            auto const sequence = cell.sequence.load( std::memory_order_acquire );
+            auto const lag      = static_cast<std::ptrdiff_t>( sequence - position );
+
+            if ( lag == 0 ) {
+                if ( m_enqueue_position.compare_exchange_weak(
+                         position, position + 1, std::memory_order_relaxed ) ) {
+                    cell.value = std::forward<V>( value );
+
+                    cell.sequence.store( position + 1, std::memory_order_release );
+
+                    return true;
+                } // if
+            } else if ( lag < 0 ) {
+                return false;
+            } else {
+                position = m_enqueue_position.load( std::memory_order_relaxed );
+            } // else
+        }     // for
+    }
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_MPMC_QUEUE_H
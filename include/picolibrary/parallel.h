@@ -0,0 +1,510 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Parallel interface.
+ *
+ * \attention The facilities in this header require a hosted environment with thread
+ *            support, and are only available if PICOLIBRARY_ENABLE_PARALLEL_ALGORITHMS
+ *            is enabled.
+ */
+
+#ifndef PICOLIBRARY_PARALLEL_H
+#define PICOLIBRARY_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "picolibrary/iterator.h"
+#include "picolibrary/result.h"
+#include "picolibrary/void.h"
+#include "picolibrary/work_stealing_deque.h"
+
+/**
+ * \brief Host parallel algorithm facilities.
+ */
+namespace picolibrary::Parallel {
+
+/**
+ * \brief Work-stealing thread pool.
+ *
+ * A job is split into chunks that are distributed round-robin across the participants'
+ * (the worker threads and the thread of execution that runs the job) work-stealing
+ * deques before the worker threads are woken. Each participant executes the chunks in its
+ * own deque, then claims chunks that did not fit in the deques, and then steals chunks
+ * from the other participants' deques until every chunk has been executed.
+ */
+class Thread_Pool {
+  public:
+    /**
+     * \brief The number of worker threads, participants, or chunks.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief The maximum number of chunks that can be queued in a participant's deque.
+     */
+    static constexpr auto DEQUE_CAPACITY = Size{ 64 };
+
+    /**
+     * \brief Constructor.
+     *
+     * Creates one fewer worker thread than the number of concurrent threads supported by
+     * the host, since the thread of execution that runs a job also participates in it.
+     */
+    Thread_Pool() noexcept;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] workers The number of worker threads to create.
+     */
+    explicit Thread_Pool( Size workers ) noexcept;
+
+    Thread_Pool( Thread_Pool && ) = delete;
+
+    Thread_Pool( Thread_Pool const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Thread_Pool() noexcept;
+
+    auto operator=( Thread_Pool && ) = delete;
+
+    auto operator=( Thread_Pool const & ) = delete;
+
+    /**
+     * \brief Get the number of participants in a job (the number of worker threads plus
+     *        the thread of execution that runs the job).
+     *
+     * \return The number of participants in a job.
+     */
+    auto participants() const noexcept -> Size
+    {
+        return m_workers.size() + 1;
+    }
+
+    /**
+     * \brief Run a job.
+     *
+     * \attention This function blocks until every chunk of the job has been executed. It
+     *            must not be called concurrently from multiple threads of execution.
+     *
+     * \tparam Task A functor that executes a chunk of the job. It must be safe to call
+     *         concurrently from multiple threads of execution. Illustrative signature:
+     * \code
+     * void task( picolibrary::Parallel::Thread_Pool::Size chunk ) noexcept;
+     * \endcode
+     *
+     * \param[in] chunks The number of chunks in the job.
+     * \param[in] task The functor that executes a chunk of the job.
+     */
+    template<typename Task>
+    void run( Size chunks, Task const & task ) noexcept
+    {
+        run( chunks, &task, []( void const * context, Size chunk ) noexcept {
+            ( *static_cast<Task const *>( context ) )( chunk );
+        } );
+    }
+
+  private:
+    /**
+     * \brief Type-erased chunk executor.
+     */
+    using Executor = void ( * )( void const * context, Size chunk ) noexcept;
+
+    /**
+     * \brief Participant work-stealing deque.
+     */
+    using Deque = Work_Stealing_Deque<Size, DEQUE_CAPACITY>;
+
+    /**
+     * \brief The job's chunk executor.
+     */
+    Executor m_executor{};
+
+    /**
+     * \brief The job's chunk executor context.
+     */
+    void const * m_context{};
+
+    /**
+     * \brief The number of chunks in the job.
+     */
+    Size m_chunks{};
+
+    /**
+     * \brief The next chunk in the job that did not fit in the participants' deques.
+     */
+    std::atomic<Size> m_next_unqueued_chunk{};
+
+    /**
+     * \brief The number of chunks in the job that have not been executed.
+     */
+    std::atomic<Size> m_remaining{};
+
+    /**
+     * \brief The participants' work-stealing deques.
+     */
+    std::unique_ptr<Deque[]> m_deques;
+
+    /**
+     * \brief The worker threads.
+     */
+    std::vector<std::thread> m_workers;
+
+    /**
+     * \brief The mutex used to synchronize job hand off.
+     */
+    std::mutex m_mutex;
+
+    /**
+     * \brief The condition variable used to signal the start of a job or pool shutdown.
+     */
+    std::condition_variable m_start;
+
+    /**
+     * \brief The condition variable used to signal that the worker threads have finished
+     *        a job.
+     */
+    std::condition_variable m_done;
+
+    /**
+     * \brief The job generation (incremented each time a job is started).
+     */
+    Size m_generation{};
+
+    /**
+     * \brief The number of worker threads that have not finished the current job.
+     */
+    Size m_active{};
+
+    /**
+     * \brief Pool shutdown has been requested.
+     */
+    bool m_stop{};
+
+    /**
+     * \brief Run a job.
+     *
+     * \param[in] chunks The number of chunks in the job.
+     * \param[in] context The chunk executor context.
+     * \param[in] executor The chunk executor.
+     */
+    void run( Size chunks, void const * context, Executor executor ) noexcept;
+
+    /**
+     * \brief Worker thread main loop.
+     *
+     * \param[in] participant The worker thread's participant number.
+     */
+    void work( Size participant ) noexcept;
+
+    /**
+     * \brief Participate in the current job.
+     *
+     * \param[in] participant The participant number.
+     */
+    void participate( Size participant ) noexcept;
+};
+
+/**
+ * \brief Get the number of chunks to split a range into.
+ *
+ * \param[in] pool The thread pool the range will be processed with.
+ * \param[in] size The number of elements in the range.
+ *
+ * \return The number of chunks to split the range into.
+ */
+inline auto chunk_count( Thread_Pool const & pool, std::size_t size ) noexcept -> std::size_t
+{
+    return std::min( size, pool.participants() * 8 );
+}
+
+/**
+ * \brief Early stop and first error tracking shared by the participants in a job.
+ *
+ * \tparam Error The error type.
+ */
+template<typename Error>
+class Job_Status {
+  public:
+    /**
+     * \brief Check if the job should stop early.
+     *
+     * \return true if the job should stop early.
+     * \return false if the job should not stop early.
+     */
+    auto stopped() const noexcept -> bool
+    {
+        if constexpr ( std::is_same_v<Error, Void> ) {
+            return false;
+        } else {
+            return m_failed.load( std::memory_order_relaxed );
+        } // else
+    }
+
+    /**
+     * \brief Report an error, and stop the job early.
+     *
+     * \attention Only the first reported error is retained.
+     *
+     * \param[in] error The error to report.
+     */
+    void report( Error const & error ) noexcept
+    {
+        if ( not m_failed.exchange( true, std::memory_order_relaxed ) ) {
+            m_error = error;
+        } // if
+    }
+
+    /**
+     * \brief Get the first reported error.
+     *
+     * \attention This function may only be called after the job completes.
+     *
+     * \return The first reported error if an error was reported.
+     * \return std::nullopt if no error was reported.
+     */
+    auto const & error() const noexcept
+    {
+        return m_error;
+    }
+
+  private:
+    /**
+     * \brief An error has been reported.
+     */
+    std::atomic<bool> m_failed{};
+
+    /**
+     * \brief The first reported error.
+     */
+    std::optional<Error> m_error{};
+};
+
+/**
+ * \brief Apply a functor to a range in parallel.
+ *
+ * \tparam Iterator Range iterator. Must be a random access iterator.
+ * \tparam Functor A unary functor that takes the iterated over type by value or const
+ *         reference, and returns either picolibrary::Result<picolibrary::Void,
+ *         picolibrary::Error_Code> or picolibrary::Result<picolibrary::Void,
+ *         picolibrary::Void>. It must be safe to call concurrently from multiple threads
+ *         of execution. If an error is returned by the functor, the remaining elements
+ *         are skipped and an error is returned.
+ *
+ * \param[in] pool The thread pool to use.
+ * \param[in] begin The beginning of the range to apply the functor to.
+ * \param[in] end The end of the range to apply the functor to.
+ * \param[in] functor The functor to apply to the range.
+ *
+ * \return Nothing if application of the functor to the range succeeded.
+ * \return The first error reported by the functor if application of the functor to the
+ *         range failed. Elements are processed concurrently, so the error may not be the
+ *         error for the earliest failing element.
+ */
+template<typename Iterator, typename Functor>
+auto for_each( Thread_Pool & pool, Iterator begin, Iterator end, Functor const & functor ) noexcept
+    -> Result<Void, typename std::invoke_result_t<Functor, decltype( *std::declval<Iterator>() )>::Error>
+{
+    static_assert( std::is_base_of_v<Random_Access_Iterator_Tag, typename Iterator_Traits<Iterator>::Iterator_Category> );
+
+    using Error = typename std::invoke_result_t<Functor, decltype( *std::declval<Iterator>() )>::Error;
+
+    auto const size   = static_cast<std::size_t>( end - begin );
+    auto const chunks = chunk_count( pool, size );
+    auto       status = Job_Status<Error>{};
+
+    pool.run( chunks, [ & ]( std::size_t chunk ) noexcept {
+        auto       element = begin + static_cast<std::ptrdiff_t>( chunk * size / chunks );
+        auto const last = begin + static_cast<std::ptrdiff_t>( ( chunk + 1 ) * size / chunks );
+
+        for ( ; element != last and not status.stopped(); ++element ) {
+            if constexpr ( std::is_same_v<Error, Void> ) {
+                static_cast<void>( functor( *element ) );
+            } else {
+                auto result = functor( *element );
+                if ( result.is_error() ) {
+                    status.report( result.error() );
+
+                    return;
+                } // if
+            }     // else
+        }         // for
+    } );
+
+    if constexpr ( not std::is_same_v<Error, Void> ) {
+        if ( status.error() ) {
+            return *status.error();
+        } // if
+    }     // if
+
+    return {};
+}
+
+/**
+ * \brief Fill a range with values generated by a functor in parallel.
+ *
+ * \tparam Iterator Range iterator. Must be a random access iterator.
+ * \tparam Functor A nullary functor that returns either picolibrary::Result<Foo,
+ *         picolibrary::Error_Code> or picolibrary::Result<Foo, picolibrary::Void> where
+ *         Foo is a type that can be assigned to a dereferenced Iterator. It must be safe
+ *         to call concurrently from multiple threads of execution, and the order in which
+ *         the range's elements are generated is unspecified. If an error is returned by
+ *         the functor, the remaining elements are skipped and an error is returned.
+ *
+ * \param[out] begin The beginning of the range to fill.
+ * \param[out] end The end of the range to fill.
+ * \param[in] pool The thread pool to use.
+ * \param[in] functor The functor to use to generate the values used to fill the range.
+ *
+ * \return Nothing if filling the range succeeded.
+ * \return The first error reported by the functor if filling the range failed.
+ */
+template<typename Iterator, typename Functor>
+auto generate( Thread_Pool & pool, Iterator begin, Iterator end, Functor const & functor ) noexcept
+    -> Result<Void, typename std::invoke_result_t<Functor>::Error>
+{
+    static_assert( std::is_base_of_v<Random_Access_Iterator_Tag, typename Iterator_Traits<Iterator>::Iterator_Category> );
+
+    using Error = typename std::invoke_result_t<Functor>::Error;
+
+    auto const size   = static_cast<std::size_t>( end - begin );
+    auto const chunks = chunk_count( pool, size );
+    auto       status = Job_Status<Error>{};
+
+    pool.run( chunks, [ & ]( std::size_t chunk ) noexcept {
+        auto       element = begin + static_cast<std::ptrdiff_t>( chunk * size / chunks );
+        auto const last = begin + static_cast<std::ptrdiff_t>( ( chunk + 1 ) * size / chunks );
+
+        for ( ; element != last and not status.stopped(); ++element ) {
+            auto result = functor();
+            if constexpr ( not std::is_same_v<Error, Void> ) {
+                if ( result.is_error() ) {
+                    status.report( result.error() );
+
+                    return;
+                } // if
+            }     // if
+
+            *element = std::move( result ).value();
+        } // for
+    } );
+
+    if constexpr ( not std::is_same_v<Error, Void> ) {
+        if ( status.error() ) {
+            return *status.error();
+        } // if
+    }     // if
+
+    return {};
+}
+
+/**
+ * \brief Transform each element of a range, and reduce the transformed elements, in
+ *        parallel.
+ *
+ * \tparam Iterator Range iterator. Must be a random access iterator.
+ * \tparam T The reduction type.
+ * \tparam Reduce A binary functor that combines two T values. It must be associative and
+ *         commutative, since the order in which transformed elements are combined is
+ *         unspecified. Illustrative signature:
+ * \code
+ * auto reduce( T a, T b ) noexcept -> T;
+ * \endcode
+ * \tparam Transform A unary functor that takes the iterated over type by value or const
+ *         reference, and returns either picolibrary::Result<T, picolibrary::Error_Code>
+ *         or picolibrary::Result<T, picolibrary::Void>. It must be safe to call
+ *         concurrently from multiple threads of execution. If an error is returned by the
+ *         functor, the remaining elements are skipped and an error is returned.
+ *
+ * \param[in] pool The thread pool to use.
+ * \param[in] begin The beginning of the range to transform and reduce.
+ * \param[in] end The end of the range to transform and reduce.
+ * \param[in] initial_value The initial value of the reduction.
+ * \param[in] reduce The functor used to combine values.
+ * \param[in] transform The functor used to transform elements.
+ *
+ * \return The reduction of initial_value and the transformed elements if transforming
+ *         every element succeeded.
+ * \return The first error reported by the transform functor if transforming an element
+ *         failed.
+ */
+template<typename Iterator, typename T, typename Reduce, typename Transform>
+auto transform_reduce( Thread_Pool & pool, Iterator begin, Iterator end, T initial_value, Reduce const & reduce, Transform const & transform ) noexcept
+    -> Result<T, typename std::invoke_result_t<Transform, decltype( *std::declval<Iterator>() )>::Error>
+{
+    static_assert( std::is_base_of_v<Random_Access_Iterator_Tag, typename Iterator_Traits<Iterator>::Iterator_Category> );
+
+    using Error = typename std::invoke_result_t<Transform, decltype( *std::declval<Iterator>() )>::Error;
+
+    auto const size   = static_cast<std::size_t>( end - begin );
+    auto const chunks = chunk_count( pool, size );
+    auto       status = Job_Status<Error>{};
+    auto       mutex  = std::mutex{};
+
+    pool.run( chunks, [ & ]( std::size_t chunk ) noexcept {
+        auto       element = begin + static_cast<std::ptrdiff_t>( chunk * size / chunks );
+        auto const last = begin + static_cast<std::ptrdiff_t>( ( chunk + 1 ) * size / chunks );
+
+        auto partial = std::optional<T>{};
+
+        for ( ; element != last and not status.stopped(); ++element ) {
+            auto result = transform( *element );
+            if constexpr ( not std::is_same_v<Error, Void> ) {
+                if ( result.is_error() ) {
+                    status.report( result.error() );
+
+                    return;
+                } // if
+            }     // if
+
+            partial = partial ? reduce( std::move( *partial ), std::move( result ).value() )
+                              : std::move( result ).value();
+        } // for
+
+        if ( partial ) {
+            auto const guard = std::lock_guard<std::mutex>{ mutex };
+
+            initial_value = reduce( std::move( initial_value ), std::move( *partial ) );
+        } // if
+    } );
+
+    if constexpr ( not std::is_same_v<Error, Void> ) {
+        if ( status.error() ) {
+            return *status.error();
+        } // if
+    }     // if
+
+    return initial_value;
+}
+
+} // namespace picolibrary::Parallel
+
+#endif // PICOLIBRARY_PARALLEL_H
@@ -0,0 +1,111 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Posix interface.
+ *
+ * \attention The facilities in this header require a POSIX host, and are only available
+ *            if PICOLIBRARY_ENABLE_POSIX is enabled.
+ */
+
+#ifndef PICOLIBRARY_POSIX_H
+#define PICOLIBRARY_POSIX_H
+
+#include "picolibrary/error.h"
+
+/**
+ * \brief POSIX host facilities.
+ */
+namespace picolibrary::Posix {
+
+/**
+ * \brief POSIX errno error category.
+ *
+ * The error IDs in this category are errno values.
+ */
+class Errno_Category final : public Error_Category {
+  public:
+    /**
+     * \brief Get a reference to the errno error category instance.
+     *
+     * \return A reference to the errno error category instance.
+     */
+    static constexpr auto const & instance() noexcept
+    {
+        return INSTANCE;
+    }
+
+    Errno_Category( Errno_Category && ) = delete;
+
+    Errno_Category( Errno_Category const & ) = delete;
+
+    auto operator=( Errno_Category && ) = delete;
+
+    auto operator=( Errno_Category const & ) = delete;
+
+#ifndef PICOLIBRARY_SUPPRESS_HUMAN_READABLE_ERROR_INFORMATION
+    /**
+     * \copydoc picolibrary::Error_Category::name()
+     */
+    virtual auto name() const noexcept -> char const * override final
+    {
+        return "::picolibrary::Posix::Errno";
+    }
+#endif // PICOLIBRARY_SUPPRESS_HUMAN_READABLE_ERROR_INFORMATION
+
+#ifndef PICOLIBRARY_SUPPRESS_HUMAN_READABLE_ERROR_INFORMATION
+    /**
+     * \copydoc picolibrary::Error_Category::error_description()
+     */
+    virtual auto error_description( Error_ID id ) const noexcept -> char const * override final;
+#endif // PICOLIBRARY_SUPPRESS_HUMAN_READABLE_ERROR_INFORMATION
+
+  private:
+    /**
+     * \brief The errno error category instance.
+     */
+    static Errno_Category const INSTANCE;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Errno_Category() noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Errno_Category() noexcept = default;
+};
+
+/**
+ * \brief Build an error code from an errno value.
+ *
+ * \relatedalso picolibrary::Posix::Errno_Category
+ *
+ * \param[in] error The errno value to build the error code from.
+ *
+ * \return The built error code.
+ */
+inline auto make_errno_error_code( int error ) noexcept
+{
+    return Error_Code{ Errno_Category::instance(), static_cast<Error_ID>( error ) };
+}
+
+} // namespace picolibrary::Posix
+
+#endif // PICOLIBRARY_POSIX_H
@@ -54,6 +54,52 @@ struct Value_Tag {
  */
 constexpr auto VALUE = Value_Tag{};
 
+#ifdef PICOLIBRARY_ENABLE_ERROR_STATISTICS
+/**
+ * \brief Record an error with the picolibrary::Error_Statistics::instance() error
+ *        statistics.
+ *
+ * \param[in] error The error to record.
+ */
+void record_error( Error_Code const & error ) noexcept;
+
+/**
+ * \brief Check if constructing an error code from a set of arguments creates a new error
+ *        (true), or copies an existing error code while it is being propagated (false).
+ *
+ * \tparam Arguments The error code constructor argument types.
+ */
+template<typename... Arguments>
+constexpr auto creates_error_v = true;
+
+/**
+ * \copydoc picolibrary::creates_error_v
+ */
+template<typename Argument>
+constexpr auto creates_error_v<Argument> = not std::is_same_v<std::decay_t<Argument>, Error_Code>;
+#endif // PICOLIBRARY_ENABLE_ERROR_STATISTICS
+
+/**
+ * \brief Report a failure using an existing error code.
+ *
+ * Errors are recorded with the error statistics when a picolibrary::Result is constructed
+ * from something other than an error code (e.g. an error code enum). Propagating an
+ * existing error code is not recorded, so a function that reports a new failure using a
+ * stored error code must pass the error code through this function.
+ *
+ * \param[in] error The error code to report.
+ *
+ * \return The error code to report.
+ */
+inline auto make_error( Error_Code const & error ) noexcept -> Error_Code
+{
+#ifdef PICOLIBRARY_ENABLE_ERROR_STATISTICS
+    record_error( error );
+#endif // PICOLIBRARY_ENABLE_ERROR_STATISTICS
+
+    return error;
+}
+
 /**
  * \brief Operation result wrapper.
  *
@@ -213,6 +259,11 @@ class [[nodiscard]] Result<Void, Error_Code, true> final
         m_is_value{ false },
         m_error{ std::forward<E>( error ) }
     {
+#ifdef PICOLIBRARY_ENABLE_ERROR_STATISTICS
+        if constexpr ( creates_error_v<E> ) {
+            record_error( m_error );
+        } // if
+#endif // PICOLIBRARY_ENABLE_ERROR_STATISTICS
     }
 
     /**
@@ -227,6 +278,11 @@ class [[nodiscard]] Result<Void, Error_Code, true> final
         m_is_value{ false },
         m_error{ std::forward<Arguments>( arguments )... }
     {
+#ifdef PICOLIBRARY_ENABLE_ERROR_STATISTICS
+        if constexpr ( creates_error_v<Arguments...> ) {
+            record_error( m_error );
+        } // if
+#endif // PICOLIBRARY_ENABLE_ERROR_STATISTICS
     }
 
     /**
@@ -889,6 +945,11 @@ class [[nodiscard]] Result<Value_Type, Error_Code, true> final
         m_is_value{ false },
         m_error{ std::forward<E>( error ) }
     {
+#ifdef PICOLIBRARY_ENABLE_ERROR_STATISTICS
+        if constexpr ( creates_error_v<E> ) {
+            record_error( m_error );
+        } // if
+#endif // PICOLIBRARY_ENABLE_ERROR_STATISTICS
     }
 
     /**
@@ -903,6 +964,11 @@ class [[nodiscard]] Result<Value_Type, Error_Code, true> final
         m_is_value{ false },
         m_error{ std::forward<Arguments>( arguments )... }
     {
+#ifdef PICOLIBRARY_ENABLE_ERROR_STATISTICS
+        if constexpr ( creates_error_v<Arguments...> ) {
+            record_error( m_error );
+        } // if
+#endif // PICOLIBRARY_ENABLE_ERROR_STATISTICS
     }
 
     /**
@@ -1242,6 +1308,11 @@ class [[nodiscard]] Result<Value_Type, Error_Code, false> final
         m_is_value{ false },
         m_error{ std::forward<E>( error ) }
     {
+#ifdef PICOLIBRARY_ENABLE_ERROR_STATISTICS
+        if constexpr ( creates_error_v<E> ) {
+            record_error( m_error );
+        } // if
+#endif // PICOLIBRARY_ENABLE_ERROR_STATISTICS
     }
 
     /**
@@ -1256,6 +1327,11 @@ class [[nodiscard]] Result<Value_Type, Error_Code, false> final
         m_is_value{ false },
         m_error{ std::forward<Arguments>( arguments )... }
     {
+#ifdef PICOLIBRARY_ENABLE_ERROR_STATISTICS
+        if constexpr ( creates_error_v<Arguments...> ) {
+            record_error( m_error );
+        } // if
+#endif // PICOLIBRARY_ENABLE_ERROR_STATISTICS
     }
 
     /**
@@ -1516,6 +1592,247 @@ class [[nodiscard]] Result<Value_Type, Error_Code, false> final
     };
 };
 
+/**
+ * \brief Operation result combinator implementation details.
+ */
+namespace Implementation {
+
+/**
+ * \brief Get the error type that can hold the errors of two operation result types.
+ *
+ * \tparam First_Error The first operation failed result type.
+ * \tparam Second_Error The second operation failed result type.
+ */
+template<typename First_Error, typename Second_Error>
+struct common_error {
+    /**
+     * \brief The error type that can hold the errors of both operation result types.
+     */
+    using type = std::conditional_t<std::is_same_v<First_Error, Void>, Second_Error, First_Error>;
+};
+
+/**
+ * \copydoc picolibrary::Implementation::common_error
+ */
+template<typename First_Error, typename Second_Error>
+using common_error_t = typename common_error<First_Error, Second_Error>::type;
+
+/**
+ * \brief Invoke a functor with the value of a successful operation result (or with no
+ *        arguments if the operation generates no information).
+ *
+ * \tparam Result_Type The operation result type.
+ * \tparam Functor The functor type.
+ *
+ * \pre The operation succeeded.
+ *
+ * \param[in] result The operation result.
+ * \param[in] functor The functor to invoke.
+ *
+ * \return The value returned by the functor.
+ */
+template<typename Result_Type, typename Functor>
+constexpr decltype( auto ) invoke_with_value( Result_Type && result, Functor && functor ) noexcept
+{
+    if constexpr ( std::is_same_v<typename std::decay_t<Result_Type>::Value, Void> ) {
+        static_cast<void>( result );
+
+        return std::forward<Functor>( functor )();
+    } else {
+        return std::forward<Functor>( functor )( std::forward<Result_Type>( result ).value() );
+    } // else
+}
+
+} // namespace Implementation
+
+/**
+ * \brief Chain an operation that depends on the value of a successful operation.
+ *
+ * \tparam Result_Type The operation result type.
+ * \tparam Functor A functor that takes the operation's value (or no arguments if the
+ *         operation generates no information), and returns a picolibrary::Result.
+ *
+ * \param[in] result The operation result.
+ * \param[in] functor The functor to invoke if the operation succeeded.
+ *
+ * \return The result returned by the functor if the operation succeeded.
+ * \return The operation's error if the operation failed.
+ */
+template<typename Result_Type, typename Functor>
+constexpr auto and_then( Result_Type && result, Functor && functor ) noexcept
+{
+    using Source      = std::decay_t<Result_Type>;
+    using Destination = std::decay_t<decltype( Implementation::invoke_with_value(
+        std::forward<Result_Type>( result ), std::forward<Functor>( functor ) ) )>;
+    using Chained = Result<typename Destination::Value, Implementation::common_error_t<typename Source::Error, typename Destination::Error>>;
+
+    if constexpr ( not std::is_same_v<typename Source::Error, Void> ) {
+        if ( result.is_error() ) {
+            return Chained{ ERROR, std::forward<Result_Type>( result ).error() };
+        } // if
+    }     // if
+
+    return Chained{ Implementation::invoke_with_value(
+        std::forward<Result_Type>( result ), std::forward<Functor>( functor ) ) };
+}
+
+/**
+ * \brief Transform the value of a successful operation.
+ *
+ * \tparam Result_Type The operation result type.
+ * \tparam Functor A functor that takes the operation's value (or no arguments if the
+ *         operation generates no information), and returns the transformed value (void
+ *         or picolibrary::Void if no information is generated).
+ *
+ * \param[in] result The operation result.
+ * \param[in] functor The functor to invoke if the operation succeeded.
+ *
+ * \return The transformed value if the operation succeeded.
+ * \return The operation's error if the operation failed.
+ */
+template<typename Result_Type, typename Functor>
+constexpr auto map( Result_Type && result, Functor && functor ) noexcept
+{
+    using Source = std::decay_t<Result_Type>;
+    using Value  = std::decay_t<decltype( Implementation::invoke_with_value(
+        std::forward<Result_Type>( result ), std::forward<Functor>( functor ) ) )>;
+    using Mapped = Result<std::conditional_t<std::is_void_v<Value>, Void, Value>, typename Source::Error>;
+
+    if constexpr ( not std::is_same_v<typename Source::Error, Void> ) {
+        if ( result.is_error() ) {
+            return Mapped{ ERROR, std::forward<Result_Type>( result ).error() };
+        } // if
+    }     // if
+
+    if constexpr ( std::is_void_v<Value> or std::is_same_v<Value, Void> ) {
+        Implementation::invoke_with_value( std::forward<Result_Type>( result ), std::forward<Functor>( functor ) );
+
+        return Mapped{};
+    } else {
+        return Mapped{ VALUE,
+                       Implementation::invoke_with_value(
+                           std::forward<Result_Type>( result ), std::forward<Functor>( functor ) ) };
+    } // else
+}
+
+/**
+ * \brief Transform the error of a failed operation.
+ *
+ * \tparam Result_Type The operation result type.
+ * \tparam Functor A functor that takes the operation's error, and returns the
+ *         transformed error.
+ *
+ * \param[in] result The operation result.
+ * \param[in] functor The functor to invoke if the operation failed.
+ *
+ * \return The operation's value if the operation succeeded.
+ * \return The transformed error if the operation failed.
+ */
+template<typename Result_Type, typename Functor>
+constexpr auto map_error( Result_Type && result, Functor && functor ) noexcept
+{
+    using Source = std::decay_t<Result_Type>;
+
+    if constexpr ( std::is_same_v<typename Source::Error, Void> ) {
+        static_cast<void>( functor );
+
+        return Source{ std::forward<Result_Type>( result ) };
+    } else {
+        using Mapped = Result<
+            typename Source::Value,
+            std::decay_t<std::invoke_result_t<Functor, decltype( std::forward<Result_Type>( result ).error() )>>>;
+
+        if ( result.is_error() ) {
+            return Mapped{ ERROR,
+                           std::forward<Functor>( functor )(
+                               std::forward<Result_Type>( result ).error() ) };
+        } // if
+
+        if constexpr ( std::is_same_v<typename Source::Value, Void> ) {
+            return Mapped{};
+        } else {
+            return Mapped{ VALUE, std::forward<Result_Type>( result ).value() };
+        } // else
+    }     // else
+}
+
+/**
+ * \brief Recover from a failed operation.
+ *
+ * \tparam Result_Type The operation result type.
+ * \tparam Functor A functor that takes the operation's error, and returns a
+ *         picolibrary::Result with the same value type as the operation.
+ *
+ * \param[in] result The operation result.
+ * \param[in] functor The functor to invoke if the operation failed.
+ *
+ * \return The operation's value if the operation succeeded.
+ * \return The result returned by the functor if the operation failed.
+ */
+template<typename Result_Type, typename Functor>
+constexpr auto or_else( Result_Type && result, Functor && functor ) noexcept
+{
+    using Source = std::decay_t<Result_Type>;
+
+    if constexpr ( std::is_same_v<typename Source::Error, Void> ) {
+        static_cast<void>( functor );
+
+        return Source{ std::forward<Result_Type>( result ) };
+    } else {
+        using Recovered = std::decay_t<
+            std::invoke_result_t<Functor, decltype( std::forward<Result_Type>( result ).error() )>>;
+
+        static_assert( std::is_same_v<typename Recovered::Value, typename Source::Value> );
+
+        if ( result.is_error() ) {
+            return Recovered{ std::forward<Functor>( functor )(
+                std::forward<Result_Type>( result ).error() ) };
+        } // if
+
+        if constexpr ( std::is_same_v<typename Source::Value, Void> ) {
+            return Recovered{};
+        } else {
+            return Recovered{ VALUE, std::forward<Result_Type>( result ).value() };
+        } // else
+    }     // else
+}
+
+/**
+ * \brief Perform a sequence of operations, halting at the first operation that fails.
+ *
+ * \tparam Functor A nullary functor that returns a picolibrary::Result.
+ *
+ * \param[in] functor The last operation in the sequence.
+ *
+ * \return The result of the last operation in the sequence.
+ */
+template<typename Functor>
+constexpr auto sequence( Functor && functor ) noexcept
+{
+    return std::forward<Functor>( functor )();
+}
+
+/**
+ * \brief Perform a sequence of operations, halting at the first operation that fails.
+ *
+ * \tparam Functor A nullary functor that returns a picolibrary::Result.
+ * \tparam Functors Nullary functors that return picolibrary::Result.
+ *
+ * \param[in] functor The first operation in the sequence. The value generated by this
+ *            operation (if any) is discarded.
+ * \param[in] functors The remaining operations in the sequence.
+ *
+ * \return The result of the last operation in the sequence if all operations succeeded.
+ * \return The error of the first operation that failed if an operation failed.
+ */
+template<typename Functor, typename... Functors>
+constexpr auto sequence( Functor && functor, Functors &&... functors ) noexcept
+{
+    return and_then( std::forward<Functor>( functor )(), [ &functors... ]( auto &&... ) noexcept {
+        return sequence( std::forward<Functors>( functors )... );
+    } );
+}
+
 } // namespace picolibrary
 
 #endif // PICOLIBRARY_RESULT_H
@@ -0,0 +1,399 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Span interface.
+ */
+
+#ifndef PICOLIBRARY_SPAN_H
+#define PICOLIBRARY_SPAN_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "picolibrary/iterator.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Non-owning view of a contiguous sequence of elements.
+ *
+ * \tparam T The element type (const qualified for a read-only view).
+ */
+template<typename T>
+class Span {
+  public:
+    /**
+     * \brief The element type.
+     */
+    using Value = T;
+
+    /**
+     * \brief The number of elements in the span.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief A span element position.
+     */
+    using Position = std::size_t;
+
+    /**
+     * \brief A reference to a span element.
+     */
+    using Reference = Value &;
+
+    /**
+     * \brief A pointer to a span element.
+     */
+    using Pointer = Value *;
+
+    /**
+     * \brief A span iterator.
+     */
+    using Iterator = Pointer;
+
+    /**
+     * \brief A span reverse iterator.
+     */
+    using Reverse_Iterator = ::picolibrary::Reverse_Iterator<Iterator>;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Span() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] begin The beginning of the sequence.
+     * \param[in] end The end of the sequence.
+     */
+    constexpr Span( Pointer begin, Pointer end ) noexcept :
+        m_data{ begin },
+        m_size{ static_cast<Size>( end - begin ) }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] data The beginning of the sequence.
+     * \param[in] size The number of elements in the sequence.
+     */
+    constexpr Span( Pointer data, Size size ) noexcept : m_data{ data }, m_size{ size }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \tparam U The array element type.
+     * \tparam N The number of elements in the array.
+     *
+     * \param[in] array The array to view.
+     */
+    template<typename U, std::size_t N, typename = std::enable_if_t<std::is_convertible_v<U ( * )[], Value ( * )[]>>>
+    constexpr Span( U ( &array )[ N ] ) noexcept : m_data{ array }, m_size{ N }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \tparam Container A contiguous container (e.g. picolibrary::Fixed_Size_Array or
+     *         picolibrary::Fixed_Capacity_Vector) whose data() member function returns a
+     *         pointer that is convertible to Pointer.
+     *
+     * \param[in] container The container to view.
+     */
+    template<
+        typename Container,
+        typename = std::enable_if_t<
+            not std::is_same_v<std::remove_cv_t<Container>, Span>
+            and std::is_convertible_v<std::remove_pointer_t<decltype( std::declval<Container &>().data() )> ( * )[], Value ( * )[]>>>
+    constexpr Span( Container & container ) noexcept :
+        m_data{ container.data() },
+        m_size{ static_cast<Size>( container.size() ) }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \tparam U The viewed span's element type.
+     *
+     * \param[in] span The span to view (e.g. a picolibrary::Span<std::uint8_t> slice to be
+     *            viewed as a picolibrary::Byte_View).
+     */
+    template<
+        typename U,
+        typename = std::enable_if_t<not std::is_same_v<U, Value> and std::is_convertible_v<U ( * )[], Value ( * )[]>>>
+    constexpr Span( Span<U> const & span ) noexcept :
+        m_data{ span.data() },
+        m_size{ span.size() }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Span( Span && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Span( Span const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Span() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Span && expression ) noexcept -> Span & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Span const & expression ) noexcept -> Span & = default;
+
+    /**
+     * \brief Access the element at the specified position in the span.
+     *
+     * \warning Bounds checking is not performed.
+     *
+     * \param[in] position The position of the span element to access.
+     *
+     * \return The element at the specified position in the span.
+     */
+    constexpr auto operator[]( Position position ) const noexcept -> Reference
+    {
+        return m_data[ position ];
+    }
+
+    /**
+     * \brief Access the first element of the span.
+     *
+     * \warning Calling this function on an empty span results in undefined behavior.
+     *
+     * \return The first element of the span.
+     */
+    constexpr auto front() const noexcept -> Reference
+    {
+        return *begin();
+    }
+
+    /**
+     * \brief Access the last element of the span.
+     *
+     * \warning Calling this function on an empty span results in undefined behavior.
+     *
+     * \return The last element of the span.
+     */
+    constexpr auto back() const noexcept -> Reference
+    {
+        return *( end() - 1 );
+    }
+
+    /**
+     * \brief Access the viewed sequence.
+     *
+     * \return The viewed sequence.
+     */
+    constexpr auto data() const noexcept -> Pointer
+    {
+        return m_data;
+    }
+
+    /**
+     * \brief Get an iterator to the first element of the span.
+     *
+     * \return An iterator to the first element of the span.
+     */
+    constexpr auto begin() const noexcept -> Iterator
+    {
+        return m_data;
+    }
+
+    /**
+     * \brief Get an iterator to the element following the last element of the span.
+     *
+     * \warning Attempting to access the element following the last element of a span
+     *          results in undefined behavior.
+     *
+     * \return An iterator to the element following the last element of the span.
+     */
+    constexpr auto end() const noexcept -> Iterator
+    {
+        return m_data + m_size;
+    }
+
+    /**
+     * \brief Get an iterator to the first element of the reversed span.
+     *
+     * \return An iterator to the first element of the reversed span.
+     */
+    constexpr auto rbegin() const noexcept
+    {
+        return Reverse_Iterator{ end() };
+    }
+
+    /**
+     * \brief Get an iterator to the element following the last element of the reversed
+     *        span.
+     *
+     * \warning Attempting to access the element following the last element of a reversed
+     *          span results in undefined behavior.
+     *
+     * \return An iterator to the element following the last element of the reversed
+     *         span.
+     */
+    constexpr auto rend() const noexcept
+    {
+        return Reverse_Iterator{ begin() };
+    }
+
+    /**
+     * \brief Check if the span is empty.
+     *
+     * \return true if the span is empty.
+     * \return false if the span is not empty.
+     */
+    [[nodiscard]] constexpr auto empty() const noexcept
+    {
+        return not m_size;
+    }
+
+    /**
+     * \brief Get the number of elements in the span.
+     *
+     * \return The number of elements in the span.
+     */
+    constexpr auto size() const noexcept -> Size
+    {
+        return m_size;
+    }
+
+    /**
+     * \brief Get the size of the viewed sequence in bytes.
+     *
+     * \return The size of the viewed sequence in bytes.
+     */
+    constexpr auto size_bytes() const noexcept -> Size
+    {
+        return m_size * sizeof( Value );
+    }
+
+    /**
+     * \brief Get a span of the first elements of the span.
+     *
+     * \warning If size is greater than the number of elements in the span, the behavior
+     *          is undefined.
+     *
+     * \param[in] size The number of elements in the span to get.
+     *
+     * \return A span of the first size elements of the span.
+     */
+    constexpr auto first( Size size ) const noexcept -> Span
+    {
+        return { m_data, size };
+    }
+
+    /**
+     * \brief Get a span of the last elements of the span.
+     *
+     * \warning If size is greater than the number of elements in the span, the behavior
+     *          is undefined.
+     *
+     * \param[in] size The number of elements in the span to get.
+     *
+     * \return A span of the last size elements of the span.
+     */
+    constexpr auto last( Size size ) const noexcept -> Span
+    {
+        return { m_data + ( m_size - size ), size };
+    }
+
+    /**
+     * \brief Get a span of the elements of the span that follow a position.
+     *
+     * \warning If position is greater than the number of elements in the span, the
+     *          behavior is undefined.
+     *
+     * \param[in] position The position of the first element in the span to get.
+     *
+     * \return A span of the elements of the span that follow position.
+     */
+    constexpr auto subspan( Position position ) const noexcept -> Span
+    {
+        return { m_data + position, m_size - position };
+    }
+
+    /**
+     * \brief Get a span of the elements of the span that follow a position.
+     *
+     * \warning If position + size is greater than the number of elements in the span,
+     *          the behavior is undefined.
+     *
+     * \param[in] position The position of the first element in the span to get.
+     * \param[in] size The number of elements in the span to get.
+     *
+     * \return A span of size elements of the span starting at position.
+     */
+    constexpr auto subspan( Position position, Size size ) const noexcept -> Span
+    {
+        return { m_data + position, size };
+    }
+
+  private:
+    /**
+     * \brief The viewed sequence.
+     */
+    Pointer m_data{};
+
+    /**
+     * \brief The number of elements in the viewed sequence.
+     */
+    Size m_size{};
+};
+
+/**
+ * \brief Read-only view of a contiguous sequence of bytes.
+ */
+using Byte_View = Span<std::uint8_t const>;
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_SPAN_H
@@ -29,6 +29,8 @@
 #include "picolibrary/algorithm.h"
 #include "picolibrary/error.h"
 #include "picolibrary/result.h"
+#include "picolibrary/span.h"
+#include "picolibrary/trace.h"
 #include "picolibrary/void.h"
 
 /**
@@ -291,6 +293,23 @@ class Controller : public Basic_Controller {
             rx_begin, rx_end, [ & ]() noexcept { return exchange( *tx_begin++ ); } );
     }
 
+    /**
+     * \brief Exchange a block of data with a device.
+     *
+     * \param[in] tx The block of data to transmit.
+     * \param[out] rx The block of received data.
+     *
+     * \warning This function does not verify that the transmit and receive data blocks
+     *          are the same size.
+     *
+     * \return Nothing if data exchange succeeded.
+     * \return An error code if data exchange failed.
+     */
+    auto exchange( Byte_View tx, Span<std::uint8_t> rx ) noexcept
+    {
+        return exchange( tx.begin(), tx.end(), rx.begin(), rx.end() );
+    }
+
     /**
      * \brief Receive data from a device.
      *
@@ -317,6 +336,19 @@ class Controller : public Basic_Controller {
             begin, end, [ this ]() noexcept { return receive(); } );
     }
 
+    /**
+     * \brief Receive a block of data from a device.
+     *
+     * \param[out] data The block of received data.
+     *
+     * \return Nothing if data reception succeeded.
+     * \return An error code if data reception failed.
+     */
+    auto receive( Span<std::uint8_t> data ) noexcept
+    {
+        return receive( data.begin(), data.end() );
+    }
+
     /**
      * \brief Transmit data to a device.
      *
@@ -328,12 +360,7 @@ class Controller : public Basic_Controller {
     auto transmit( std::uint8_t data ) noexcept
         -> Result<Void, typename decltype( std::declval<Basic_Controller>().exchange( std::declval<std::uint8_t>() ) )::Error>
     {
-        auto result = exchange( data );
-        if ( result.is_error() ) {
-            return result.error();
-        } // if
-
-        return {};
+        return map( exchange( data ), []( auto ) noexcept {} );
     }
 
     /**
@@ -350,6 +377,19 @@ class Controller : public Basic_Controller {
         return for_each<Discard_Functor>(
             begin, end, [ this ]( auto data ) noexcept { return transmit( data ); } );
     }
+
+    /**
+     * \brief Transmit a block of data to a device.
+     *
+     * \param[in] data The block of data to transmit.
+     *
+     * \return Nothing if data transmission succeeded.
+     * \return An error code if data transmission failed.
+     */
+    auto transmit( Byte_View data ) noexcept
+    {
+        return transmit( data.begin(), data.end() );
+    }
 };
 
 /**
@@ -511,6 +551,8 @@ class Device_Selection_Guard {
     {
         if ( m_device_selector ) {
             static_cast<void>( m_device_selector->deselect() );
+
+            PICOLIBRARY_TRACE_END( "SPI::Device_Selection_Guard" );
         } // if
     }
 
@@ -521,11 +563,13 @@ class Device_Selection_Guard {
      *
      * \return The assigned to object.
      */
-    constexpr auto & operator=( Device_Selection_Guard && expression ) noexcept
+    auto & operator=( Device_Selection_Guard && expression ) noexcept
     {
         if ( &expression != this ) {
             if ( m_device_selector ) {
                 static_cast<void>( m_device_selector->deselect() );
+
+                PICOLIBRARY_TRACE_END( "SPI::Device_Selection_Guard" );
             } // if
 
             m_device_selector = expression.m_device_selector;
@@ -556,9 +600,10 @@ class Device_Selection_Guard {
      * \param[in] device_selector The device selector used to select and deselect the
      *            device.
      */
-    constexpr Device_Selection_Guard( Device_Selector & device_selector ) noexcept :
+    Device_Selection_Guard( Device_Selector & device_selector ) noexcept :
         m_device_selector{ &device_selector }
     {
+        PICOLIBRARY_TRACE_BEGIN( "SPI::Device_Selection_Guard" );
     }
 };
 
@@ -568,12 +613,9 @@ auto make_device_selection_guard( Device_Selector & device_selector ) noexcept -
     typename decltype( std::declval<Device_Selector>().select() )::Error,
     false>
 {
-    auto result = device_selector.select();
-    if ( result.is_error() ) {
-        return result.error();
-    } // if
-
-    return Device_Selection_Guard{ device_selector };
+    return map( device_selector.select(), [ &device_selector ]() noexcept {
+        return Device_Selection_Guard{ device_selector };
+    } );
 }
 
 /**
@@ -728,6 +770,23 @@ class Device {
         return m_controller->exchange( tx_begin, tx_end, rx_begin, rx_end );
     }
 
+    /**
+     * \brief Exchange a block of data with the device.
+     *
+     * \param[in] tx The block of data to transmit.
+     * \param[out] rx The block of received data.
+     *
+     * \warning This function may not verify that the transmit and receive data blocks are
+     *          the same size.
+     *
+     * \return Nothing if data exchange succeeded.
+     * \return The error reported by the controller if data exchange failed.
+     */
+    auto exchange( Byte_View tx, Span<std::uint8_t> rx ) const noexcept
+    {
+        return exchange( tx.begin(), tx.end(), rx.begin(), rx.end() );
+    }
+
     /**
      * \brief Receive data from the device.
      *
@@ -753,6 +812,19 @@ class Device {
         return m_controller->receive( begin, end );
     }
 
+    /**
+     * \brief Receive a block of data from the device.
+     *
+     * \param[out] data The block of received data.
+     *
+     * \return Nothing if data reception succeeded.
+     * \return The error reported by the controller if data reception failed.
+     */
+    auto receive( Span<std::uint8_t> data ) const noexcept
+    {
+        return receive( data.begin(), data.end() );
+    }
+
     /**
      * \brief Transmit data to the device.
      *
@@ -780,6 +852,19 @@ class Device {
         return m_controller->transmit( begin, end );
     }
 
+    /**
+     * \brief Transmit a block of data to the device.
+     *
+     * \param[in] data The block of data to transmit.
+     *
+     * \return Nothing if data transmission succeeded.
+     * \return The error reported by the controller if data transmission failed.
+     */
+    auto transmit( Byte_View data ) const noexcept
+    {
+        return transmit( data.begin(), data.end() );
+    }
+
   private:
     /**
      * \brief The controller used to communicate with the device.
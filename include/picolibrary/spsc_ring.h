@@ -0,0 +1,505 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::SPSC_Ring interface.
+ */
+
+#ifndef PICOLIBRARY_SPSC_RING_H
+#define PICOLIBRARY_SPSC_RING_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+#include "picolibrary/utility.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Lock-free single producer, single consumer ring buffer.
+ *
+ * One thread of execution (e.g. an interrupt service routine) may push elements while
+ * one other thread of execution pops elements. The producer's and consumer's indices are
+ * placed in separate cache lines to prevent false sharing.
+ *
+ * In addition to single element push and pop, the producer can reserve a contiguous
+ * block of free elements, fill it in place, and then commit it, and the consumer can
+ * peek at a contiguous block of available elements, process it in place, and then
+ * consume it.
+ *
+ * \tparam T The ring buffer element type.
+ * \tparam N The ring buffer capacity. Must be a power of two.
+ */
+template<typename T, std::size_t N>
+class SPSC_Ring {
+  public:
+    static_assert( N and not( N & ( N - 1 ) ), "N must be a power of two" );
+
+    /**
+     * \brief The ring buffer element type.
+     */
+    using Value = T;
+
+    /**
+     * \brief The number of elements in the ring buffer.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief A pointer to a ring buffer element.
+     */
+    using Pointer = Value *;
+
+    /**
+     * \brief A pointer to a const ring buffer element.
+     */
+    using Const_Pointer = Value const *;
+
+    /**
+     * \brief A contiguous block of ring buffer elements.
+     */
+    class Block {
+      public:
+        /**
+         * \brief Constructor.
+         */
+        constexpr Block() noexcept = default;
+
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] begin The beginning of the block.
+         * \param[in] size The number of elements in the block.
+         */
+        constexpr Block( Pointer begin, Size size ) noexcept :
+            m_begin{ begin },
+            m_size{ size }
+        {
+        }
+
+        /**
+         * \brief Get an iterator to the first element of the block.
+         *
+         * \return An iterator to the first element of the block.
+         */
+        constexpr auto begin() const noexcept -> Pointer
+        {
+            return m_begin;
+        }
+
+        /**
+         * \brief Get an iterator to the element following the last element of the block.
+         *
+         * \return An iterator to the element following the last element of the block.
+         */
+        constexpr auto end() const noexcept -> Pointer
+        {
+            return m_begin + m_size;
+        }
+
+        /**
+         * \brief Check if the block is empty.
+         *
+         * \return true if the block is empty.
+         * \return false if the block is not empty.
+         */
+        [[nodiscard]] constexpr auto empty() const noexcept
+        {
+            return not m_size;
+        }
+
+        /**
+         * \brief Get the number of elements in the block.
+         *
+         * \return The number of elements in the block.
+         */
+        constexpr auto size() const noexcept -> Size
+        {
+            return m_size;
+        }
+
+      private:
+        /**
+         * \brief The beginning of the block.
+         */
+        Pointer m_begin{};
+
+        /**
+         * \brief The number of elements in the block.
+         */
+        Size m_size{};
+    };
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr SPSC_Ring() noexcept = default;
+
+    SPSC_Ring( SPSC_Ring && ) = delete;
+
+    SPSC_Ring( SPSC_Ring const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~SPSC_Ring() noexcept = default;
+
+    auto operator=( SPSC_Ring && ) = delete;
+
+    auto operator=( SPSC_Ring const & ) = delete;
+
+    /**
+     * \brief Get the ring buffer's capacity.
+     *
+     * \return The ring buffer's capacity.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Check if the ring buffer is empty.
+     *
+     * \attention The result is only a snapshot if called while the other thread of
+     *            execution is active.
+     *
+     * \return true if the ring buffer is empty.
+     * \return false if the ring buffer is not empty.
+     */
+    [[nodiscard]] auto empty() const noexcept
+    {
+        return not size();
+    }
+
+    /**
+     * \brief Check if the ring buffer is full.
+     *
+     * \attention The result is only a snapshot if called while the other thread of
+     *            execution is active.
+     *
+     * \return true if the ring buffer is full.
+     * \return false if the ring buffer is not full.
+     */
+    auto full() const noexcept
+    {
+        return size() == N;
+    }
+
+    /**
+     * \brief Get the number of elements in the ring buffer.
+     *
+     * \attention The result is only a snapshot if called while the other thread of
+     *            execution is active.
+     *
+     * \return The number of elements in the ring buffer.
+     */
+    auto size() const noexcept -> Size
+    {
+        // head must be loaded before tail so that tail can never lag behind it. Elements
+        // popped and pushed between the two loads can still make the difference
+        // exceed N, so it is clamped.
+        auto const head = m_consumer.head.load( std::memory_order_acquire );
+        auto const tail = m_producer.tail.load( std::memory_order_acquire );
+
+        return std::min<Size>( tail - head, N );
+    }
+
+    /**
+     * \brief Push an element into the ring buffer.
+     *
+     * \attention This function may only be called by the producer.
+     *
+     * \param[in] value The element to push into the ring buffer.
+     *
+     * \return true if the element was pushed into the ring buffer.
+     * \return false if the ring buffer is full.
+     */
+    auto push( Value const & value ) noexcept
+    {
+        return emplace( value );
+    }
+
+    /**
+     * \brief Push an element into the ring buffer.
+     *
+     * \attention This function may only be called by the producer.
+     *
+     * \param[in] value The element to push into the ring buffer.
+     *
+     * \return true if the element was pushed into the ring buffer.
+     * \return false if the ring buffer is full.
+     */
+    auto push( Value && value ) noexcept
+    {
+        return emplace( std::move( value ) );
+    }
+
+    /**
+     * \brief Push a range of elements into the ring buffer.
+     *
+     * \attention This function may only be called by the producer.
+     *
+     * \param[in] begin The beginning of the range of elements to push into the ring
+     *            buffer.
+     * \param[in] end The end of the range of elements to push into the ring buffer.
+     *
+     * \return The number of elements that were pushed into the ring buffer (less than
+     *         the number of elements in the range if the ring buffer became full).
+     */
+    auto push( Const_Pointer begin, Const_Pointer end ) noexcept -> Size
+    {
+        auto const size = static_cast<Size>( end - begin );
+
+        auto pushed = Size{};
+        for ( auto block = reserve(); pushed < size and not block.empty(); block = reserve() ) {
+            auto n = Size{};
+            for ( auto & element : block ) {
+                if ( pushed + n == size ) {
+                    break;
+                } // if
+
+                element = begin[ pushed + n++ ];
+            } // for
+
+            commit( n );
+
+            pushed += n;
+        } // for
+
+        return pushed;
+    }
+
+    /**
+     * \brief Reserve the largest contiguous block of free ring buffer elements.
+     *
+     * \attention This function may only be called by the producer.
+     *
+     * \return The reserved block (empty if the ring buffer is full). The block's
+     *         elements may be written in place, and then published to the consumer
+     *         with picolibrary::SPSC_Ring::commit().
+     */
+    auto reserve() noexcept -> Block
+    {
+        auto const tail = m_producer.tail.load( std::memory_order_relaxed );
+
+        if ( tail - m_producer.head == N ) {
+            m_producer.head = m_consumer.head.load( std::memory_order_acquire );
+        } // if
+
+        auto const index = tail & MASK;
+        auto const free  = N - ( tail - m_producer.head );
+
+        return { &m_buffer[ index ], free < N - index ? free : N - index };
+    }
+
+    /**
+     * \brief Publish reserved ring buffer elements to the consumer.
+     *
+     * \attention This function may only be called by the producer.
+     *
+     * \warning If size is greater than the size of the most recently reserved block, the
+     *          behavior is undefined.
+     *
+     * \param[in] size The number of reserved elements to publish.
+     */
+    void commit( Size size ) noexcept
+    {
+        m_producer.tail.store(
+            m_producer.tail.load( std::memory_order_relaxed ) + size, std::memory_order_release );
+    }
+
+    /**
+     * \brief Pop an element from the ring buffer.
+     *
+     * \attention This function may only be called by the consumer.
+     *
+     * \param[out] value The popped element.
+     *
+     * \return true if an element was popped from the ring buffer.
+     * \return false if the ring buffer is empty.
+     */
+    auto pop( Value & value ) noexcept
+    {
+        auto const block = peek();
+        if ( block.empty() ) {
+            return false;
+        } // if
+
+        value = std::move( *block.begin() );
+
+        consume( 1 );
+
+        return true;
+    }
+
+    /**
+     * \brief Pop a range of elements from the ring buffer.
+     *
+     * \attention This function may only be called by the consumer.
+     *
+     * \param[out] begin The beginning of the range to pop elements into.
+     * \param[out] end The end of the range to pop elements into.
+     *
+     * \return The number of elements that were popped from the ring buffer (less than
+     *         the number of elements in the range if the ring buffer became empty).
+     */
+    auto pop( Pointer begin, Pointer end ) noexcept -> Size
+    {
+        auto const size = static_cast<Size>( end - begin );
+
+        auto popped = Size{};
+        for ( auto block = peek(); popped < size and not block.empty(); block = peek() ) {
+            auto n = Size{};
+            for ( auto & element : block ) {
+                if ( popped + n == size ) {
+                    break;
+                } // if
+
+                begin[ popped + n++ ] = std::move( element );
+            } // for
+
+            consume( n );
+
+            popped += n;
+        } // for
+
+        return popped;
+    }
+
+    /**
+     * \brief Get the largest contiguous block of available ring buffer elements.
+     *
+     * \attention This function may only be called by the consumer.
+     *
+     * \return The available block (empty if the ring buffer is empty). The block's
+     *         elements may be read in place, and then released to the producer with
+     *         picolibrary::SPSC_Ring::consume().
+     */
+    auto peek() noexcept -> Block
+    {
+        auto const head = m_consumer.head.load( std::memory_order_relaxed );
+
+        if ( head == m_consumer.tail ) {
+            m_consumer.tail = m_producer.tail.load( std::memory_order_acquire );
+        } // if
+
+        auto const index     = head & MASK;
+        auto const available = m_consumer.tail - head;
+
+        return { &m_buffer[ index ], available < N - index ? available : N - index };
+    }
+
+    /**
+     * \brief Release available ring buffer elements to the producer.
+     *
+     * \attention This function may only be called by the consumer.
+     *
+     * \warning If size is greater than the size of the most recently peeked at block,
+     *          the behavior is undefined.
+     *
+     * \param[in] size The number of available elements to release.
+     */
+    void consume( Size size ) noexcept
+    {
+        m_consumer.head.store(
+            m_consumer.head.load( std::memory_order_relaxed ) + size, std::memory_order_release );
+    }
+
+  private:
+    /**
+     * \brief The mask used to convert an index to a ring buffer position.
+     */
+    static constexpr auto MASK = Size{ N - 1 };
+
+    /**
+     * \brief Producer state.
+     */
+    struct alignas( CACHE_LINE_SIZE ) Producer {
+        /**
+         * \brief The index of the next element to be written.
+         */
+        std::atomic<Size> tail{};
+
+        /**
+         * \brief The producer's cached copy of the consumer's index.
+         */
+        Size head{};
+    };
+
+    /**
+     * \brief Consumer state.
+     */
+    struct alignas( CACHE_LINE_SIZE ) Consumer {
+        /**
+         * \brief The index of the next element to be read.
+         */
+        std::atomic<Size> head{};
+
+        /**
+         * \brief The consumer's cached copy of the producer's index.
+         */
+        Size tail{};
+    };
+
+    /**
+     * \brief The producer's state.
+     */
+    Producer m_producer{};
+
+    /**
+     * \brief The consumer's state.
+     */
+    Consumer m_consumer{};
+
+    /**
+     * \brief The ring buffer elements.
+     */
+    alignas( CACHE_LINE_SIZE ) Value m_buffer[ N ]{};
+
+    /**
+     * \brief Push an element into the ring buffer.
+     *
+     * \tparam V The type of the element to push into the ring buffer.
+     *
+     * \param[in] value The element to push into the ring buffer.
+     *
+     * \return true if the element was pushed into the ring buffer.
+     * \return false if the ring buffer is full.
+     */
+    template<typename V>
+    auto emplace( V && value ) noexcept
+    {
+        auto const block = reserve();
+        if ( block.empty() ) {
+            return false;
+        } // if
+
+        *block.begin() = std::forward<V>( value );
+
+        commit( 1 );
+
+        return true;
+    }
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_SPSC_RING_H
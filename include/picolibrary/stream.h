@@ -30,6 +30,8 @@
 #include "picolibrary/algorithm.h"
 #include "picolibrary/error.h"
 #include "picolibrary/result.h"
+#include "picolibrary/span.h"
+#include "picolibrary/trace.h"
 #include "picolibrary/void.h"
 
 namespace picolibrary {
@@ -579,6 +581,23 @@ class Output_Stream : public Stream {
         return result;
     }
 
+    /**
+     * \brief Write a block of characters to the stream.
+     *
+     * \pre Neither an I/O error nor a fatal error is present. If either an I/O error or a
+     *      fatal error is present, picolibrary::Generic_Error::IO_STREAM_DEGRADED will be
+     *      returned.
+     *
+     * \param[in] data The block of characters to write to the stream.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( Span<char const> data ) noexcept -> Result<Void, Error_Code>
+    {
+        return put( data.begin(), data.end() );
+    }
+
     /**
      * \brief Write a null-terminated string to the stream.
      *
@@ -656,6 +675,23 @@ class Output_Stream : public Stream {
         return result;
     }
 
+    /**
+     * \brief Write a block of unsigned bytes to the stream.
+     *
+     * \pre Neither an I/O error nor a fatal error is present. If either an I/O error or a
+     *      fatal error is present, picolibrary::Generic_Error::IO_STREAM_DEGRADED will be
+     *      returned.
+     *
+     * \param[in] data The block of unsigned bytes to write to the stream.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( Byte_View data ) noexcept -> Result<Void, Error_Code>
+    {
+        return put( data.begin(), data.end() );
+    }
+
     /**
      * \brief Write a signed byte to the stream.
      *
@@ -707,6 +743,23 @@ class Output_Stream : public Stream {
         return result;
     }
 
+    /**
+     * \brief Write a block of signed bytes to the stream.
+     *
+     * \pre Neither an I/O error nor a fatal error is present. If either an I/O error or a
+     *      fatal error is present, picolibrary::Generic_Error::IO_STREAM_DEGRADED will be
+     *      returned.
+     *
+     * \param[in] data The block of signed bytes to write to the stream.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( Span<std::int8_t const> data ) noexcept -> Result<Void, Error_Code>
+    {
+        return put( data.begin(), data.end() );
+    }
+
     /**
      * \brief Write formatted output to the stream.
      *
@@ -750,6 +803,8 @@ class Output_Stream : public Stream {
      */
     auto flush() noexcept
     {
+        PICOLIBRARY_TRACE_SCOPE( "Output_Stream::flush" );
+
         auto result = buffer()->flush();
         if ( result.is_error() ) {
             report_fatal_error();
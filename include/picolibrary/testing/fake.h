@@ -0,0 +1,34 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Testing::Fake interface.
+ */
+
+#ifndef PICOLIBRARY_TESTING_FAKE_H
+#define PICOLIBRARY_TESTING_FAKE_H
+
+/**
+ * \brief Fake (lightweight, scriptable, allocation free, and mocking framework
+ *        independent) implementations of picolibrary concepts for use in unit tests and
+ *        benchmarks.
+ */
+namespace picolibrary::Testing::Fake {
+} // namespace picolibrary::Testing::Fake
+
+#endif // PICOLIBRARY_TESTING_FAKE_H
@@ -0,0 +1,229 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Testing::Fake::Bus_Timing_Estimator interface.
+ */
+
+#ifndef PICOLIBRARY_TESTING_FAKE_BUS_TIMING_H
+#define PICOLIBRARY_TESTING_FAKE_BUS_TIMING_H
+
+#include <cstdint>
+
+namespace picolibrary::Testing::Fake {
+
+/**
+ * \brief Bus timing estimator.
+ *
+ * The estimator accumulates the number of transactions, the number of bytes, and the
+ * number of bus clock cycles a sequence of bus operations would take on real hardware,
+ * and converts the number of bus clock cycles into an estimated duration using the bus
+ * clock frequency.
+ */
+class Bus_Timing_Estimator {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Bus_Timing_Estimator() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] clock_frequency The bus clock frequency (Hz).
+     *
+     * \warning A bus clock frequency of zero results in undefined behavior when an
+     *          estimated duration is requested.
+     */
+    constexpr explicit Bus_Timing_Estimator( std::uint_fast32_t clock_frequency ) noexcept
+        :
+        m_clock_frequency{ clock_frequency }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Bus_Timing_Estimator( Bus_Timing_Estimator && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Bus_Timing_Estimator( Bus_Timing_Estimator const & original ) noexcept =
+        default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Bus_Timing_Estimator() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Bus_Timing_Estimator && expression ) noexcept
+        -> Bus_Timing_Estimator & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Bus_Timing_Estimator const & expression ) noexcept
+        -> Bus_Timing_Estimator & = default;
+
+    /**
+     * \brief Get the bus clock frequency (Hz).
+     *
+     * \return The bus clock frequency (Hz).
+     */
+    constexpr auto clock_frequency() const noexcept
+    {
+        return m_clock_frequency;
+    }
+
+    /**
+     * \brief Get the number of transactions.
+     *
+     * \return The number of transactions.
+     */
+    constexpr auto transactions() const noexcept
+    {
+        return m_transactions;
+    }
+
+    /**
+     * \brief Get the number of bytes transferred.
+     *
+     * \return The number of bytes transferred.
+     */
+    constexpr auto bytes() const noexcept
+    {
+        return m_bytes;
+    }
+
+    /**
+     * \brief Get the number of bus clock cycles.
+     *
+     * \return The number of bus clock cycles.
+     */
+    constexpr auto cycles() const noexcept
+    {
+        return m_cycles;
+    }
+
+    /**
+     * \brief Get the estimated duration (nanoseconds, rounded up).
+     *
+     * \return The estimated duration (nanoseconds, rounded up).
+     */
+    constexpr auto nanoseconds() const noexcept -> std::uint_fast64_t
+    {
+        return ( m_cycles * 1'000'000'000 + m_clock_frequency - 1 ) / m_clock_frequency;
+    }
+
+    /**
+     * \brief Get the estimated duration (microseconds, rounded up).
+     *
+     * \return The estimated duration (microseconds, rounded up).
+     */
+    constexpr auto microseconds() const noexcept -> std::uint_fast64_t
+    {
+        return ( m_cycles * 1'000'000 + m_clock_frequency - 1 ) / m_clock_frequency;
+    }
+
+    /**
+     * \brief Record the start of a transaction.
+     *
+     * \param[in] cycles The number of bus clock cycles starting the transaction
+     *            takes.
+     */
+    constexpr void record_transaction( std::uint_fast32_t cycles ) noexcept
+    {
+        ++m_transactions;
+
+        m_cycles += cycles;
+    }
+
+    /**
+     * \brief Record the transfer of a byte.
+     *
+     * \param[in] cycles The number of bus clock cycles the transfer of the byte takes.
+     */
+    constexpr void record_byte( std::uint_fast32_t cycles ) noexcept
+    {
+        ++m_bytes;
+
+        m_cycles += cycles;
+    }
+
+    /**
+     * \brief Record bus overhead that is neither the start of a transaction nor the
+     *        transfer of a byte.
+     *
+     * \param[in] cycles The number of bus clock cycles the overhead takes.
+     */
+    constexpr void record_overhead( std::uint_fast32_t cycles ) noexcept
+    {
+        m_cycles += cycles;
+    }
+
+    /**
+     * \brief Reset the estimate (the bus clock frequency is retained).
+     */
+    constexpr void reset() noexcept
+    {
+        m_transactions = 0;
+        m_bytes        = 0;
+        m_cycles       = 0;
+    }
+
+  private:
+    /**
+     * \brief The bus clock frequency (Hz).
+     */
+    std::uint_fast32_t m_clock_frequency{ 1 };
+
+    /**
+     * \brief The number of transactions.
+     */
+    std::uint_fast32_t m_transactions{};
+
+    /**
+     * \brief The number of bytes transferred.
+     */
+    std::uint_fast32_t m_bytes{};
+
+    /**
+     * \brief The number of bus clock cycles.
+     */
+    std::uint_fast64_t m_cycles{};
+};
+
+} // namespace picolibrary::Testing::Fake
+
+#endif // PICOLIBRARY_TESTING_FAKE_BUS_TIMING_H
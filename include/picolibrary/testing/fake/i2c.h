@@ -0,0 +1,573 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Testing::Fake::I2C interface.
+ */
+
+#ifndef PICOLIBRARY_TESTING_FAKE_I2C_H
+#define PICOLIBRARY_TESTING_FAKE_I2C_H
+
+#include <cstdint>
+#include <utility>
+
+#include "picolibrary/error.h"
+#include "picolibrary/fixed_size_array.h"
+#include "picolibrary/i2c.h"
+#include "picolibrary/result.h"
+#include "picolibrary/testing/fake/bus_timing.h"
+#include "picolibrary/void.h"
+
+/**
+ * \brief Fake I2C facilities.
+ */
+namespace picolibrary::Testing::Fake::I2C {
+
+/**
+ * \brief Fake register file device I2C basic controller.
+ *
+ * The controller emulates a bus with a single device attached to it. The device has 256
+ * 8-bit registers and an auto-incrementing register pointer: the first byte written
+ * after the device is addressed for a write selects a register, subsequent writes write
+ * to the selected register, and reads read from the selected register. Addressing any
+ * other address fails with picolibrary::Generic_Error::NONRESPONSIVE_DEVICE.
+ *
+ * Bus protocol violations (e.g. addressing the device without first transmitting a
+ * start condition, or reading from the device after addressing it for a write) fail
+ * with picolibrary::Generic_Error::LOGIC_ERROR.
+ */
+class Fake_Basic_Controller {
+  public:
+    /**
+     * \brief The device's registers.
+     */
+    using Registers = Fixed_Size_Array<std::uint8_t, 256>;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Fake_Basic_Controller() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] address The address of the device attached to the bus.
+     */
+    constexpr explicit Fake_Basic_Controller( ::picolibrary::I2C::Address address ) noexcept
+        :
+        m_device_address{ address }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Fake_Basic_Controller( Fake_Basic_Controller && source ) noexcept = default;
+
+    Fake_Basic_Controller( Fake_Basic_Controller const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fake_Basic_Controller() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Fake_Basic_Controller && expression ) noexcept
+        -> Fake_Basic_Controller & = default;
+
+    auto operator=( Fake_Basic_Controller const & ) = delete;
+
+    /**
+     * \brief Get the address of the device attached to the bus.
+     *
+     * \return The address of the device attached to the bus.
+     */
+    constexpr auto device_address() const noexcept
+    {
+        return m_device_address;
+    }
+
+    /**
+     * \brief Access the device's registers.
+     *
+     * \return The device's registers.
+     */
+    constexpr auto & registers() noexcept
+    {
+        return m_registers;
+    }
+
+    /**
+     * \brief Access the device's registers.
+     *
+     * \return The device's registers.
+     */
+    constexpr auto const & registers() const noexcept
+    {
+        return m_registers;
+    }
+
+    /**
+     * \brief Get the number of transactions (start and repeated start conditions) that
+     *        have been transmitted.
+     *
+     * \return The number of transactions that have been transmitted.
+     */
+    constexpr auto transactions() const noexcept
+    {
+        return m_transactions;
+    }
+
+    /**
+     * \brief Make the next controller operation fail.
+     *
+     * \param[in] error The error the next controller operation should report.
+     */
+    constexpr void fail( Error_Code const & error ) noexcept
+    {
+        m_error = error;
+        m_fail  = true;
+    }
+
+    /**
+     * \copydoc picolibrary::I2C::Basic_Controller_Concept::initialize()
+     */
+    constexpr auto initialize() noexcept -> Result<Void, Error_Code>
+    {
+        if ( m_fail ) {
+            return failure();
+        } // if
+
+        m_state = State::IDLE;
+
+        return {};
+    }
+
+    /**
+     * \copydoc picolibrary::I2C::Basic_Controller_Concept::start()
+     */
+    constexpr auto start() noexcept -> Result<Void, Error_Code>
+    {
+        if ( m_fail ) {
+            return failure();
+        } // if
+
+        if ( m_state != State::IDLE ) {
+            return Generic_Error::LOGIC_ERROR;
+        } // if
+
+        m_state = State::STARTED;
+
+        ++m_transactions;
+
+        return {};
+    }
+
+    /**
+     * \copydoc picolibrary::I2C::Basic_Controller_Concept::repeated_start()
+     */
+    constexpr auto repeated_start() noexcept -> Result<Void, Error_Code>
+    {
+        if ( m_fail ) {
+            return failure();
+        } // if
+
+        if ( m_state == State::IDLE ) {
+            return Generic_Error::LOGIC_ERROR;
+        } // if
+
+        m_state = State::STARTED;
+
+        ++m_transactions;
+
+        return {};
+    }
+
+    /**
+     * \copydoc picolibrary::I2C::Basic_Controller_Concept::stop()
+     */
+    constexpr auto stop() noexcept -> Result<Void, Error_Code>
+    {
+        if ( m_fail ) {
+            return failure();
+        } // if
+
+        m_state = State::IDLE;
+
+        return {};
+    }
+
+    /**
+     * \copydoc picolibrary::I2C::Basic_Controller_Concept::address()
+     */
+    constexpr auto address(
+        ::picolibrary::I2C::Address   address,
+        ::picolibrary::I2C::Operation operation ) noexcept -> Result<Void, Error_Code>
+    {
+        if ( m_fail ) {
+            return failure();
+        } // if
+
+        if ( m_state != State::STARTED ) {
+            return Generic_Error::LOGIC_ERROR;
+        } // if
+
+        if ( address != m_device_address ) {
+            return Generic_Error::NONRESPONSIVE_DEVICE;
+        } // if
+
+        m_state = operation == ::picolibrary::I2C::Operation::READ
+                      ? State::READING
+                      : State::SELECTING_REGISTER;
+
+        return {};
+    }
+
+    /**
+     * \copydoc picolibrary::I2C::Basic_Controller_Concept::read()
+     */
+    constexpr auto read( ::picolibrary::I2C::Response ) noexcept
+        -> Result<std::uint8_t, Error_Code>
+    {
+        if ( m_fail ) {
+            return failure();
+        } // if
+
+        if ( m_state != State::READING ) {
+            return Generic_Error::LOGIC_ERROR;
+        } // if
+
+        return m_registers[ m_register_pointer++ ];
+    }
+
+    /**
+     * \copydoc picolibrary::I2C::Basic_Controller_Concept::write()
+     */
+    constexpr auto write( std::uint8_t data ) noexcept -> Result<Void, Error_Code>
+    {
+        if ( m_fail ) {
+            return failure();
+        } // if
+
+        switch ( m_state ) {
+            case State::SELECTING_REGISTER:
+                m_register_pointer = data;
+                m_state            = State::WRITING;
+                return {};
+            case State::WRITING: m_registers[ m_register_pointer++ ] = data; return {};
+            default: return Generic_Error::LOGIC_ERROR;
+        } // switch
+    }
+
+  private:
+    /**
+     * \brief Bus state.
+     */
+    enum class State : std::uint_fast8_t {
+        IDLE,               ///< Idle.
+        STARTED,            ///< A start condition has been transmitted.
+        SELECTING_REGISTER, ///< The device has been addressed for a write.
+        WRITING,            ///< A register has been selected for a write.
+        READING,            ///< The device has been addressed for a read.
+    };
+
+    /**
+     * \brief The address of the device attached to the bus.
+     */
+    ::picolibrary::I2C::Address m_device_address{};
+
+    /**
+     * \brief The device's registers.
+     */
+    Registers m_registers{};
+
+    /**
+     * \brief The device's register pointer.
+     */
+    std::uint8_t m_register_pointer{};
+
+    /**
+     * \brief The bus state.
+     */
+    State m_state{ State::IDLE };
+
+    /**
+     * \brief The number of transactions that have been transmitted.
+     */
+    std::uint_fast32_t m_transactions{};
+
+    /**
+     * \brief The next controller operation should fail.
+     */
+    bool m_fail{};
+
+    /**
+     * \brief The error the next controller operation should report.
+     */
+    Error_Code m_error{};
+
+    /**
+     * \brief Report an injected failure.
+     *
+     * \return The injected error.
+     */
+    auto failure() noexcept -> Error_Code
+    {
+        m_fail = false;
+
+        return make_error( m_error );
+    }
+};
+
+/**
+ * \brief Fake register file device I2C controller.
+ */
+using Fake_Controller = ::picolibrary::I2C::Controller<Fake_Basic_Controller>;
+
+/**
+ * \brief I2C bus timing.
+ *
+ * Durations are expressed in SCL clock cycles.
+ */
+struct Timing {
+    /**
+     * \brief The SCL clock frequency (Hz).
+     */
+    std::uint_fast32_t clock_frequency{ 100'000 };
+
+    /**
+     * \brief The duration of a start condition.
+     */
+    std::uint_fast8_t start{ 1 };
+
+    /**
+     * \brief The duration of a repeated start condition.
+     */
+    std::uint_fast8_t repeated_start{ 1 };
+
+    /**
+     * \brief The duration of a stop condition.
+     */
+    std::uint_fast8_t stop{ 1 };
+
+    /**
+     * \brief The duration of the gap (clock stretching, controller latency, etc.) that
+     *        follows each byte.
+     */
+    std::uint_fast8_t inter_byte_gap{ 0 };
+};
+
+/**
+ * \brief Bus timing estimating I2C basic controller.
+ *
+ * The controller forwards all operations to the wrapped basic controller and estimates
+ * how long the operations would take on real hardware: each start and repeated start
+ * condition starts a transaction, and each address, read, and write transfers a byte (8
+ * data bits and an ACK/NACK bit). Operations are recorded whether or not the wrapped
+ * basic controller reports an error since the bus is occupied either way.
+ *
+ * \tparam Basic_Controller The basic controller to wrap.
+ */
+template<typename Basic_Controller>
+class Timed_Basic_Controller : public Basic_Controller {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Timed_Basic_Controller() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \tparam Arguments Wrapped basic controller constructor argument types.
+     *
+     * \param[in] timing The bus timing.
+     * \param[in] arguments Wrapped basic controller constructor arguments.
+     */
+    template<typename... Arguments>
+    constexpr explicit Timed_Basic_Controller(
+        Timing const & timing,
+        Arguments &&... arguments ) noexcept :
+        Basic_Controller{ std::forward<Arguments>( arguments )... },
+        m_timing{ timing },
+        m_bus_timing{ timing.clock_frequency }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Timed_Basic_Controller( Timed_Basic_Controller && source ) noexcept =
+        default;
+
+    Timed_Basic_Controller( Timed_Basic_Controller const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Timed_Basic_Controller() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Timed_Basic_Controller && expression ) noexcept
+        -> Timed_Basic_Controller & = default;
+
+    auto operator=( Timed_Basic_Controller const & ) = delete;
+
+    /**
+     * \brief Get the bus timing.
+     *
+     * \return The bus timing.
+     */
+    constexpr auto const & timing() const noexcept
+    {
+        return m_timing;
+    }
+
+    /**
+     * \brief Access the bus timing estimate.
+     *
+     * \return The bus timing estimate.
+     */
+    constexpr auto & bus_timing() noexcept
+    {
+        return m_bus_timing;
+    }
+
+    /**
+     * \brief Access the bus timing estimate.
+     *
+     * \return The bus timing estimate.
+     */
+    constexpr auto const & bus_timing() const noexcept
+    {
+        return m_bus_timing;
+    }
+
+    /**
+     * \copydoc picolibrary::I2C::Basic_Controller_Concept::start()
+     */
+    constexpr auto start() noexcept
+    {
+        m_bus_timing.record_transaction( m_timing.start );
+
+        return Basic_Controller::start();
+    }
+
+    /**
+     * \copydoc picolibrary::I2C::Basic_Controller_Concept::repeated_start()
+     */
+    constexpr auto repeated_start() noexcept
+    {
+        m_bus_timing.record_transaction( m_timing.repeated_start );
+
+        return Basic_Controller::repeated_start();
+    }
+
+    /**
+     * \copydoc picolibrary::I2C::Basic_Controller_Concept::stop()
+     */
+    constexpr auto stop() noexcept
+    {
+        m_bus_timing.record_overhead( m_timing.stop );
+
+        return Basic_Controller::stop();
+    }
+
+    /**
+     * \copydoc picolibrary::I2C::Basic_Controller_Concept::address()
+     */
+    constexpr auto address(
+        ::picolibrary::I2C::Address   address,
+        ::picolibrary::I2C::Operation operation ) noexcept
+    {
+        record_byte();
+
+        return Basic_Controller::address( address, operation );
+    }
+
+    /**
+     * \copydoc picolibrary::I2C::Basic_Controller_Concept::read()
+     */
+    constexpr auto read( ::picolibrary::I2C::Response response ) noexcept
+    {
+        record_byte();
+
+        return Basic_Controller::read( response );
+    }
+
+    /**
+     * \copydoc picolibrary::I2C::Basic_Controller_Concept::write()
+     */
+    constexpr auto write( std::uint8_t data ) noexcept
+    {
+        record_byte();
+
+        return Basic_Controller::write( data );
+    }
+
+  private:
+    /**
+     * \brief The number of SCL clock cycles required to transfer a byte (8 data bits and
+     *        an ACK/NACK bit), excluding the inter-byte gap.
+     */
+    static constexpr auto BYTE_CYCLES = std::uint_fast8_t{ 9 };
+
+    /**
+     * \brief The bus timing.
+     */
+    Timing m_timing{};
+
+    /**
+     * \brief The bus timing estimate.
+     */
+    Bus_Timing_Estimator m_bus_timing{ Timing{}.clock_frequency };
+
+    /**
+     * \brief Record the transfer of a byte.
+     */
+    constexpr void record_byte() noexcept
+    {
+        m_bus_timing.record_byte( BYTE_CYCLES + m_timing.inter_byte_gap );
+    }
+};
+
+/**
+ * \brief Bus timing estimating fake register file device I2C controller.
+ */
+using Timed_Fake_Controller =
+    ::picolibrary::I2C::Controller<Timed_Basic_Controller<Fake_Basic_Controller>>;
+
+} // namespace picolibrary::Testing::Fake::I2C
+
+#endif // PICOLIBRARY_TESTING_FAKE_I2C_H
@@ -0,0 +1,534 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Testing::Fake::SPI interface.
+ */
+
+#ifndef PICOLIBRARY_TESTING_FAKE_SPI_H
+#define PICOLIBRARY_TESTING_FAKE_SPI_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "picolibrary/error.h"
+#include "picolibrary/result.h"
+#include "picolibrary/span.h"
+#include "picolibrary/spi.h"
+#include "picolibrary/testing/fake/bus_timing.h"
+#include "picolibrary/void.h"
+
+/**
+ * \brief Fake SPI facilities.
+ */
+namespace picolibrary::Testing::Fake::SPI {
+
+/**
+ * \brief Fake scripted SPI basic controller.
+ *
+ * Each exchange receives the next byte of the response script (if any remains), and
+ * otherwise receives the transmitted byte (loopback). Transmitted bytes are captured in
+ * the capture buffer (if any space remains). The response script and capture buffer
+ * are owned by the caller, so the controller never allocates.
+ */
+class Fake_Basic_Controller {
+  public:
+    /**
+     * \copydoc picolibrary::SPI::Basic_Controller_Concept::Configuration
+     */
+    using Configuration = std::uint_fast16_t;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Fake_Basic_Controller() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Fake_Basic_Controller( Fake_Basic_Controller && source ) noexcept = default;
+
+    Fake_Basic_Controller( Fake_Basic_Controller const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fake_Basic_Controller() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Fake_Basic_Controller && expression ) noexcept
+        -> Fake_Basic_Controller & = default;
+
+    auto operator=( Fake_Basic_Controller const & ) = delete;
+
+    /**
+     * \brief Set the response script.
+     *
+     * \attention The response script must outlive its use by the controller.
+     *
+     * \param[in] response The data to receive during subsequent exchanges.
+     */
+    constexpr void script( Byte_View response ) noexcept
+    {
+        m_response          = response;
+        m_response_position = 0;
+    }
+
+    /**
+     * \brief Set the capture buffer.
+     *
+     * \attention The capture buffer must outlive its use by the controller.
+     *
+     * \param[in] buffer The buffer to capture subsequently transmitted data in.
+     */
+    constexpr void capture( Span<std::uint8_t> buffer ) noexcept
+    {
+        m_capture          = buffer;
+        m_capture_position = 0;
+    }
+
+    /**
+     * \brief Get the captured transmitted data.
+     *
+     * \return The captured transmitted data.
+     */
+    constexpr auto transmitted() const noexcept
+    {
+        return Byte_View{ m_capture.data(), m_capture_position };
+    }
+
+    /**
+     * \brief Get the most recently applied configuration.
+     *
+     * \return The most recently applied configuration.
+     */
+    constexpr auto configuration() const noexcept
+    {
+        return m_configuration;
+    }
+
+    /**
+     * \brief Get the number of bytes that have been exchanged.
+     *
+     * \return The number of bytes that have been exchanged.
+     */
+    constexpr auto exchanges() const noexcept
+    {
+        return m_exchanges;
+    }
+
+    /**
+     * \brief Make the next controller operation fail.
+     *
+     * \param[in] error The error the next controller operation should report.
+     */
+    constexpr void fail( Error_Code const & error ) noexcept
+    {
+        m_error = error;
+        m_fail  = true;
+    }
+
+    /**
+     * \copydoc picolibrary::SPI::Basic_Controller_Concept::initialize()
+     */
+    constexpr auto initialize() noexcept -> Result<Void, Error_Code>
+    {
+        if ( m_fail ) {
+            return failure();
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \copydoc picolibrary::SPI::Basic_Controller_Concept::configure()
+     */
+    constexpr auto configure( Configuration configuration ) noexcept
+        -> Result<Void, Error_Code>
+    {
+        if ( m_fail ) {
+            return failure();
+        } // if
+
+        m_configuration = configuration;
+
+        return {};
+    }
+
+    /**
+     * \copydoc picolibrary::SPI::Basic_Controller_Concept::exchange()
+     */
+    constexpr auto exchange( std::uint8_t data ) noexcept
+        -> Result<std::uint8_t, Error_Code>
+    {
+        if ( m_fail ) {
+            return failure();
+        } // if
+
+        ++m_exchanges;
+
+        if ( m_capture_position < m_capture.size() ) {
+            m_capture[ m_capture_position++ ] = data;
+        } // if
+
+        if ( m_response_position < m_response.size() ) {
+            return m_response[ m_response_position++ ];
+        } // if
+
+        return data;
+    }
+
+  private:
+    /**
+     * \brief The response script.
+     */
+    Byte_View m_response{};
+
+    /**
+     * \brief The position of the next byte of the response script.
+     */
+    std::size_t m_response_position{};
+
+    /**
+     * \brief The capture buffer.
+     */
+    Span<std::uint8_t> m_capture{};
+
+    /**
+     * \brief The position of the next capture buffer byte.
+     */
+    std::size_t m_capture_position{};
+
+    /**
+     * \brief The most recently applied configuration.
+     */
+    Configuration m_configuration{};
+
+    /**
+     * \brief The number of bytes that have been exchanged.
+     */
+    std::uint_fast32_t m_exchanges{};
+
+    /**
+     * \brief The next controller operation should fail.
+     */
+    bool m_fail{};
+
+    /**
+     * \brief The error the next controller operation should report.
+     */
+    Error_Code m_error{};
+
+    /**
+     * \brief Report an injected failure.
+     *
+     * \return The injected error.
+     */
+    auto failure() noexcept -> Error_Code
+    {
+        m_fail = false;
+
+        return make_error( m_error );
+    }
+};
+
+/**
+ * \brief Fake scripted SPI controller.
+ */
+using Fake_Controller = ::picolibrary::SPI::Controller<Fake_Basic_Controller>;
+
+/**
+ * \brief SPI bus timing.
+ *
+ * Durations are expressed in SCLK clock cycles.
+ */
+struct Timing {
+    /**
+     * \brief The SCLK clock frequency (Hz).
+     */
+    std::uint_fast32_t clock_frequency{ 1'000'000 };
+
+    /**
+     * \brief The per transaction overhead (controller configuration, device selection
+     *        setup and hold, etc.).
+     */
+    std::uint_fast8_t transaction_overhead{ 0 };
+
+    /**
+     * \brief The duration of the gap (controller latency, etc.) that follows each byte.
+     */
+    std::uint_fast8_t inter_byte_gap{ 0 };
+};
+
+/**
+ * \brief Bus timing estimating SPI basic controller.
+ *
+ * The controller forwards all operations to the wrapped basic controller and estimates
+ * how long the operations would take on real hardware: each configuration starts a
+ * transaction (picolibrary::SPI::Device configures the controller at the start of each
+ * transaction), and each exchange transfers a byte (8 data bits). Operations are recorded
+ * whether or not the wrapped basic controller reports an error since the bus is occupied
+ * either way.
+ *
+ * \tparam Basic_Controller The basic controller to wrap.
+ */
+template<typename Basic_Controller>
+class Timed_Basic_Controller : public Basic_Controller {
+  public:
+    /**
+     * \copydoc picolibrary::SPI::Basic_Controller_Concept::Configuration
+     */
+    using Configuration = typename Basic_Controller::Configuration;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Timed_Basic_Controller() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \tparam Arguments Wrapped basic controller constructor argument types.
+     *
+     * \param[in] timing The bus timing.
+     * \param[in] arguments Wrapped basic controller constructor arguments.
+     */
+    template<typename... Arguments>
+    constexpr explicit Timed_Basic_Controller(
+        Timing const & timing,
+        Arguments &&... arguments ) noexcept :
+        Basic_Controller{ std::forward<Arguments>( arguments )... },
+        m_timing{ timing },
+        m_bus_timing{ timing.clock_frequency }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Timed_Basic_Controller( Timed_Basic_Controller && source ) noexcept =
+        default;
+
+    Timed_Basic_Controller( Timed_Basic_Controller const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Timed_Basic_Controller() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Timed_Basic_Controller && expression ) noexcept
+        -> Timed_Basic_Controller & = default;
+
+    auto operator=( Timed_Basic_Controller const & ) = delete;
+
+    /**
+     * \brief Get the bus timing.
+     *
+     * \return The bus timing.
+     */
+    constexpr auto const & timing() const noexcept
+    {
+        return m_timing;
+    }
+
+    /**
+     * \brief Access the bus timing estimate.
+     *
+     * \return The bus timing estimate.
+     */
+    constexpr auto & bus_timing() noexcept
+    {
+        return m_bus_timing;
+    }
+
+    /**
+     * \brief Access the bus timing estimate.
+     *
+     * \return The bus timing estimate.
+     */
+    constexpr auto const & bus_timing() const noexcept
+    {
+        return m_bus_timing;
+    }
+
+    /**
+     * \copydoc picolibrary::SPI::Basic_Controller_Concept::configure()
+     */
+    constexpr auto configure( Configuration configuration ) noexcept
+    {
+        m_bus_timing.record_transaction( m_timing.transaction_overhead );
+
+        return Basic_Controller::configure( configuration );
+    }
+
+    /**
+     * \copydoc picolibrary::SPI::Basic_Controller_Concept::exchange()
+     */
+    constexpr auto exchange( std::uint8_t data ) noexcept
+    {
+        m_bus_timing.record_byte( BYTE_CYCLES + m_timing.inter_byte_gap );
+
+        return Basic_Controller::exchange( data );
+    }
+
+  private:
+    /**
+     * \brief The number of SCLK clock cycles required to exchange a byte, excluding the
+     *        inter-byte gap.
+     */
+    static constexpr auto BYTE_CYCLES = std::uint_fast8_t{ 8 };
+
+    /**
+     * \brief The bus timing.
+     */
+    Timing m_timing{};
+
+    /**
+     * \brief The bus timing estimate.
+     */
+    Bus_Timing_Estimator m_bus_timing{ Timing{}.clock_frequency };
+};
+
+/**
+ * \brief Bus timing estimating fake scripted SPI controller.
+ */
+using Timed_Fake_Controller =
+    ::picolibrary::SPI::Controller<Timed_Basic_Controller<Fake_Basic_Controller>>;
+
+/**
+ * \brief Fake SPI device selector.
+ */
+class Fake_Device_Selector {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Fake_Device_Selector() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Fake_Device_Selector( Fake_Device_Selector && source ) noexcept = default;
+
+    Fake_Device_Selector( Fake_Device_Selector const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fake_Device_Selector() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Fake_Device_Selector && expression ) noexcept
+        -> Fake_Device_Selector & = default;
+
+    auto operator=( Fake_Device_Selector const & ) = delete;
+
+    /**
+     * \brief Check if the device is selected.
+     *
+     * \return true if the device is selected.
+     * \return false if the device is not selected.
+     */
+    constexpr auto selected() const noexcept
+    {
+        return m_selected;
+    }
+
+    /**
+     * \brief Get the number of times the device has been selected.
+     *
+     * \return The number of times the device has been selected.
+     */
+    constexpr auto selections() const noexcept
+    {
+        return m_selections;
+    }
+
+    /**
+     * \copydoc picolibrary::SPI::Device_Selector_Concept::initialize()
+     */
+    constexpr auto initialize() noexcept -> Result<Void, Error_Code>
+    {
+        m_selected = false;
+
+        return {};
+    }
+
+    /**
+     * \copydoc picolibrary::SPI::Device_Selector_Concept::select()
+     */
+    constexpr auto select() noexcept -> Result<Void, Error_Code>
+    {
+        m_selected = true;
+
+        ++m_selections;
+
+        return {};
+    }
+
+    /**
+     * \copydoc picolibrary::SPI::Device_Selector_Concept::deselect()
+     */
+    constexpr auto deselect() noexcept -> Result<Void, Error_Code>
+    {
+        m_selected = false;
+
+        return {};
+    }
+
+  private:
+    /**
+     * \brief The device's selection state.
+     */
+    bool m_selected{};
+
+    /**
+     * \brief The number of times the device has been selected.
+     */
+    std::uint_fast32_t m_selections{};
+};
+
+} // namespace picolibrary::Testing::Fake::SPI
+
+#endif // PICOLIBRARY_TESTING_FAKE_SPI_H
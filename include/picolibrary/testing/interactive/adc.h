@@ -23,10 +23,13 @@
 #ifndef PICOLIBRARY_TESTING_INTERACTIVE_ADC_H
 #define PICOLIBRARY_TESTING_INTERACTIVE_ADC_H
 
+#include <cstdint>
 #include <utility>
 
+#include "picolibrary/clock.h"
 #include "picolibrary/format.h"
 #include "picolibrary/stream.h"
+#include "picolibrary/testing/interactive/throughput.h"
 
 /**
  * \brief Analog-to-Digital Converter (ADC) interactive testing facilities.
@@ -115,6 +118,168 @@ void sample_blocking_single_sample_converter( Transmitter transmitter, Blocking_
     sample_blocking_single_sample_converter( stream, std::move( adc ), std::move( delay ) );
 }
 
+/**
+ * \brief Blocking, single sample ADC periodic sample interactive test helper.
+ *
+ * Samples are taken at the timer's absolute deadlines, so sample and output time do not
+ * cause the sample rate to drift. Each time the number of missed deadlines changes, the
+ * total number of missed deadlines is reported.
+ *
+ * \tparam Blocking_Single_Sample_Converter The type of blocking, single sample ADC to
+ *         sample.
+ * \tparam Clock The type of clock used by the timer.
+ * \tparam Idle The type of functor called by the timer while waiting for a deadline.
+ *
+ * \param[in] stream The output stream to use to output information to the user.
+ * \param[in] adc The blocking, single sample ADC to sample.
+ * \param[in] timer The timer that paces sampling.
+ */
+template<typename Blocking_Single_Sample_Converter, typename Clock, typename Idle>
+void sample_blocking_single_sample_converter_periodically(
+    Output_Stream &                  stream,
+    Blocking_Single_Sample_Converter adc,
+    Periodic_Timer<Clock, Idle>      timer ) noexcept
+{
+    // #lizard forgives the length
+
+    {
+        auto const result = adc.initialize();
+        if ( result.is_error() ) {
+            static_cast<void>( stream.print( "ADC initialization error: {}\n", result.error() ) );
+
+            return;
+        } // if
+    }
+
+    timer.restart();
+
+    auto missed = timer.missed();
+
+    for ( ;; ) {
+        timer.wait();
+
+        auto const result = adc.sample();
+        if ( result.is_error() ) {
+            static_cast<void>( stream.print( "ADC sampling error: {}\n", result.error() ) );
+
+            return;
+        } // if
+
+        if ( stream.print( "{}\n", Format::Decimal{ result.value() } ).is_error() ) {
+            return;
+        } // if
+
+        if ( timer.missed() != missed ) {
+            missed = timer.missed();
+
+            if ( stream.print( "missed deadlines: {}\n", Format::Decimal{ missed } ).is_error() ) {
+                return;
+            } // if
+        } // if
+    }     // for
+}
+
+/**
+ * \brief Blocking, single sample ADC periodic sample interactive test helper.
+ *
+ * \tparam Output_Stream The type of asynchronous serial output stream to use to output
+ *         information to the user.
+ * \tparam Transmitter The type of asynchronous serial transmitter to use to transmit
+ *         information to the user.
+ * \tparam Blocking_Single_Sample_Converter The type of blocking, single sample ADC to
+ *         sample.
+ * \tparam Clock The type of clock used by the timer.
+ * \tparam Idle The type of functor called by the timer while waiting for a deadline.
+ *
+ * \param[in] transmitter The asynchronous serial transmitter to use to transmit
+ *            information to the user.
+ * \param[in] adc The blocking, single sample ADC to sample.
+ * \param[in] timer The timer that paces sampling.
+ */
+template<template<typename> typename Output_Stream, typename Transmitter, typename Blocking_Single_Sample_Converter, typename Clock, typename Idle>
+void sample_blocking_single_sample_converter_periodically(
+    Transmitter                      transmitter,
+    Blocking_Single_Sample_Converter adc,
+    Periodic_Timer<Clock, Idle>      timer ) noexcept
+{
+    auto stream = Output_Stream{ std::move( transmitter ) };
+
+    if ( stream.initialize().is_error() ) {
+        return;
+    } // if
+
+    sample_blocking_single_sample_converter_periodically( stream, std::move( adc ), std::move( timer ) );
+}
+
+/**
+ * \brief Blocking, single sample ADC sample throughput interactive test helper.
+ *
+ * \tparam Blocking_Single_Sample_Converter The type of blocking, single sample ADC to
+ *         test.
+ * \tparam Clock A nullary functor that returns the current time as an unsigned integer
+ *         number of clock ticks.
+ *
+ * \param[in] stream The output stream to use to output information to the user.
+ * \param[in] adc The blocking, single sample ADC to test.
+ * \param[in] clock The clock to use to measure time.
+ * \param[in] clock_frequency The clock's frequency (Hz).
+ */
+template<typename Blocking_Single_Sample_Converter, typename Clock>
+void sample_blocking_single_sample_converter_throughput(
+    Output_Stream &                  stream,
+    Blocking_Single_Sample_Converter adc,
+    Clock                            clock,
+    std::uint_fast32_t               clock_frequency ) noexcept
+{
+    {
+        auto const result = adc.initialize();
+        if ( result.is_error() ) {
+            static_cast<void>( stream.print( "ADC initialization error: {}\n", result.error() ) );
+
+            return;
+        } // if
+    }
+
+    Throughput::measure( stream, std::move( clock ), clock_frequency, "samples", 0, [ &adc ]() noexcept {
+        return adc.sample();
+    } );
+}
+
+/**
+ * \brief Blocking, single sample ADC sample throughput interactive test helper.
+ *
+ * \tparam Output_Stream The type of asynchronous serial output stream to use to output
+ *         information to the user.
+ * \tparam Transmitter The type of asynchronous serial transmitter to use to transmit
+ *         information to the user.
+ * \tparam Blocking_Single_Sample_Converter The type of blocking, single sample ADC to
+ *         test.
+ * \tparam Clock A nullary functor that returns the current time as an unsigned integer
+ *         number of clock ticks.
+ *
+ * \param[in] transmitter The asynchronous serial transmitter to use to transmit
+ *            information to the user.
+ * \param[in] adc The blocking, single sample ADC to test.
+ * \param[in] clock The clock to use to measure time.
+ * \param[in] clock_frequency The clock's frequency (Hz).
+ */
+template<template<typename> typename Output_Stream, typename Transmitter, typename Blocking_Single_Sample_Converter, typename Clock>
+void sample_blocking_single_sample_converter_throughput(
+    Transmitter                      transmitter,
+    Blocking_Single_Sample_Converter adc,
+    Clock                            clock,
+    std::uint_fast32_t               clock_frequency ) noexcept
+{
+    auto stream = Output_Stream{ std::move( transmitter ) };
+
+    if ( stream.initialize().is_error() ) {
+        return;
+    } // if
+
+    sample_blocking_single_sample_converter_throughput(
+        stream, std::move( adc ), std::move( clock ), clock_frequency );
+}
+
 } // namespace picolibrary::Testing::Interactive::ADC
 
 #endif // PICOLIBRARY_TESTING_INTERACTIVE_ADC_H
@@ -23,9 +23,11 @@
 #ifndef PICOLIBRARY_TESTING_INTERACTIVE_GPIO_H
 #define PICOLIBRARY_TESTING_INTERACTIVE_GPIO_H
 
+#include <cstdint>
 #include <utility>
 
 #include "picolibrary/stream.h"
+#include "picolibrary/testing/interactive/throughput.h"
 
 /**
  * \brief General Purpose Input/Output (GPIO) interactive testing facilities.
@@ -168,6 +170,64 @@ void toggle( Transmitter transmitter, Output_Pin pin, Delayer delay ) noexcept
     toggle( stream, std::move( pin ), std::move( delay ) );
 }
 
+/**
+ * \brief GPIO output pin toggle rate interactive test helper.
+ *
+ * \tparam Output_Pin The type of output pin to toggle.
+ * \tparam Clock A nullary functor that returns the current time as an unsigned integer
+ *         number of clock ticks.
+ *
+ * \param[in] stream The output stream to use to output information to the user.
+ * \param[in] pin The pin to toggle.
+ * \param[in] clock The clock to use to measure time.
+ * \param[in] clock_frequency The clock's frequency (Hz).
+ */
+template<typename Output_Pin, typename Clock>
+void toggle_throughput( Output_Stream & stream, Output_Pin pin, Clock clock, std::uint_fast32_t clock_frequency ) noexcept
+{
+    {
+        auto const result = pin.initialize();
+        if ( result.is_error() ) {
+            static_cast<void>( stream.print( "pin initialization error: {}\n", result.error() ) );
+
+            return;
+        } // if
+    }
+
+    Throughput::measure( stream, std::move( clock ), clock_frequency, "toggles", 0, [ &pin ]() noexcept {
+        return pin.toggle();
+    } );
+}
+
+/**
+ * \brief GPIO output pin toggle rate interactive test helper.
+ *
+ * \tparam Output_Stream The type of asynchronous serial output stream to use to output
+ *         information to the user.
+ * \tparam Transmitter The type of asynchronous serial transmitter to use to transmit
+ *         information to the user.
+ * \tparam Output_Pin The type of output pin to toggle.
+ * \tparam Clock A nullary functor that returns the current time as an unsigned integer
+ *         number of clock ticks.
+ *
+ * \param[in] transmitter The asynchronous serial transmitter to use to transmit
+ *            information to the user.
+ * \param[in] pin The pin to toggle.
+ * \param[in] clock The clock to use to measure time.
+ * \param[in] clock_frequency The clock's frequency (Hz).
+ */
+template<template<typename> typename Output_Stream, typename Transmitter, typename Output_Pin, typename Clock>
+void toggle_throughput( Transmitter transmitter, Output_Pin pin, Clock clock, std::uint_fast32_t clock_frequency ) noexcept
+{
+    auto stream = Output_Stream{ std::move( transmitter ) };
+
+    if ( stream.initialize().is_error() ) {
+        return;
+    } // if
+
+    toggle_throughput( stream, std::move( pin ), std::move( clock ), clock_frequency );
+}
+
 } // namespace picolibrary::Testing::Interactive::GPIO
 
 #endif // PICOLIBRARY_TESTING_INTERACTIVE_GPIO_H
@@ -23,10 +23,12 @@
 #ifndef PICOLIBRARY_TESTING_INTERACTIVE_I2C_H
 #define PICOLIBRARY_TESTING_INTERACTIVE_I2C_H
 
+#include <cstdint>
 #include <utility>
 
 #include "picolibrary/format.h"
 #include "picolibrary/i2c.h"
+#include "picolibrary/testing/interactive/throughput.h"
 
 /**
  * \brief Inter-Integrated Circuit (I2C) interactive testing facilities.
@@ -91,6 +93,61 @@ void scan( Transmitter transmitter, Controller controller ) noexcept
     }
 }
 
+/**
+ * \brief I2C device ping throughput interactive test helper.
+ *
+ * Each transaction transmits a start condition, addresses the device, and transmits a
+ * stop condition.
+ *
+ * \tparam Output_Stream The type of asynchronous serial output stream to use to output
+ *         information to the user.
+ * \tparam Transmitter The type of asynchronous serial transmitter to use to transmit
+ *         information to the user.
+ * \tparam Controller The type if I2C controller used to interact with the bus.
+ * \tparam Clock A nullary functor that returns the current time as an unsigned integer
+ *         number of clock ticks.
+ *
+ * \param[in] transmitter The asynchronous serial transmitter to use to transmit
+ *            information to the user.
+ * \param[in] controller The I2C controller for the bus the device is attached to.
+ * \param[in] address The address of the device to ping.
+ * \param[in] operation The operation to request when pinging the device.
+ * \param[in] clock The clock to use to measure time.
+ * \param[in] clock_frequency The clock's frequency (Hz).
+ */
+template<template<typename> typename Output_Stream, typename Transmitter, typename Controller, typename Clock>
+void ping_throughput(
+    Transmitter                   transmitter,
+    Controller                    controller,
+    ::picolibrary::I2C::Address   address,
+    ::picolibrary::I2C::Operation operation,
+    Clock                         clock,
+    std::uint_fast32_t            clock_frequency ) noexcept
+{
+    // #lizard forgives the PARAM
+
+    auto stream = Output_Stream{ std::move( transmitter ) };
+
+    if ( stream.initialize().is_error() ) {
+        return;
+    } // if
+
+    {
+        auto const result = controller.initialize();
+        if ( result.is_error() ) {
+            static_cast<void>(
+                stream.print( "controller initialization error: {}\n", result.error() ) );
+
+            return;
+        } // if
+    }
+
+    Throughput::measure(
+        stream, std::move( clock ), clock_frequency, "transactions", 1, [ &controller, address, operation ]() noexcept {
+            return ::picolibrary::I2C::ping( controller, address, operation );
+        } );
+}
+
 } // namespace picolibrary::Testing::Interactive::I2C
 
 #endif // PICOLIBRARY_TESTING_INTERACTIVE_I2C_H
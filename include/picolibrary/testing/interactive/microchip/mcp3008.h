@@ -23,6 +23,7 @@
 #ifndef PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MCP3008_H
 #define PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MCP3008_H
 
+#include <cstdint>
 #include <utility>
 
 #include "picolibrary/error.h"
@@ -105,6 +106,79 @@ void sample(
         std::move( delay ) );
 }
 
+/**
+ * \brief Microchip MCP3008 sample throughput interactive test helper.
+ *
+ * \tparam Output_Stream The type of asynchronous serial output stream to use to output
+ *         information to the user.
+ * \tparam Transmitter The type of asynchronous serial transmitter to use to transmit
+ *         information to the user.
+ * \tparam Controller The type of SPI controller to use to communicate with the MCP3008.
+ * \tparam Device_Selector The type of SPI device selector to use to select the Microchip
+ *         MCP3008.
+ * \tparam Clock A nullary functor that returns the current time as an unsigned integer
+ *         number of clock ticks.
+ *
+ * \param[in] transmitter The asynchronous serial transmitter to use to transmit
+ *            information to the user.
+ * \param[in] controller The SPI controller to use to communicate with the Microchip
+ *            MCP3008.
+ * \param[in] configuration The SPI controller clock, and data exchange bit order
+ *            configuration to use to communicate with the Microchip MCP3008.
+ * \param[in] device_selector The device selector to use to select the Microchip MCP3008.
+ * \param[in] input The Microchip MCP3008 input mode/channel(s) to use when getting a
+ *            sample.
+ * \param[in] clock The clock to use to measure time.
+ * \param[in] clock_frequency The clock's frequency (Hz).
+ */
+template<template<typename> typename Output_Stream, typename Transmitter, typename Controller, typename Device_Selector, typename Clock>
+void sample_throughput(
+    Transmitter                              transmitter,
+    Controller                               controller,
+    typename Controller::Configuration       configuration,
+    Device_Selector                          device_selector,
+    ::picolibrary::Microchip::MCP3008::Input input,
+    Clock                                    clock,
+    std::uint_fast32_t                       clock_frequency ) noexcept
+{
+    // #lizard forgives the PARAM
+
+    auto stream = Output_Stream{ std::move( transmitter ) };
+
+    if ( stream.initialize().is_error() ) {
+        return;
+    } // if
+
+    {
+        auto const result = controller.initialize();
+        if ( result.is_error() ) {
+            static_cast<void>(
+                stream.print( "controller initialization error: {}\n", result.error() ) );
+
+            return;
+        } // if
+    }
+
+    auto mcp3008 = ::picolibrary::Microchip::MCP3008::Driver{
+        controller, configuration, std::move( device_selector ), Generic_Error::NONRESPONSIVE_DEVICE
+    };
+
+    {
+        auto const result = mcp3008.initialize();
+        if ( result.is_error() ) {
+            static_cast<void>( stream.print( "MCP3008 initialization error: {}\n", result.error() ) );
+
+            return;
+        } // if
+    }
+
+    ADC::sample_blocking_single_sample_converter_throughput(
+        stream,
+        ::picolibrary::Microchip::MCP3008::Blocking_Single_Sample_Converter{ mcp3008, input },
+        std::move( clock ),
+        clock_frequency );
+}
+
 } // namespace picolibrary::Testing::Interactive::Microchip::MCP3008
 
 #endif // PICOLIBRARY_TESTING_INTERACTIVE_MICROCHIP_MCP3008_H
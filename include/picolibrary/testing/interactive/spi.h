@@ -23,16 +23,25 @@
 #ifndef PICOLIBRARY_TESTING_INTERACTIVE_SPI_H
 #define PICOLIBRARY_TESTING_INTERACTIVE_SPI_H
 
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 
+#include "picolibrary/fixed_size_array.h"
 #include "picolibrary/format.h"
+#include "picolibrary/testing/interactive/throughput.h"
 
 /**
  * \brief Serial Peripheral Interface (SPI) interactive testing facilities.
  */
 namespace picolibrary::Testing::Interactive::SPI {
 
+/**
+ * \brief The size of the blocks exchanged by
+ *        picolibrary::Testing::Interactive::SPI::exchange_throughput().
+ */
+constexpr auto THROUGHPUT_BLOCK_SIZE = std::size_t{ 16 };
+
 /**
  * \brief SPI controller echo interactive test helper.
  *
@@ -110,6 +119,74 @@ void echo( Transmitter transmitter, Controller controller, typename Controller::
     }     // for
 }
 
+/**
+ * \brief SPI controller block exchange throughput interactive test helper.
+ *
+ * Each transaction exchanges a block of
+ * picolibrary::Testing::Interactive::SPI::THROUGHPUT_BLOCK_SIZE bytes. The received data
+ * is not checked, so the controller's MOSI and MISO signals do not need to be connected.
+ *
+ * \tparam Output_Stream The type of asynchronous serial output stream to use to output
+ *         information to the user.
+ * \tparam Transmitter The type of asynchronous serial transmitter to use to transmit
+ *         information to the user.
+ * \tparam Controller The type of SPI controller to test.
+ * \tparam Clock A nullary functor that returns the current time as an unsigned integer
+ *         number of clock ticks.
+ *
+ * \param[in] transmitter The asynchronous serial transmitter to use to transmit
+ *            information to the user.
+ * \param[in] controller The SPI controller to test.
+ * \param[in] configuration The SPI controller clock and data exchange bit order
+ *            configuration to use.
+ * \param[in] clock The clock to use to measure time.
+ * \param[in] clock_frequency The clock's frequency (Hz).
+ */
+template<template<typename> typename Output_Stream, typename Transmitter, typename Controller, typename Clock>
+void exchange_throughput(
+    Transmitter                        transmitter,
+    Controller                         controller,
+    typename Controller::Configuration configuration,
+    Clock                              clock,
+    std::uint_fast32_t                 clock_frequency ) noexcept
+{
+    // #lizard forgives the length
+
+    auto stream = Output_Stream{ std::move( transmitter ) };
+
+    if ( stream.initialize().is_error() ) {
+        return;
+    } // if
+
+    {
+        auto const result = controller.initialize();
+        if ( result.is_error() ) {
+            static_cast<void>(
+                stream.print( "controller initialization error: {}\n", result.error() ) );
+
+            return;
+        } // if
+    }
+
+    {
+        auto const result = controller.configure( configuration );
+        if ( result.is_error() ) {
+            static_cast<void>(
+                stream.print( "controller configuration error: {}\n", result.error() ) );
+
+            return;
+        } // if
+    }
+
+    auto const tx = Fixed_Size_Array<std::uint8_t, THROUGHPUT_BLOCK_SIZE>{};
+    auto       rx = Fixed_Size_Array<std::uint8_t, THROUGHPUT_BLOCK_SIZE>{};
+
+    Throughput::measure(
+        stream, std::move( clock ), clock_frequency, "transactions", THROUGHPUT_BLOCK_SIZE, [ &controller, &tx, &rx ]() noexcept {
+            return controller.exchange( tx.begin(), tx.end(), rx.begin(), rx.end() );
+        } );
+}
+
 } // namespace picolibrary::Testing::Interactive::SPI
 
 #endif // PICOLIBRARY_TESTING_INTERACTIVE_SPI_H
@@ -0,0 +1,156 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Testing::Interactive::Throughput interface.
+ */
+
+#ifndef PICOLIBRARY_TESTING_INTERACTIVE_THROUGHPUT_H
+#define PICOLIBRARY_TESTING_INTERACTIVE_THROUGHPUT_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "picolibrary/fixed_size_array.h"
+#include "picolibrary/format.h"
+#include "picolibrary/stream.h"
+
+/**
+ * \brief Throughput interactive testing facilities.
+ */
+namespace picolibrary::Testing::Interactive::Throughput {
+
+/**
+ * \brief The number of operations that are performed between reports.
+ */
+constexpr auto WINDOW = std::size_t{ 128 };
+
+/**
+ * \brief Sort a window of latencies in ascending order.
+ *
+ * \tparam Tick The clock tick type.
+ *
+ * \param[in,out] latencies The window of latencies to sort.
+ */
+template<typename Tick>
+constexpr void sort( Fixed_Size_Array<Tick, WINDOW> & latencies ) noexcept
+{
+    for ( auto i = std::size_t{ 1 }; i < latencies.size(); ++i ) {
+        auto const latency = latencies[ i ];
+
+        auto j = i;
+        for ( ; j > 0 and latencies[ j - 1 ] > latency; --j ) {
+            latencies[ j ] = latencies[ j - 1 ];
+        } // for
+
+        latencies[ j ] = latency;
+    } // for
+}
+
+/**
+ * \brief Throughput measurement interactive test helper.
+ *
+ * The operation is performed repeatedly. After every
+ * picolibrary::Testing::Interactive::Throughput::WINDOW operations, the operation rate,
+ * the data rate (if the number of bytes transferred per operation is non-zero), and the
+ * 50th, 90th, and 99th percentile and maximum operation latencies are reported. Time
+ * spent reporting is excluded from the measurements.
+ *
+ * \tparam Clock A nullary functor that returns the current time as an unsigned integer
+ *         number of clock ticks. The clock is allowed to wrap.
+ * \tparam Operation A nullary functor that performs the operation to measure and
+ *         returns a picolibrary::Result.
+ *
+ * \param[in] stream The output stream to use to output information to the user.
+ * \param[in] clock The clock to use to measure time.
+ * \param[in] clock_frequency The clock's frequency (Hz).
+ * \param[in] operations The name of the operation (plural, e.g. "samples").
+ * \param[in] bytes_per_operation The number of bytes transferred by each operation.
+ * \param[in] operation The operation to measure.
+ */
+template<typename Clock, typename Operation>
+void measure(
+    Output_Stream &    stream,
+    Clock              clock,
+    std::uint_fast32_t clock_frequency,
+    char const *       operations,
+    std::uint_fast32_t bytes_per_operation,
+    Operation          operation ) noexcept
+{
+    // #lizard forgives the length
+
+    using Tick = decltype( clock() );
+
+    auto const to_microseconds = [ clock_frequency ]( std::uint_fast64_t ticks ) noexcept {
+        return Format::Decimal{ static_cast<std::uint_fast64_t>(
+            ticks * 1'000'000 / clock_frequency ) };
+    };
+
+    auto latencies = Fixed_Size_Array<Tick, WINDOW>{};
+
+    for ( ;; ) {
+        auto const start = clock();
+
+        for ( auto & latency : latencies ) {
+            auto const begin = clock();
+
+            auto const result = operation();
+
+            auto const end = clock();
+
+            if ( result.is_error() ) {
+                static_cast<void>( stream.print( "{} error: {}\n", operations, result.error() ) );
+
+                return;
+            } // if
+
+            latency = static_cast<Tick>( end - begin );
+        } // for
+
+        auto const elapsed = static_cast<std::uint_fast64_t>( static_cast<Tick>( clock() - start ) );
+        auto const rate = WINDOW * static_cast<std::uint_fast64_t>( clock_frequency )
+                          / ( elapsed ? elapsed : 1 );
+
+        sort( latencies );
+
+        if ( stream.print( "{}/s: {}", operations, Format::Decimal{ rate } ).is_error() ) {
+            return;
+        } // if
+
+        if ( bytes_per_operation ) {
+            if ( stream.print( ", B/s: {}", Format::Decimal{ rate * bytes_per_operation } ).is_error() ) {
+                return;
+            } // if
+        } // if
+
+        if ( stream
+                 .print(
+                     ", latency (us): p50 {} p90 {} p99 {} max {}\n",
+                     to_microseconds( latencies[ WINDOW * 50 / 100 ] ),
+                     to_microseconds( latencies[ WINDOW * 90 / 100 ] ),
+                     to_microseconds( latencies[ WINDOW * 99 / 100 ] ),
+                     to_microseconds( latencies[ WINDOW - 1 ] ) )
+                 .is_error() ) {
+            return;
+        } // if
+    }     // for
+}
+
+} // namespace picolibrary::Testing::Interactive::Throughput
+
+#endif // PICOLIBRARY_TESTING_INTERACTIVE_THROUGHPUT_H
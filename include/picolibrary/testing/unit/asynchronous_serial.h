@@ -23,6 +23,7 @@
 #ifndef PICOLIBRARY_TESTING_UNIT_ASYNCHRONOUS_SERIAL_H
 #define PICOLIBRARY_TESTING_UNIT_ASYNCHRONOUS_SERIAL_H
 
+#include <algorithm>
 #include <vector>
 
 #include "gmock/gmock.h"
@@ -364,6 +365,547 @@ class Mock_Transmitter {
     }
 };
 
+/**
+ * \brief Mock asynchronous serial non-blocking transmitter.
+ *
+ * \tparam The integral type used to hold the data to be transmitted.
+ */
+template<typename Data_Type>
+class Mock_Non_Blocking_Transmitter {
+  public:
+    /**
+     * \copydoc picolibrary::Asynchronous_Serial::Non_Blocking_Transmitter_Concept::Data
+     */
+    using Data = Data_Type;
+
+    /**
+     * \copydoc picolibrary::Asynchronous_Serial::Non_Blocking_Transmitter_Concept::Completion_Handler
+     */
+    using Completion_Handler = void ( * )( void * context ) noexcept;
+
+    /**
+     * \brief Movable mock non-blocking transmitter handle.
+     */
+    class Handle {
+      public:
+        /**
+         * \copydoc picolibrary::Asynchronous_Serial::Non_Blocking_Transmitter_Concept::Data
+         */
+        using Data = Data_Type;
+
+        /**
+         * \copydoc picolibrary::Asynchronous_Serial::Non_Blocking_Transmitter_Concept::Completion_Handler
+         */
+        using Completion_Handler = void ( * )( void * context ) noexcept;
+
+        /**
+         * \brief Constructor.
+         */
+        Handle() noexcept = default;
+
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] mock_non_blocking_transmitter The mock non-blocking transmitter.
+         */
+        Handle( Mock_Non_Blocking_Transmitter & mock_non_blocking_transmitter ) noexcept :
+            m_mock_non_blocking_transmitter{ &mock_non_blocking_transmitter }
+        {
+        }
+
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] source The source of the move.
+         */
+        Handle( Handle && source ) noexcept :
+            m_mock_non_blocking_transmitter{ source.m_mock_non_blocking_transmitter }
+        {
+            source.m_mock_non_blocking_transmitter = nullptr;
+        }
+
+        Handle( Handle const & ) = delete;
+
+        /**
+         * \brief Destructor.
+         */
+        ~Handle() noexcept = default;
+
+        /**
+         * \brief Assignment operator.
+         *
+         * \param[in] expression The expression to be assigned.
+         *
+         * \return The assigned to object.
+         */
+        auto & operator=( Handle && expression ) noexcept
+        {
+            if ( &expression != this ) {
+                m_mock_non_blocking_transmitter = expression.m_mock_non_blocking_transmitter;
+
+                expression.m_mock_non_blocking_transmitter = nullptr;
+            } // if
+
+            return *this;
+        }
+
+        auto operator=( Handle const & ) = delete;
+
+        /**
+         * \brief Get the mock non-blocking transmitter.
+         *
+         * \return The mock non-blocking transmitter.
+         */
+        auto & mock() noexcept
+        {
+            return *m_mock_non_blocking_transmitter;
+        }
+
+        /**
+         * \brief Initialize the transmitter's hardware.
+         *
+         * \return Nothing if transmitter hardware initialization succeeded.
+         * \return An error code if transmitter hardware initialization failed.
+         */
+        auto initialize()
+        {
+            return m_mock_non_blocking_transmitter->initialize();
+        }
+
+        /**
+         * \brief Set the transmission completion handler.
+         *
+         * \param[in] handler The transmission completion handler.
+         * \param[in] context The context to pass to the transmission completion handler.
+         */
+        void set_completion_handler( Completion_Handler handler, void * context )
+        {
+            m_mock_non_blocking_transmitter->set_completion_handler( handler, context );
+        }
+
+        /**
+         * \brief Start transmitting a block of data.
+         *
+         * \param[in] begin The beginning of the block of data to transmit.
+         * \param[in] end The end of the block of data to transmit.
+         *
+         * \return Nothing if starting the transmission succeeded.
+         * \return An error code if starting the transmission failed.
+         */
+        auto start_transmit( Data const * begin, Data const * end )
+        {
+            return m_mock_non_blocking_transmitter->start_transmit( begin, end );
+        }
+
+        /**
+         * \brief Check if the most recently started transmission is complete.
+         *
+         * \return true if no transmission is in progress.
+         * \return false if a transmission is in progress.
+         */
+        auto transmit_complete() const
+        {
+            return m_mock_non_blocking_transmitter->transmit_complete();
+        }
+
+      private:
+        /**
+         * \brief The mock non-blocking transmitter.
+         */
+        Mock_Non_Blocking_Transmitter * m_mock_non_blocking_transmitter{};
+    };
+
+    /**
+     * \brief Constructor.
+     */
+    Mock_Non_Blocking_Transmitter() = default;
+
+    Mock_Non_Blocking_Transmitter( Mock_Non_Blocking_Transmitter && ) = delete;
+
+    Mock_Non_Blocking_Transmitter( Mock_Non_Blocking_Transmitter const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Mock_Non_Blocking_Transmitter() noexcept = default;
+
+    auto operator=( Mock_Non_Blocking_Transmitter && ) = delete;
+
+    auto operator=( Mock_Non_Blocking_Transmitter const & ) = delete;
+
+    /**
+     * \brief Get a movable handle to the mock non-blocking transmitter.
+     *
+     * \return A movable handle to the mock non-blocking transmitter.
+     */
+    auto handle() noexcept
+    {
+        return Handle{ *this };
+    }
+
+    MOCK_METHOD( (Result<Void, Error_Code>), initialize, () );
+
+    MOCK_METHOD( void, set_completion_handler, ( Completion_Handler, void * ) );
+
+    MOCK_METHOD( (Result<Void, Error_Code>), start_transmit, (std::vector<Data>));
+
+    /**
+     * \brief Start transmitting a block of data.
+     *
+     * \param[in] begin The beginning of the block of data to transmit.
+     * \param[in] end The end of the block of data to transmit.
+     *
+     * \return Nothing if starting the transmission succeeded.
+     * \return An error code if starting the transmission failed.
+     */
+    auto start_transmit( Data const * begin, Data const * end ) noexcept
+    {
+        return start_transmit( std::vector<Data>{ begin, end } );
+    }
+
+    MOCK_METHOD( bool, transmit_complete, (), ( const ) );
+};
+
+/**
+ * \brief Mock asynchronous serial basic receiver.
+ *
+ * \tparam The integral type used to hold the data to be received.
+ */
+template<typename Data_Type>
+class Mock_Basic_Receiver {
+  public:
+    /**
+     * \copydoc picolibrary::Asynchronous_Serial::Basic_Receiver_Concept::Data
+     */
+    using Data = Data_Type;
+
+    /**
+     * \brief Movable mock basic receiver handle.
+     */
+    class Handle {
+      public:
+        /**
+         * \copydoc picolibrary::Asynchronous_Serial::Basic_Receiver_Concept::Data
+         */
+        using Data = Data_Type;
+
+        /**
+         * \brief Constructor.
+         */
+        Handle() noexcept = default;
+
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] mock_basic_receiver The mock basic receiver.
+         */
+        Handle( Mock_Basic_Receiver & mock_basic_receiver ) noexcept :
+            m_mock_basic_receiver{ &mock_basic_receiver }
+        {
+        }
+
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] source The source of the move.
+         */
+        Handle( Handle && source ) noexcept :
+            m_mock_basic_receiver{ source.m_mock_basic_receiver }
+        {
+            source.m_mock_basic_receiver = nullptr;
+        }
+
+        Handle( Handle const & ) = delete;
+
+        /**
+         * \brief Destructor.
+         */
+        ~Handle() noexcept = default;
+
+        /**
+         * \brief Assignment operator.
+         *
+         * \param[in] expression The expression to be assigned.
+         *
+         * \return The assigned to object.
+         */
+        auto & operator=( Handle && expression ) noexcept
+        {
+            if ( &expression != this ) {
+                m_mock_basic_receiver = expression.m_mock_basic_receiver;
+
+                expression.m_mock_basic_receiver = nullptr;
+            } // if
+
+            return *this;
+        }
+
+        auto operator=( Handle const & ) = delete;
+
+        /**
+         * \brief Get the mock basic receiver.
+         *
+         * \return The mock basic receiver.
+         */
+        auto & mock() noexcept
+        {
+            return *m_mock_basic_receiver;
+        }
+
+        /**
+         * \brief Initialize the receiver's hardware.
+         *
+         * \return Nothing if receiver hardware initialization succeeded.
+         * \return An error code if receiver hardware initialization failed.
+         */
+        auto initialize()
+        {
+            return m_mock_basic_receiver->initialize();
+        }
+
+        /**
+         * \brief Receive data.
+         *
+         * \return The received data if data reception succeeded.
+         * \return An error code if data reception failed.
+         */
+        auto receive()
+        {
+            return m_mock_basic_receiver->receive();
+        }
+
+      private:
+        /**
+         * \brief The mock basic receiver.
+         */
+        Mock_Basic_Receiver * m_mock_basic_receiver{};
+    };
+
+    /**
+     * \brief Constructor.
+     */
+    Mock_Basic_Receiver() = default;
+
+    Mock_Basic_Receiver( Mock_Basic_Receiver && ) = delete;
+
+    Mock_Basic_Receiver( Mock_Basic_Receiver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Mock_Basic_Receiver() noexcept = default;
+
+    auto operator=( Mock_Basic_Receiver && ) = delete;
+
+    auto operator=( Mock_Basic_Receiver const & ) = delete;
+
+    /**
+     * \brief Get a movable handle to the mock basic receiver.
+     *
+     * \return A movable handle to the mock basic receiver.
+     */
+    auto handle() noexcept
+    {
+        return Handle{ *this };
+    }
+
+    MOCK_METHOD( (Result<Void, Error_Code>), initialize, () );
+
+    MOCK_METHOD( (Result<Data, Error_Code>), receive, () );
+};
+
+/**
+ * \brief Mock asynchronous serial receiver.
+ *
+ * \tparam The integral type used to hold the data to be received.
+ */
+template<typename Data_Type>
+class Mock_Receiver {
+  public:
+    /**
+     * \copydoc picolibrary::Asynchronous_Serial::Receiver_Concept::Data
+     */
+    using Data = Data_Type;
+
+    /**
+     * \brief Movable mock receiver handle.
+     */
+    class Handle {
+      public:
+        /**
+         * \copydoc picolibrary::Asynchronous_Serial::Receiver_Concept::Data
+         */
+        using Data = Data_Type;
+
+        /**
+         * \brief Constructor.
+         */
+        Handle() noexcept = default;
+
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] mock_receiver The mock receiver.
+         */
+        Handle( Mock_Receiver & mock_receiver ) noexcept :
+            m_mock_receiver{ &mock_receiver }
+        {
+        }
+
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] source The source of the move.
+         */
+        Handle( Handle && source ) noexcept :
+            m_mock_receiver{ source.m_mock_receiver }
+        {
+            source.m_mock_receiver = nullptr;
+        }
+
+        Handle( Handle const & ) = delete;
+
+        /**
+         * \brief Destructor.
+         */
+        ~Handle() noexcept = default;
+
+        /**
+         * \brief Assignment operator.
+         *
+         * \param[in] expression The expression to be assigned.
+         *
+         * \return The assigned to object.
+         */
+        auto & operator=( Handle && expression ) noexcept
+        {
+            if ( &expression != this ) {
+                m_mock_receiver = expression.m_mock_receiver;
+
+                expression.m_mock_receiver = nullptr;
+            } // if
+
+            return *this;
+        }
+
+        auto operator=( Handle const & ) = delete;
+
+        /**
+         * \brief Get the mock receiver.
+         *
+         * \return The mock receiver.
+         */
+        auto & mock() noexcept
+        {
+            return *m_mock_receiver;
+        }
+
+        /**
+         * \brief Initialize the receiver's hardware.
+         *
+         * \return Nothing if receiver hardware initialization succeeded.
+         * \return An error code if receiver hardware initialization failed.
+         */
+        auto initialize()
+        {
+            return m_mock_receiver->initialize();
+        }
+
+        /**
+         * \brief Receive data.
+         *
+         * \return The received data if data reception succeeded.
+         * \return An error code if data reception failed.
+         */
+        auto receive()
+        {
+            return m_mock_receiver->receive();
+        }
+
+        /**
+         * \brief Receive a block of data.
+         *
+         * \param[out] begin The beginning of the block of received data.
+         * \param[out] end The end of the block of received data.
+         *
+         * \return Nothing if data reception succeeded.
+         * \return An error code if data reception failed.
+         */
+        auto receive( Data * begin, Data * end )
+        {
+            return m_mock_receiver->receive( begin, end );
+        }
+
+      private:
+        /**
+         * \brief The mock receiver.
+         */
+        Mock_Receiver * m_mock_receiver{};
+    };
+
+    /**
+     * \brief Constructor.
+     */
+    Mock_Receiver() = default;
+
+    Mock_Receiver( Mock_Receiver && ) = delete;
+
+    Mock_Receiver( Mock_Receiver const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Mock_Receiver() noexcept = default;
+
+    auto operator=( Mock_Receiver && ) = delete;
+
+    auto operator=( Mock_Receiver const & ) = delete;
+
+    /**
+     * \brief Get a movable handle to the mock receiver.
+     *
+     * \return A movable handle to the mock receiver.
+     */
+    auto handle() noexcept
+    {
+        return Handle{ *this };
+    }
+
+    MOCK_METHOD( (Result<Void, Error_Code>), initialize, () );
+
+    MOCK_METHOD( (Result<Data, Error_Code>), receive, () );
+
+    MOCK_METHOD( (Result<std::vector<Data>, Error_Code>), receive, (std::vector<Data>));
+
+    /**
+     * \brief Receive a block of data.
+     *
+     * \param[out] begin The beginning of the block of received data.
+     * \param[out] end The end of the block of received data.
+     *
+     * \return Nothing if data reception succeeded.
+     * \return An error code if data reception failed.
+     */
+    auto receive( Data * begin, Data * end ) -> Result<Void, Error_Code>
+    {
+        static_cast<void>( end );
+
+        auto const result = receive( std::vector<Data>{} );
+
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        std::for_each( result.value().begin(), result.value().end(), [ &begin ]( auto data ) {
+            *begin = data;
+
+            ++begin;
+        } );
+
+        return {};
+    }
+};
+
 } // namespace picolibrary::Testing::Unit::Asynchronous_Serial
 
 #endif // PICOLIBRARY_TESTING_UNIT_ASYNCHRONOUS_SERIAL_H
@@ -0,0 +1,448 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Timer_Queue interface.
+ */
+
+#ifndef PICOLIBRARY_TIMER_QUEUE_H
+#define PICOLIBRARY_TIMER_QUEUE_H
+
+#include <type_traits>
+
+namespace picolibrary {
+
+template<typename T>
+class Timer_Queue;
+
+/**
+ * \brief Intrusive timer queue node.
+ *
+ * Objects are made schedulable in a picolibrary::Timer_Queue by deriving from this
+ * class. An object can be scheduled in at most one queue at a time.
+ *
+ * \tparam Tick_Type The unsigned integer type used to represent points in time (ticks).
+ */
+template<typename Tick_Type>
+class Timer_Queue_Node {
+  public:
+    static_assert( std::is_unsigned_v<Tick_Type> );
+
+    /**
+     * \brief The unsigned integer type used to represent points in time (ticks).
+     */
+    using Tick = Tick_Type;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Timer_Queue_Node() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \attention Scheduling state is not copied, the constructed node is not scheduled.
+     */
+    constexpr Timer_Queue_Node( Timer_Queue_Node const & ) noexcept
+    {
+    }
+
+    /**
+     * \brief Destructor.
+     *
+     * \warning Destroying a node that is scheduled results in undefined behavior.
+     */
+    ~Timer_Queue_Node() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \attention Scheduling state is not assigned, the assigned to node's scheduling
+     *            state is not changed.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Timer_Queue_Node const & ) noexcept -> Timer_Queue_Node &
+    {
+        return *this;
+    }
+
+    /**
+     * \brief Check if the node is scheduled.
+     *
+     * \return true if the node is scheduled.
+     * \return false if the node is not scheduled.
+     */
+    constexpr auto scheduled() const noexcept -> bool
+    {
+        return m_scheduled;
+    }
+
+    /**
+     * \brief Get the node's expiration time.
+     *
+     * \return The node's expiration time (only meaningful if the node is scheduled).
+     */
+    constexpr auto expiration() const noexcept -> Tick
+    {
+        return m_expiration;
+    }
+
+  private:
+    template<typename>
+    friend class Timer_Queue;
+
+    /**
+     * \brief The node's expiration time.
+     */
+    Tick m_expiration{};
+
+    /**
+     * \brief The node's scheduling state.
+     */
+    bool m_scheduled{};
+
+    /**
+     * \brief The node's first child.
+     */
+    Timer_Queue_Node * m_child{};
+
+    /**
+     * \brief The node's next sibling.
+     */
+    Timer_Queue_Node * m_sibling{};
+
+    /**
+     * \brief The node's previous sibling, or the node's parent if the node is its
+     *        parent's first child.
+     */
+    Timer_Queue_Node * m_previous{};
+};
+
+/**
+ * \brief Intrusive timer queue.
+ *
+ * The queue is a pairing heap ordered by expiration time. It does not own, allocate, or
+ * copy the objects scheduled in it. Scheduling and accessing the next object to expire
+ * are O(1), and removing an object (expired or canceled) is amortized O(log n).
+ *
+ * Expiration times are compared in a way that is robust to tick counter wrap around:
+ * expiration time a is considered to precede expiration time b if b - a, computed using
+ * modular arithmetic, is less than half the range of the tick type.
+ *
+ * \tparam T The queue object type (must publicly derive from
+ *         picolibrary::Timer_Queue_Node).
+ *
+ * \attention All scheduled expiration times, and the current time passed to
+ *            picolibrary::Timer_Queue::expire(), must be within half the range of the
+ *            tick type of each other.
+ */
+template<typename T>
+class Timer_Queue {
+  public:
+    /**
+     * \brief The queue object type.
+     */
+    using Value = T;
+
+    /**
+     * \brief The unsigned integer type used to represent points in time (ticks).
+     */
+    using Tick = typename Value::Tick;
+
+    /**
+     * \brief The queue node type.
+     */
+    using Node = Timer_Queue_Node<Tick>;
+
+    static_assert( std::is_base_of_v<Node, Value> );
+
+    /**
+     * \brief Check if an expiration time precedes another.
+     *
+     * \param[in] a The expiration time to check.
+     * \param[in] b The expiration time to check against.
+     *
+     * \return true if a precedes b.
+     * \return false if a does not precede b.
+     */
+    static constexpr auto precedes( Tick a, Tick b ) noexcept -> bool
+    {
+        return static_cast<std::make_signed_t<Tick>>( static_cast<Tick>( a - b ) ) < 0;
+    }
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Timer_Queue() noexcept = default;
+
+    Timer_Queue( Timer_Queue && ) = delete;
+
+    Timer_Queue( Timer_Queue const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * \attention Objects scheduled in the queue are not destroyed or unscheduled.
+     */
+    ~Timer_Queue() noexcept = default;
+
+    auto operator=( Timer_Queue && ) = delete;
+
+    auto operator=( Timer_Queue const & ) = delete;
+
+    /**
+     * \brief Check if the queue is empty.
+     *
+     * \return true if the queue is empty.
+     * \return false if the queue is not empty.
+     */
+    constexpr auto empty() const noexcept -> bool
+    {
+        return not m_root;
+    }
+
+    /**
+     * \brief Access the object that will expire next.
+     *
+     * \warning Calling this function on an empty queue results in undefined behavior.
+     *
+     * \return The object that will expire next.
+     */
+    constexpr auto next() const noexcept -> Value &
+    {
+        return static_cast<Value &>( *m_root );
+    }
+
+    /**
+     * \brief Get the expiration time of the object that will expire next.
+     *
+     * \warning Calling this function on an empty queue results in undefined behavior.
+     *
+     * \return The expiration time of the object that will expire next.
+     */
+    constexpr auto next_expiration() const noexcept -> Tick
+    {
+        return m_root->m_expiration;
+    }
+
+    /**
+     * \brief Schedule an object.
+     *
+     * If the object is already scheduled in the queue, it is rescheduled.
+     *
+     * \warning Scheduling an object that is scheduled in a different queue results in
+     *          undefined behavior.
+     *
+     * \param[in] value The object to schedule.
+     * \param[in] expiration The object's expiration time.
+     */
+    constexpr void schedule( Value & value, Tick expiration ) noexcept
+    {
+        Node & node = value;
+
+        if ( node.m_scheduled ) {
+            remove( node );
+        } // if
+
+        node.m_expiration = expiration;
+        node.m_scheduled  = true;
+
+        m_root = m_root ? meld( m_root, &node ) : &node;
+    }
+
+    /**
+     * \brief Cancel an object's scheduling.
+     *
+     * \warning Canceling an object that is scheduled in a different queue results in
+     *          undefined behavior.
+     *
+     * \param[in] value The object to cancel the scheduling of (may be unscheduled).
+     */
+    constexpr void cancel( Value & value ) noexcept
+    {
+        Node & node = value;
+
+        if ( node.m_scheduled ) {
+            remove( node );
+        } // if
+    }
+
+    /**
+     * \brief Remove the object that will expire next from the queue.
+     *
+     * \warning Calling this function on an empty queue results in undefined behavior.
+     *
+     * \return The removed object.
+     */
+    constexpr auto pop() noexcept -> Value &
+    {
+        auto & node = *m_root;
+
+        remove( node );
+
+        return static_cast<Value &>( node );
+    }
+
+    /**
+     * \brief Remove and handle each object whose expiration time has been reached.
+     *
+     * Objects are removed before they are handled, so a handler may reschedule the
+     * object it is handling (e.g. periodic timers) or schedule and cancel other objects.
+     *
+     * \tparam Handler A unary functor that takes a Value & and returns void.
+     *
+     * \param[in] now The current time.
+     * \param[in] handler The expired object handler.
+     */
+    template<typename Handler>
+    constexpr void expire( Tick now, Handler && handler )
+    {
+        while ( m_root and not precedes( now, m_root->m_expiration ) ) {
+            handler( pop() );
+        } // while
+    }
+
+  private:
+    /**
+     * \brief The node that will expire next.
+     */
+    Node * m_root{};
+
+    /**
+     * \brief Meld two heaps.
+     *
+     * \param[in] a The root of the first heap (must not have siblings).
+     * \param[in] b The root of the second heap (must not have siblings).
+     *
+     * \return The root of the melded heap.
+     */
+    static constexpr auto meld( Node * a, Node * b ) noexcept -> Node *
+    {
+        if ( precedes( b->m_expiration, a->m_expiration ) ) {
+            auto const node = a;
+
+            a = b;
+            b = node;
+        } // if
+
+        b->m_previous = a;
+        b->m_sibling  = a->m_child;
+
+        if ( a->m_child ) {
+            a->m_child->m_previous = b;
+        } // if
+
+        a->m_child    = b;
+        a->m_previous = nullptr;
+
+        return a;
+    }
+
+    /**
+     * \brief Meld a list of sibling heaps using the standard two pass pairing.
+     *
+     * \param[in] first The first sibling heap root (may be null).
+     *
+     * \return The root of the melded heap (null if first is null).
+     */
+    static constexpr auto meld_siblings( Node * first ) noexcept -> Node *
+    {
+        // first pass: meld pairs left to right, collecting the melded pairs in reverse
+        // order
+        Node * pairs = nullptr;
+        while ( first ) {
+            auto const a = first;
+            auto const b = a->m_sibling;
+
+            first = b ? b->m_sibling : nullptr;
+
+            a->m_sibling = nullptr;
+
+            auto pair = a;
+            if ( b ) {
+                b->m_sibling = nullptr;
+
+                pair = meld( a, b );
+            } // if
+
+            pair->m_sibling = pairs;
+            pairs           = pair;
+        } // while
+
+        if ( not pairs ) {
+            return nullptr;
+        } // if
+
+        // second pass: meld the pairs right to left
+        auto root = pairs;
+        pairs     = pairs->m_sibling;
+
+        root->m_sibling = nullptr;
+
+        while ( pairs ) {
+            auto const pair = pairs;
+            pairs           = pairs->m_sibling;
+
+            pair->m_sibling = nullptr;
+
+            root = meld( root, pair );
+        } // while
+
+        root->m_previous = nullptr;
+
+        return root;
+    }
+
+    /**
+     * \brief Remove a scheduled node from the queue.
+     *
+     * \param[in] node The node to remove.
+     */
+    constexpr void remove( Node & node ) noexcept
+    {
+        auto const subheap = meld_siblings( node.m_child );
+
+        if ( &node == m_root ) {
+            m_root = subheap;
+        } else {
+            if ( node.m_previous->m_child == &node ) {
+                node.m_previous->m_child = node.m_sibling;
+            } else {
+                node.m_previous->m_sibling = node.m_sibling;
+            } // else
+
+            if ( node.m_sibling ) {
+                node.m_sibling->m_previous = node.m_previous;
+            } // if
+
+            if ( subheap ) {
+                m_root = meld( m_root, subheap );
+            } // if
+        }     // else
+
+        node.m_scheduled = false;
+        node.m_child     = nullptr;
+        node.m_sibling   = nullptr;
+        node.m_previous  = nullptr;
+    }
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_TIMER_QUEUE_H
@@ -0,0 +1,402 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Trace interface.
+ */
+
+#ifndef PICOLIBRARY_TRACE_H
+#define PICOLIBRARY_TRACE_H
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef PICOLIBRARY_TRACE_BUFFER_CAPACITY
+#define PICOLIBRARY_TRACE_BUFFER_CAPACITY 256
+#endif // PICOLIBRARY_TRACE_BUFFER_CAPACITY
+
+/**
+ * \brief Tracing facilities.
+ *
+ * Trace events are recorded in the picolibrary::Trace::Buffer that is installed for the
+ * calling thread of execution. If no buffer is installed, events are discarded.
+ *
+ * The PICOLIBRARY_TRACE_SCOPE(), PICOLIBRARY_TRACE_BEGIN(), PICOLIBRARY_TRACE_END(), and
+ * PICOLIBRARY_TRACE_INSTANT() macros are used to instrument code. If
+ * PICOLIBRARY_ENABLE_TRACING is not defined, the macros expand to nothing, and
+ * instrumentation has no run time or code size cost.
+ */
+namespace picolibrary::Trace {
+
+/**
+ * \brief Timestamp (clock ticks).
+ */
+using Timestamp = std::uint_fast64_t;
+
+/**
+ * \brief Clock (a function that returns the current timestamp).
+ */
+using Clock = Timestamp ( * )() noexcept;
+
+/**
+ * \brief Event phase.
+ */
+enum class Phase : std::uint_fast8_t {
+    BEGIN,   ///< The beginning of a duration.
+    END,     ///< The end of a duration.
+    INSTANT, ///< An instant.
+};
+
+/**
+ * \brief Event.
+ */
+struct Event {
+    /**
+     * \brief The event's name.
+     */
+    char const * name;
+
+    /**
+     * \brief The event's timestamp.
+     */
+    Timestamp timestamp;
+
+    /**
+     * \brief The event's phase.
+     */
+    Phase phase;
+};
+
+/**
+ * \brief Trace event ring buffer.
+ *
+ * The buffer stores the most recent picolibrary::Trace::Buffer::CAPACITY events. Once the
+ * buffer is full, recording an event overwrites the oldest event.
+ *
+ * \attention A buffer may only be recorded to by a single thread of execution, and may
+ *            not be read while it is being recorded to. Do not record to a buffer from
+ *            interrupt context unless the buffer is only ever recorded to from that
+ *            interrupt context.
+ */
+class Buffer {
+  public:
+    /**
+     * \brief The maximum number of events the buffer can store.
+     */
+    static constexpr auto CAPACITY = std::size_t{ PICOLIBRARY_TRACE_BUFFER_CAPACITY };
+
+    static_assert( CAPACITY > 0 );
+
+    /**
+     * \brief Thread ID.
+     */
+    using Thread_ID = std::uint_fast32_t;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] thread The ID of the thread of execution the buffer records events for.
+     * \param[in] clock The clock used to timestamp recorded events.
+     */
+    constexpr Buffer( Thread_ID thread, Clock clock ) noexcept :
+        m_thread{ thread },
+        m_clock{ clock }
+    {
+    }
+
+    Buffer( Buffer && ) = delete;
+
+    Buffer( Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Buffer() noexcept = default;
+
+    auto operator=( Buffer && ) = delete;
+
+    auto operator=( Buffer const & ) = delete;
+
+    /**
+     * \brief Get the ID of the thread of execution the buffer records events for.
+     *
+     * \return The ID of the thread of execution the buffer records events for.
+     */
+    constexpr auto thread() const noexcept
+    {
+        return m_thread;
+    }
+
+    /**
+     * \brief Check if the buffer is empty.
+     *
+     * \return true if the buffer is empty.
+     * \return false if the buffer is not empty.
+     */
+    constexpr auto empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /**
+     * \brief Get the number of events in the buffer.
+     *
+     * \return The number of events in the buffer.
+     */
+    constexpr auto size() const noexcept
+    {
+        return m_size;
+    }
+
+    /**
+     * \brief Get the number of events that have been overwritten.
+     *
+     * \return The number of events that have been overwritten.
+     */
+    constexpr auto overwritten() const noexcept
+    {
+        return m_overwritten;
+    }
+
+    /**
+     * \brief Record an event.
+     *
+     * \param[in] name The event's name.
+     * \param[in] phase The event's phase.
+     *
+     * \attention The event's name must outlive the buffer's use of it (string literals
+     *            are recommended).
+     */
+    void record( char const * name, Phase phase ) noexcept
+    {
+        m_events[ m_next ] = Event{ name, m_clock(), phase };
+
+        m_next = m_next + 1 == CAPACITY ? 0 : m_next + 1;
+
+        if ( m_size == CAPACITY ) {
+            ++m_overwritten;
+        } else {
+            ++m_size;
+        } // else
+    }
+
+    /**
+     * \brief Apply a functor to each event in the buffer, from oldest to newest.
+     *
+     * \tparam Functor A unary functor that takes a picolibrary::Trace::Event.
+     *
+     * \param[in] functor The functor to apply to each event in the buffer.
+     *
+     * \return The functor.
+     */
+    template<typename Functor>
+    constexpr auto for_each( Functor functor ) const noexcept
+    {
+        auto index = m_size == CAPACITY ? m_next : std::size_t{ 0 };
+
+        for ( auto i = std::size_t{ 0 }; i < m_size; ++i ) {
+            functor( m_events[ index ] );
+
+            index = index + 1 == CAPACITY ? 0 : index + 1;
+        } // for
+
+        return functor;
+    }
+
+    /**
+     * \brief Remove all events from the buffer.
+     */
+    constexpr void clear() noexcept
+    {
+        m_next        = 0;
+        m_size        = 0;
+        m_overwritten = 0;
+    }
+
+  private:
+    /**
+     * \brief The ID of the thread of execution the buffer records events for.
+     */
+    Thread_ID m_thread;
+
+    /**
+     * \brief The clock used to timestamp recorded events.
+     */
+    Clock m_clock;
+
+    /**
+     * \brief The events.
+     */
+    Event m_events[ CAPACITY ]{};
+
+    /**
+     * \brief The index of the next event to be written.
+     */
+    std::size_t m_next{};
+
+    /**
+     * \brief The number of events in the buffer.
+     */
+    std::size_t m_size{};
+
+    /**
+     * \brief The number of events that have been overwritten.
+     */
+    std::uint_fast32_t m_overwritten{};
+};
+
+/**
+ * \brief Install the buffer that events recorded by the calling thread of execution are
+ *        recorded in.
+ *
+ * \param[in] buffer The buffer to install (nullptr to discard events).
+ *
+ * \attention The buffer must outlive its installation.
+ *
+ * \attention If PICOLIBRARY_ENABLE_TRACING is not defined, this function does nothing.
+ */
+void install( Buffer * buffer ) noexcept;
+
+/**
+ * \brief Get the buffer that events recorded by the calling thread of execution are
+ *        recorded in.
+ *
+ * \return The buffer that events recorded by the calling thread of execution are
+ *         recorded in.
+ * \return nullptr if no buffer is installed for the calling thread of execution, or
+ *         PICOLIBRARY_ENABLE_TRACING is not defined.
+ */
+auto installed() noexcept -> Buffer *;
+
+/**
+ * \brief Record an event in the buffer that is installed for the calling thread of
+ *        execution (if any).
+ *
+ * \param[in] name The event's name.
+ * \param[in] phase The event's phase.
+ */
+inline void record( char const * name, Phase phase ) noexcept
+{
+    auto const buffer = installed();
+
+    if ( buffer ) {
+        buffer->record( name, phase );
+    } // if
+}
+
+/**
+ * \brief Duration scope.
+ *
+ * A picolibrary::Trace::Phase::BEGIN event is recorded when the scope is constructed, and
+ * a picolibrary::Trace::Phase::END event is recorded when the scope is destroyed.
+ */
+class Scope {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] name The name of the duration.
+     */
+    explicit Scope( char const * name ) noexcept : m_name{ name }
+    {
+        record( m_name, Phase::BEGIN );
+    }
+
+    Scope( Scope && ) = delete;
+
+    Scope( Scope const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Scope() noexcept
+    {
+        record( m_name, Phase::END );
+    }
+
+    auto operator=( Scope && ) = delete;
+
+    auto operator=( Scope const & ) = delete;
+
+  private:
+    /**
+     * \brief The name of the duration.
+     */
+    char const * m_name;
+};
+
+} // namespace picolibrary::Trace
+
+/**
+ * \brief Concatenate two tokens after macro expansion.
+ *
+ * \param[in] a The first token.
+ * \param[in] b The second token.
+ */
+#define PICOLIBRARY_TRACE_CONCATENATE( a, b ) \
+    PICOLIBRARY_TRACE_CONCATENATE_EXPANDED( a, b )
+
+/**
+ * \brief Concatenate two (already expanded) tokens.
+ *
+ * \param[in] a The first token.
+ * \param[in] b The second token.
+ */
+#define PICOLIBRARY_TRACE_CONCATENATE_EXPANDED( a, b ) a##b
+
+#ifdef PICOLIBRARY_ENABLE_TRACING
+/**
+ * \brief Trace the remainder of the enclosing scope.
+ *
+ * \param[in] name The name of the duration (a string literal).
+ */
+#define PICOLIBRARY_TRACE_SCOPE( name )                              \
+    ::picolibrary::Trace::Scope const PICOLIBRARY_TRACE_CONCATENATE( \
+        picolibrary_trace_scope_, __LINE__ ){ name }
+
+/**
+ * \brief Trace the beginning of a duration.
+ *
+ * \param[in] name The name of the duration (a string literal).
+ */
+#define PICOLIBRARY_TRACE_BEGIN( name ) \
+    ::picolibrary::Trace::record( name, ::picolibrary::Trace::Phase::BEGIN )
+
+/**
+ * \brief Trace the end of a duration.
+ *
+ * \param[in] name The name of the duration (a string literal).
+ */
+#define PICOLIBRARY_TRACE_END( name ) \
+    ::picolibrary::Trace::record( name, ::picolibrary::Trace::Phase::END )
+
+/**
+ * \brief Trace an instant.
+ *
+ * \param[in] name The name of the instant (a string literal).
+ */
+#define PICOLIBRARY_TRACE_INSTANT( name ) \
+    ::picolibrary::Trace::record( name, ::picolibrary::Trace::Phase::INSTANT )
+#else // PICOLIBRARY_ENABLE_TRACING
+#define PICOLIBRARY_TRACE_SCOPE( name ) static_cast<void>( 0 )
+#define PICOLIBRARY_TRACE_BEGIN( name ) static_cast<void>( 0 )
+#define PICOLIBRARY_TRACE_END( name ) static_cast<void>( 0 )
+#define PICOLIBRARY_TRACE_INSTANT( name ) static_cast<void>( 0 )
+#endif // PICOLIBRARY_ENABLE_TRACING
+
+#endif // PICOLIBRARY_TRACE_H
@@ -0,0 +1,104 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Trace::Chrome interface.
+ */
+
+#ifndef PICOLIBRARY_TRACE_CHROME_H
+#define PICOLIBRARY_TRACE_CHROME_H
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+#include "picolibrary/trace.h"
+#include "picolibrary/void.h"
+
+/**
+ * \brief Chrome trace event format (chrome://tracing, Perfetto) export facilities.
+ */
+namespace picolibrary::Trace::Chrome {
+
+/**
+ * \brief Write a trace event to a stream as a Chrome trace event JSON object.
+ *
+ * \param[in] stream The stream to write the trace event to.
+ * \param[in] clock_frequency The frequency (Hz) of the clock used to timestamp the trace
+ *            event.
+ * \param[in] thread The ID of the thread of execution that recorded the trace event.
+ * \param[in] event The trace event to write.
+ *
+ * \attention The trace event's name is written verbatim (it is not JSON escaped).
+ *
+ * \return Nothing if the write succeeded.
+ * \return An error code if the write failed.
+ */
+auto write(
+    Output_Stream &    stream,
+    std::uint_fast64_t clock_frequency,
+    Buffer::Thread_ID  thread,
+    Event const &      event ) noexcept -> Result<Void, Error_Code>;
+
+/**
+ * \brief Write the trace events in a collection of buffers to a stream as a Chrome trace
+ *        event JSON document.
+ *
+ * \param[in] stream The stream to write the trace events to.
+ * \param[in] clock_frequency The frequency (Hz) of the clock used to timestamp the trace
+ *            events.
+ * \param[in] begin The beginning of the collection of buffers to write.
+ * \param[in] end The end of the collection of buffers to write.
+ *
+ * \attention The buffers may not be recorded to while they are being written.
+ *
+ * \return Nothing if the write succeeded.
+ * \return An error code if the write failed.
+ */
+auto write(
+    Output_Stream &        stream,
+    std::uint_fast64_t     clock_frequency,
+    Buffer const * const * begin,
+    Buffer const * const * end ) noexcept -> Result<Void, Error_Code>;
+
+/**
+ * \brief Write the trace events in a buffer to a stream as a Chrome trace event JSON
+ *        document.
+ *
+ * \param[in] stream The stream to write the trace events to.
+ * \param[in] clock_frequency The frequency (Hz) of the clock used to timestamp the trace
+ *            events.
+ * \param[in] buffer The buffer to write.
+ *
+ * \attention The buffer may not be recorded to while it is being written.
+ *
+ * \return Nothing if the write succeeded.
+ * \return An error code if the write failed.
+ */
+inline auto write( Output_Stream & stream, std::uint_fast64_t clock_frequency, Buffer const & buffer ) noexcept
+    -> Result<Void, Error_Code>
+{
+    Buffer const * const buffers[]{ &buffer };
+
+    return write( stream, clock_frequency, buffers, buffers + 1 );
+}
+
+} // namespace picolibrary::Trace::Chrome
+
+#endif // PICOLIBRARY_TRACE_CHROME_H
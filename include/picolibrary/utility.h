@@ -23,11 +23,23 @@
 #ifndef PICOLIBRARY_UTILITY_H
 #define PICOLIBRARY_UTILITY_H
 
+#include <cstddef>
+
 #include "picolibrary/result.h"
 #include "picolibrary/void.h"
 
+#ifndef PICOLIBRARY_CACHE_LINE_SIZE
+#define PICOLIBRARY_CACHE_LINE_SIZE 64
+#endif // PICOLIBRARY_CACHE_LINE_SIZE
+
 namespace picolibrary {
 
+/**
+ * \brief The cache line size (bytes) used to prevent false sharing between data that is
+ *        written by different threads of execution.
+ */
+constexpr auto CACHE_LINE_SIZE = std::size_t{ PICOLIBRARY_CACHE_LINE_SIZE };
+
 /**
  * \brief NOP.
  *
@@ -0,0 +1,240 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Work_Stealing_Deque interface.
+ */
+
+#ifndef PICOLIBRARY_WORK_STEALING_DEQUE_H
+#define PICOLIBRARY_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#include "picolibrary/utility.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Bounded lock-free work-stealing deque.
+ *
+ * A fixed capacity Chase-Lev deque. The owning thread of execution pushes and pops
+ * elements at the bottom of the deque without contention in the common case, while any
+ * number of other threads of execution steal elements from the top of the deque.
+ *
+ * \tparam T The deque element type. Must be trivially copyable (typically a pointer to a
+ *         unit of work).
+ * \tparam N The deque capacity. Must be a power of two.
+ */
+template<typename T, std::size_t N>
+class Work_Stealing_Deque {
+  public:
+    static_assert( N and not( N & ( N - 1 ) ), "N must be a power of two" );
+
+    static_assert( std::is_trivially_copyable_v<T> );
+
+    /**
+     * \brief The deque element type.
+     */
+    using Value = T;
+
+    /**
+     * \brief The number of elements in the deque.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief Constructor.
+     */
+    Work_Stealing_Deque() noexcept = default;
+
+    Work_Stealing_Deque( Work_Stealing_Deque && ) = delete;
+
+    Work_Stealing_Deque( Work_Stealing_Deque const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Work_Stealing_Deque() noexcept = default;
+
+    auto operator=( Work_Stealing_Deque && ) = delete;
+
+    auto operator=( Work_Stealing_Deque const & ) = delete;
+
+    /**
+     * \brief Get the deque's capacity.
+     *
+     * \return The deque's capacity.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Check if the deque is empty.
+     *
+     * \attention The result is only a snapshot if called while other threads of execution
+     *            are active.
+     *
+     * \return true if the deque is empty.
+     * \return false if the deque is not empty.
+     */
+    [[nodiscard]] auto empty() const noexcept
+    {
+        return m_bottom.load( std::memory_order_acquire ) <= m_top.load( std::memory_order_acquire );
+    }
+
+    /**
+     * \brief Push an element onto the bottom of the deque.
+     *
+     * \attention This function may only be called by the owning thread of execution.
+     *
+     * \param[in] value The element to push onto the bottom of the deque.
+     *
+     * \return true if the element was pushed onto the deque.
+     * \return false if the deque is full.
+     */
+    auto push( Value value ) noexcept
+    {
+        auto const bottom = m_bottom.load( std::memory_order_relaxed );
+        auto const top    = m_top.load( std::memory_order_acquire );
+
+        if ( bottom - top >= static_cast<Index>( N ) ) {
+            return false;
+        } // if
+
+        m_elements[ bottom & MASK ].store( value, std::memory_order_relaxed );
+
+        std::atomic_thread_fence( std::memory_order_release );
+
+        m_bottom.store( bottom + 1, std::memory_order_relaxed );
+
+        return true;
+    }
+
+    /**
+     * \brief Pop an element from the bottom of the deque.
+     *
+     * \attention This function may only be called by the owning thread of execution.
+     *
+     * \param[out] value The popped element.
+     *
+     * \return true if an element was popped from the deque.
+     * \return false if the deque is empty.
+     */
+    auto pop( Value & value ) noexcept
+    {
+        auto const bottom = m_bottom.load( std::memory_order_relaxed ) - 1;
+
+        m_bottom.store( bottom, std::memory_order_relaxed );
+
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+
+        auto top = m_top.load( std::memory_order_relaxed );
+
+        if ( top > bottom ) {
+            m_bottom.store( bottom + 1, std::memory_order_relaxed );
+
+            return false;
+        } // if
+
+        auto const element = m_elements[ bottom & MASK ].load( std::memory_order_relaxed );
+
+        if ( top < bottom ) {
+            value = element;
+
+            return true;
+        } // if
+
+        auto const popped = m_top.compare_exchange_strong(
+            top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed );
+
+        m_bottom.store( bottom + 1, std::memory_order_relaxed );
+
+        if ( popped ) {
+            value = element;
+        } // if
+
+        return popped;
+    }
+
+    /**
+     * \brief Steal an element from the top of the deque.
+     *
+     * \param[out] value The stolen element.
+     *
+     * \return true if an element was stolen from the deque.
+     * \return false if the deque is empty, or another thread of execution took the
+     *         element first.
+     */
+    auto steal( Value & value ) noexcept
+    {
+        auto top = m_top.load( std::memory_order_acquire );
+
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+
+        auto const bottom = m_bottom.load( std::memory_order_acquire );
+
+        if ( top >= bottom ) {
+            return false;
+        } // if
+
+        auto const element = m_elements[ top & MASK ].load( std::memory_order_relaxed );
+
+        if ( not m_top.compare_exchange_strong(
+                 top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) ) {
+            return false;
+        } // if
+
+        value = element;
+
+        return true;
+    }
+
+  private:
+    /**
+     * \brief Deque index.
+     */
+    using Index = std::ptrdiff_t;
+
+    /**
+     * \brief The mask used to convert an index to an element position.
+     */
+    static constexpr auto MASK = Index{ N - 1 };
+
+    /**
+     * \brief The index of the top of the deque (the next element to be stolen).
+     */
+    alignas( CACHE_LINE_SIZE ) std::atomic<Index> m_top{};
+
+    /**
+     * \brief The index of the bottom of the deque (the next element to be pushed).
+     */
+    alignas( CACHE_LINE_SIZE ) std::atomic<Index> m_bottom{};
+
+    /**
+     * \brief The deque elements.
+     */
+    alignas( CACHE_LINE_SIZE ) std::atomic<Value> m_elements[ N ]{};
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_WORK_STEALING_DEQUE_H
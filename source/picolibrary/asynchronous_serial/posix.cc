@@ -0,0 +1,103 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Asynchronous_Serial POSIX implementation.
+ */
+
+#include "picolibrary/asynchronous_serial/posix.h"
+
+#include <cerrno>
+#include <cstddef>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include "picolibrary/posix.h"
+#include "picolibrary/result.h"
+
+namespace picolibrary::Asynchronous_Serial {
+
+namespace {
+
+/**
+ * \brief Check if an errno value indicates that an operation on a non-blocking file
+ *        descriptor would have blocked.
+ *
+ * \param[in] error The errno value to check.
+ *
+ * \return true if the errno value indicates that the operation would have blocked.
+ * \return false if the errno value does not indicate that the operation would have
+ *         blocked.
+ */
+auto would_block( int error ) noexcept -> bool
+{
+#if EAGAIN == EWOULDBLOCK
+    return error == EAGAIN;
+#else  // EAGAIN == EWOULDBLOCK
+    return error == EAGAIN or error == EWOULDBLOCK;
+#endif // EAGAIN == EWOULDBLOCK
+}
+
+} // namespace
+
+auto Posix_Transmitter::initialize() noexcept -> Result<Void, Error_Code>
+{
+    auto const flags = ::fcntl( m_file_descriptor, F_GETFL );
+    if ( flags < 0 ) {
+        return make_error( Posix::make_errno_error_code( errno ) );
+    } // if
+
+    if ( ( flags & O_ACCMODE ) == O_RDONLY ) {
+        return make_error( Posix::make_errno_error_code( EBADF ) );
+    } // if
+
+    return {};
+}
+
+auto Posix_Transmitter::transmit( Data const * begin, Data const * end ) noexcept
+    -> Result<Void, Error_Code>
+{
+    while ( begin != end ) {
+        auto const written = ::write(
+            m_file_descriptor, begin, static_cast<std::size_t>( end - begin ) );
+        if ( written >= 0 ) {
+            begin += written;
+
+            continue;
+        } // if
+
+        if ( errno == EINTR ) {
+            continue;
+        } // if
+
+        if ( not would_block( errno ) ) {
+            return make_error( Posix::make_errno_error_code( errno ) );
+        } // if
+
+        auto descriptor = ::pollfd{ m_file_descriptor, POLLOUT, 0 };
+        if ( ::poll( &descriptor, 1, -1 ) < 0 and errno != EINTR ) {
+            return make_error( Posix::make_errno_error_code( errno ) );
+        } // if
+    } // while
+
+    return {};
+}
+
+} // namespace picolibrary::Asynchronous_Serial
@@ -0,0 +1,39 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Error_Statistics implementation.
+ */
+
+#include "picolibrary/error_statistics.h"
+
+#include "picolibrary/error.h"
+#include "picolibrary/result.h"
+
+namespace picolibrary {
+
+Error_Statistics Error_Statistics::INSTANCE{};
+
+#ifdef PICOLIBRARY_ENABLE_ERROR_STATISTICS
+void record_error( Error_Code const & error ) noexcept
+{
+    Error_Statistics::instance().record( error );
+}
+#endif // PICOLIBRARY_ENABLE_ERROR_STATISTICS
+
+} // namespace picolibrary
@@ -0,0 +1,161 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Parallel implementation.
+ */
+
+#include "picolibrary/parallel.h"
+
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+namespace picolibrary::Parallel {
+
+Thread_Pool::Thread_Pool() noexcept :
+    Thread_Pool{ std::max<Size>( std::thread::hardware_concurrency(), 1 ) - 1 }
+{
+}
+
+Thread_Pool::Thread_Pool( Size workers ) noexcept :
+    m_deques{ std::make_unique<Deque[]>( workers + 1 ) }
+{
+    m_workers.reserve( workers );
+
+    for ( auto participant = Size{ 1 }; participant <= workers; ++participant ) {
+        m_workers.emplace_back( [ this, participant ]() noexcept { work( participant ); } );
+    } // for
+}
+
+Thread_Pool::~Thread_Pool() noexcept
+{
+    {
+        auto const guard = std::lock_guard<std::mutex>{ m_mutex };
+
+        m_stop = true;
+    }
+
+    m_start.notify_all();
+
+    for ( auto & worker : m_workers ) {
+        worker.join();
+    } // for
+}
+
+void Thread_Pool::run( Size chunks, void const * context, Executor executor ) noexcept
+{
+    if ( not chunks ) {
+        return;
+    } // if
+
+    m_executor = executor;
+    m_context  = context;
+    m_chunks   = chunks;
+    m_remaining.store( chunks, std::memory_order_relaxed );
+
+    // no job is active, so this thread of execution owns every deque until the worker
+    // threads are woken
+    auto const participants = this->participants();
+    auto       chunk        = Size{};
+    for ( ; chunk < chunks; ++chunk ) {
+        if ( not m_deques[ chunk % participants ].push( chunk ) ) {
+            break;
+        } // if
+    }     // for
+
+    m_next_unqueued_chunk.store( chunk, std::memory_order_relaxed );
+
+    if ( not m_workers.empty() ) {
+        {
+            auto const guard = std::lock_guard<std::mutex>{ m_mutex };
+
+            m_active = m_workers.size();
+            ++m_generation;
+        }
+
+        m_start.notify_all();
+    } // if
+
+    participate( 0 );
+
+    auto lock = std::unique_lock<std::mutex>{ m_mutex };
+    m_done.wait( lock, [ this ]() noexcept { return not m_active; } );
+}
+
+void Thread_Pool::work( Size participant ) noexcept
+{
+    auto generation = Size{};
+
+    for ( ;; ) {
+        {
+            auto lock = std::unique_lock<std::mutex>{ m_mutex };
+            m_start.wait(
+                lock, [ this, generation ]() noexcept { return m_stop or m_generation != generation; } );
+
+            if ( m_stop ) {
+                return;
+            } // if
+
+            generation = m_generation;
+        }
+
+        participate( participant );
+
+        {
+            auto const guard = std::lock_guard<std::mutex>{ m_mutex };
+
+            if ( not --m_active ) {
+                m_done.notify_one();
+            } // if
+        }
+    } // for
+}
+
+void Thread_Pool::participate( Size participant ) noexcept
+{
+    auto const participants = this->participants();
+    auto &     deque        = m_deques[ participant ];
+
+    auto const execute = [ this ]( Size chunk ) noexcept {
+        m_executor( m_context, chunk );
+        m_remaining.fetch_sub( 1, std::memory_order_acq_rel );
+    };
+
+    auto chunk = Size{};
+
+    while ( deque.pop( chunk ) ) {
+        execute( chunk );
+    } // while
+
+    while ( ( chunk = m_next_unqueued_chunk.fetch_add( 1, std::memory_order_relaxed ) ) < m_chunks ) {
+        execute( chunk );
+    } // while
+
+    for ( auto victim = participant; m_remaining.load( std::memory_order_acquire ); ) {
+        victim = ( victim + 1 ) % participants;
+
+        if ( victim == participant ) {
+            std::this_thread::yield();
+        } else if ( m_deques[ victim ].steal( chunk ) ) {
+            execute( chunk );
+        } // else if
+    }     // for
+}
+
+} // namespace picolibrary::Parallel
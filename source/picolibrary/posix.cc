@@ -0,0 +1,38 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Posix implementation.
+ */
+
+#include "picolibrary/posix.h"
+
+#include <cstring>
+
+namespace picolibrary::Posix {
+
+Errno_Category const Errno_Category::INSTANCE{};
+
+#ifndef PICOLIBRARY_SUPPRESS_HUMAN_READABLE_ERROR_INFORMATION
+auto Errno_Category::error_description( Error_ID id ) const noexcept -> char const *
+{
+    return std::strerror( id );
+}
+#endif // PICOLIBRARY_SUPPRESS_HUMAN_READABLE_ERROR_INFORMATION
+
+} // namespace picolibrary::Posix
@@ -0,0 +1,58 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Trace implementation.
+ */
+
+#include "picolibrary/trace.h"
+
+namespace picolibrary::Trace {
+
+#ifdef PICOLIBRARY_ENABLE_TRACING
+namespace {
+
+/**
+ * \brief The buffer that events recorded by the calling thread of execution are recorded
+ *        in.
+ */
+thread_local Buffer * installed_buffer{};
+
+} // namespace
+
+void install( Buffer * buffer ) noexcept
+{
+    installed_buffer = buffer;
+}
+
+auto installed() noexcept -> Buffer *
+{
+    return installed_buffer;
+}
+#else  // PICOLIBRARY_ENABLE_TRACING
+void install( Buffer * ) noexcept
+{
+}
+
+auto installed() noexcept -> Buffer *
+{
+    return nullptr;
+}
+#endif // PICOLIBRARY_ENABLE_TRACING
+
+} // namespace picolibrary::Trace
@@ -0,0 +1,103 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Trace::Chrome implementation.
+ */
+
+#include "picolibrary/trace/chrome.h"
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/format.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+#include "picolibrary/trace.h"
+#include "picolibrary/void.h"
+
+namespace picolibrary::Trace::Chrome {
+
+auto write(
+    Output_Stream &    stream,
+    std::uint_fast64_t clock_frequency,
+    Buffer::Thread_ID  thread,
+    Event const &      event ) noexcept -> Result<Void, Error_Code>
+{
+    // the Chrome trace event format expresses timestamps in microseconds, split the
+    // conversion to avoid overflowing when the clock frequency is high
+    auto const nanoseconds = event.timestamp / clock_frequency * 1'000'000'000
+                             + event.timestamp % clock_frequency * 1'000'000'000
+                                   / clock_frequency;
+    auto const fraction = static_cast<std::uint_fast16_t>( nanoseconds % 1'000 );
+
+    return stream.print(
+        "{{\"name\":\"{}\",\"ph\":\"{}\",\"ts\":{}.{}{}{},\"pid\":0,\"tid\":{}{}}}",
+        event.name,
+        event.phase == Phase::BEGIN ? "B" : event.phase == Phase::END ? "E" : "i",
+        Format::Decimal{ nanoseconds / 1'000 },
+        static_cast<char>( '0' + fraction / 100 ),
+        static_cast<char>( '0' + fraction / 10 % 10 ),
+        static_cast<char>( '0' + fraction % 10 ),
+        Format::Decimal{ thread },
+        event.phase == Phase::INSTANT ? ",\"s\":\"t\"" : "" );
+}
+
+auto write(
+    Output_Stream &        stream,
+    std::uint_fast64_t     clock_frequency,
+    Buffer const * const * begin,
+    Buffer const * const * end ) noexcept -> Result<Void, Error_Code>
+{
+    {
+        auto result = stream.put( "{\"traceEvents\":[" );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+    }
+
+    auto separator = "\n";
+    auto result    = Result<Void, Error_Code>{};
+
+    for ( ; begin != end and not result.is_error(); ++begin ) {
+        auto const thread = ( *begin )->thread();
+
+        ( *begin )->for_each( [ & ]( Event const & event ) noexcept {
+            if ( result.is_error() ) {
+                return;
+            } // if
+
+            result = stream.put( separator );
+            if ( result.is_error() ) {
+                return;
+            } // if
+
+            separator = ",\n";
+
+            result = write( stream, clock_frequency, thread, event );
+        } );
+    } // for
+
+    if ( result.is_error() ) {
+        return result.error();
+    } // if
+
+    return stream.put( "\n],\"displayTimeUnit\":\"ns\"}\n" );
+}
+
+} // namespace picolibrary::Trace::Chrome
@@ -0,0 +1,87 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::CRC benchmark program.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "picolibrary/crc.h"
+
+namespace {
+
+using ::picolibrary::CRC::Augmented_Byte_Indexed_Lookup_Table_Calculator;
+using ::picolibrary::CRC::Augmented_Nibble_Indexed_Lookup_Table_Calculator;
+using ::picolibrary::CRC::Bitwise_Calculator;
+using ::picolibrary::CRC::Direct_Byte_Indexed_Lookup_Table_Calculator;
+using ::picolibrary::CRC::Direct_Nibble_Indexed_Lookup_Table_Calculator;
+using ::picolibrary::CRC::Parameters;
+
+/**
+ * \brief CRC-32 calculation parameters.
+ */
+constexpr auto CRC_32 = Parameters<std::uint32_t>{ .polynomial          = 0x04C1'1DB7,
+                                                   .initial_remainder   = 0xFFFF'FFFF,
+                                                   .input_is_reflected  = true,
+                                                   .output_is_reflected = true,
+                                                   .xor_output          = 0xFFFF'FFFF };
+
+} // namespace
+
+/**
+ * \brief Measure CRC calculator throughput.
+ *
+ * \tparam Calculator The type of CRC calculator to measure.
+ *
+ * \param[in] state The benchmark state.
+ */
+template<typename Calculator>
+void calculate( ::benchmark::State & state )
+{
+    auto const calculator = Calculator{ CRC_32 };
+    auto const message    = std::vector<std::uint8_t>( state.range( 0 ), 0xA5 );
+
+    for ( auto _ : state ) {
+        ::benchmark::DoNotOptimize( message.data() );
+        ::benchmark::DoNotOptimize(
+            calculator.calculate( message.begin(), message.end() ) );
+    } // for
+
+    state.SetBytesProcessed( state.iterations() * state.range( 0 ) );
+}
+
+BENCHMARK_TEMPLATE( calculate, Bitwise_Calculator<std::uint32_t> )
+    ->RangeMultiplier( 8 )
+    ->Range( 8, 4096 );
+BENCHMARK_TEMPLATE( calculate, Augmented_Nibble_Indexed_Lookup_Table_Calculator<std::uint32_t> )
+    ->RangeMultiplier( 8 )
+    ->Range( 8, 4096 );
+BENCHMARK_TEMPLATE( calculate, Direct_Nibble_Indexed_Lookup_Table_Calculator<std::uint32_t> )
+    ->RangeMultiplier( 8 )
+    ->Range( 8, 4096 );
+BENCHMARK_TEMPLATE( calculate, Augmented_Byte_Indexed_Lookup_Table_Calculator<std::uint32_t> )
+    ->RangeMultiplier( 8 )
+    ->Range( 8, 4096 );
+BENCHMARK_TEMPLATE( calculate, Direct_Byte_Indexed_Lookup_Table_Calculator<std::uint32_t> )
+    ->RangeMultiplier( 8 )
+    ->Range( 8, 4096 );
+
+BENCHMARK_MAIN();
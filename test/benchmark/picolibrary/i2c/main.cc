@@ -0,0 +1,171 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::I2C benchmark program.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "picolibrary/error.h"
+#include "picolibrary/i2c.h"
+#include "picolibrary/result.h"
+#include "picolibrary/testing/fake/i2c.h"
+#include "picolibrary/void.h"
+
+namespace {
+
+using ::picolibrary::Generic_Error;
+using ::picolibrary::Result;
+using ::picolibrary::Void;
+using ::picolibrary::I2C::Address;
+using ::picolibrary::Testing::Fake::I2C::Fake_Controller;
+
+/**
+ * \brief Benchmark bus multiplexer aligner.
+ */
+struct Bus_Multiplexer_Aligner {
+    /**
+     * \brief Align the bus multiplexer(s).
+     *
+     * \return Nothing.
+     */
+    constexpr auto operator()() const noexcept -> Result<Void, Void>
+    {
+        return {};
+    }
+};
+
+/**
+ * \brief Benchmarked device implementation.
+ */
+using Basic_Device =
+    ::picolibrary::I2C::Device<Bus_Multiplexer_Aligner, Fake_Controller, std::uint8_t>;
+
+/**
+ * \brief Benchmark device.
+ */
+class Device : public Basic_Device {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] controller The controller used to interact with the bus the device is
+     *            attached to.
+     */
+    Device( Fake_Controller & controller ) noexcept :
+        Basic_Device{ Bus_Multiplexer_Aligner{},
+                      controller,
+                      controller.device_address(),
+                      Generic_Error::NONRESPONSIVE_DEVICE }
+    {
+    }
+
+    using Basic_Device::read;
+    using Basic_Device::write;
+};
+
+} // namespace
+
+/**
+ * \brief Measure picolibrary::I2C::Device::read( std::uint8_t ) call path overhead.
+ *
+ * \param[in] state The benchmark state.
+ */
+void readRegister( ::benchmark::State & state )
+{
+    auto controller = Fake_Controller{ Address{ Address::NUMERIC, 0b010'0000 } };
+    auto device     = Device{ controller };
+
+    for ( auto _ : state ) {
+        ::benchmark::DoNotOptimize( device.read( 0x09 ) );
+    } // for
+
+    state.SetItemsProcessed( state.iterations() );
+}
+
+BENCHMARK( readRegister );
+
+/**
+ * \brief Measure picolibrary::I2C::Device::write( std::uint8_t, std::uint8_t ) call path
+ *        overhead.
+ *
+ * \param[in] state The benchmark state.
+ */
+void writeRegister( ::benchmark::State & state )
+{
+    auto controller = Fake_Controller{ Address{ Address::NUMERIC, 0b010'0000 } };
+    auto device     = Device{ controller };
+    auto data       = std::uint8_t{};
+
+    for ( auto _ : state ) {
+        ::benchmark::DoNotOptimize( device.write( 0x0A, data++ ) );
+    } // for
+
+    state.SetItemsProcessed( state.iterations() );
+}
+
+BENCHMARK( writeRegister );
+
+/**
+ * \brief Measure picolibrary::I2C::Device::read( std::uint8_t, std::uint8_t *,
+ *        std::uint8_t * ) throughput.
+ *
+ * \param[in] state The benchmark state.
+ */
+void readRegisterBlock( ::benchmark::State & state )
+{
+    auto controller = Fake_Controller{ Address{ Address::NUMERIC, 0b010'0000 } };
+    auto device     = Device{ controller };
+    auto data       = std::vector<std::uint8_t>( state.range( 0 ) );
+
+    for ( auto _ : state ) {
+        ::benchmark::DoNotOptimize(
+            device.read( 0x00, data.data(), data.data() + data.size() ) );
+    } // for
+
+    state.SetBytesProcessed( state.iterations() * state.range( 0 ) );
+}
+
+BENCHMARK( readRegisterBlock )->RangeMultiplier( 4 )->Range( 1, 256 );
+
+/**
+ * \brief Measure picolibrary::I2C::Device::write( std::uint8_t, std::uint8_t const *,
+ *        std::uint8_t const * ) throughput.
+ *
+ * \param[in] state The benchmark state.
+ */
+void writeRegisterBlock( ::benchmark::State & state )
+{
+    auto controller = Fake_Controller{ Address{ Address::NUMERIC, 0b010'0000 } };
+    auto device     = Device{ controller };
+    auto data       = std::vector<std::uint8_t>( state.range( 0 ), 0xA5 );
+
+    for ( auto _ : state ) {
+        ::benchmark::DoNotOptimize(
+            device.write( 0x00, data.data(), data.data() + data.size() ) );
+    } // for
+
+    state.SetBytesProcessed( state.iterations() * state.range( 0 ) );
+}
+
+BENCHMARK( writeRegisterBlock )->RangeMultiplier( 4 )->Range( 1, 256 );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,222 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::MCP23008 benchmark program.
+ */
+
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+#include "picolibrary/error.h"
+#include "picolibrary/gpio.h"
+#include "picolibrary/microchip/mcp23008.h"
+#include "picolibrary/result.h"
+#include "picolibrary/testing/fake/i2c.h"
+#include "picolibrary/void.h"
+
+namespace {
+
+using ::picolibrary::Generic_Error;
+using ::picolibrary::Result;
+using ::picolibrary::Void;
+using ::picolibrary::GPIO::Initial_Pin_State;
+using ::picolibrary::Microchip::MCP23008::Open_Drain_IO_Pin;
+using ::picolibrary::Microchip::MCP23008::Push_Pull_IO_Pin;
+using ::picolibrary::Testing::Fake::I2C::Timed_Fake_Controller;
+using ::picolibrary::Testing::Fake::I2C::Timing;
+
+/**
+ * \brief Benchmark bus multiplexer aligner.
+ */
+struct Bus_Multiplexer_Aligner {
+    /**
+     * \brief Align the bus multiplexer(s).
+     *
+     * \return Nothing.
+     */
+    constexpr auto operator()() const noexcept -> Result<Void, Void>
+    {
+        return {};
+    }
+};
+
+/**
+ * \brief Benchmark driver.
+ */
+using Driver =
+    ::picolibrary::Microchip::MCP23008::Driver<Bus_Multiplexer_Aligner, Timed_Fake_Controller>;
+
+/**
+ * \brief Construct a benchmark driver.
+ *
+ * \param[in] controller The controller used to interact with the bus the MCP23008 is
+ *            attached to.
+ *
+ * \return The constructed driver.
+ */
+auto make_driver( Timed_Fake_Controller & controller ) noexcept
+{
+    return Driver{ Bus_Multiplexer_Aligner{},
+                   controller,
+                   controller.device_address(),
+                   Generic_Error::NONRESPONSIVE_DEVICE };
+}
+
+/**
+ * \brief Construct a benchmark controller.
+ *
+ * \return The constructed controller (100 kHz SCL clock frequency).
+ */
+auto make_controller() noexcept
+{
+    return Timed_Fake_Controller{ Timing{},
+                                  ::picolibrary::Microchip::MCP23008::Address::min() };
+}
+
+/**
+ * \brief Report the estimated per iteration bus transactions and bus time (microseconds)
+ *        that would be required on real hardware.
+ *
+ * \param[in] state The benchmark state.
+ * \param[in] controller The benchmark controller.
+ * \param[in] baseline The bus timing estimate prior to the benchmark loop.
+ */
+void report_bus_timing(
+    ::benchmark::State &                                      state,
+    Timed_Fake_Controller const &                             controller,
+    ::picolibrary::Testing::Fake::Bus_Timing_Estimator const & baseline )
+{
+    auto const & estimate = controller.bus_timing();
+
+    state.counters[ "bus_transactions" ] = ::benchmark::Counter{
+        static_cast<double>( estimate.transactions() - baseline.transactions() ),
+        ::benchmark::Counter::kAvgIterations
+    };
+    state.counters[ "bus_us" ] = ::benchmark::Counter{
+        static_cast<double>( estimate.cycles() - baseline.cycles() ) * 1'000'000.0
+            / estimate.clock_frequency(),
+        ::benchmark::Counter::kAvgIterations
+    };
+}
+
+} // namespace
+
+/**
+ * \brief Measure picolibrary::Microchip::MCP23008::Driver::write_gpio() call path
+ *        overhead.
+ *
+ * \param[in] state The benchmark state.
+ */
+void writeGPIO( ::benchmark::State & state )
+{
+    auto controller = make_controller();
+    auto driver     = make_driver( controller );
+    auto data       = std::uint8_t{};
+
+    auto const baseline = controller.bus_timing();
+
+    for ( auto _ : state ) {
+        ::benchmark::DoNotOptimize( driver.write_gpio( data++ ) );
+    } // for
+
+    state.SetItemsProcessed( state.iterations() );
+    report_bus_timing( state, controller, baseline );
+}
+
+BENCHMARK( writeGPIO );
+
+/**
+ * \brief Measure picolibrary::Microchip::MCP23008::Push_Pull_IO_Pin::toggle() call path
+ *        overhead.
+ *
+ * \param[in] state The benchmark state.
+ */
+void pushPullIOPinToggle( ::benchmark::State & state )
+{
+    auto controller = make_controller();
+    auto driver     = make_driver( controller );
+    auto pin        = Push_Pull_IO_Pin<Driver>{ driver, 0b0000'0100 };
+
+    static_cast<void>( pin.initialize( Initial_Pin_State::LOW ) );
+
+    auto const baseline = controller.bus_timing();
+
+    for ( auto _ : state ) {
+        ::benchmark::DoNotOptimize( pin.toggle() );
+    } // for
+
+    state.SetItemsProcessed( state.iterations() );
+    report_bus_timing( state, controller, baseline );
+}
+
+BENCHMARK( pushPullIOPinToggle );
+
+/**
+ * \brief Measure picolibrary::Microchip::MCP23008::Push_Pull_IO_Pin::state() call path
+ *        overhead.
+ *
+ * \param[in] state The benchmark state.
+ */
+void pushPullIOPinState( ::benchmark::State & state )
+{
+    auto controller = make_controller();
+    auto driver     = make_driver( controller );
+    auto pin        = Push_Pull_IO_Pin<Driver>{ driver, 0b0000'0100 };
+
+    static_cast<void>( pin.initialize( Initial_Pin_State::LOW ) );
+
+    auto const baseline = controller.bus_timing();
+
+    for ( auto _ : state ) {
+        ::benchmark::DoNotOptimize( pin.state() );
+    } // for
+
+    state.SetItemsProcessed( state.iterations() );
+    report_bus_timing( state, controller, baseline );
+}
+
+BENCHMARK( pushPullIOPinState );
+
+/**
+ * \brief Measure picolibrary::Microchip::MCP23008::Open_Drain_IO_Pin::toggle() call path
+ *        overhead.
+ *
+ * \param[in] state The benchmark state.
+ */
+void openDrainIOPinToggle( ::benchmark::State & state )
+{
+    auto controller = make_controller();
+    auto driver     = make_driver( controller );
+    auto pin        = Open_Drain_IO_Pin<Driver>{ driver, 0b0000'0100 };
+
+    static_cast<void>( pin.initialize( Initial_Pin_State::LOW ) );
+
+    auto const baseline = controller.bus_timing();
+
+    for ( auto _ : state ) {
+        ::benchmark::DoNotOptimize( pin.toggle() );
+    } // for
+
+    state.SetItemsProcessed( state.iterations() );
+    report_bus_timing( state, controller, baseline );
+}
+
+BENCHMARK( openDrainIOPinToggle );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::MPMC_Queue benchmark program.
+ */
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+#include "benchmark/benchmark.h"
+#include "picolibrary/mpmc_queue.h"
+
+namespace {
+
+/**
+ * \brief The queue shared by the benchmark threads.
+ */
+auto queue = ::picolibrary::MPMC_Queue<std::uint32_t, 1024>{};
+
+/**
+ * \brief The mutex protected queue shared by the baseline benchmark threads.
+ */
+auto mutex_queue = std::deque<std::uint32_t>{};
+
+/**
+ * \brief The mutex that protects the baseline benchmark queue.
+ */
+auto mutex = std::mutex{};
+
+} // namespace
+
+/**
+ * \brief Measure picolibrary::MPMC_Queue push/pop throughput.
+ *
+ * \param[in] state The benchmark state.
+ */
+void pushPop( ::benchmark::State & state )
+{
+    auto value = static_cast<std::uint32_t>( state.thread_index() );
+
+    for ( auto _ : state ) {
+        while ( not queue.push( value ) ) {
+        } // while
+
+        while ( not queue.pop( value ) ) {
+        } // while
+    } // for
+
+    ::benchmark::DoNotOptimize( value );
+
+    state.SetItemsProcessed( state.iterations() );
+}
+
+BENCHMARK( pushPop )->ThreadRange( 1, 32 )->UseRealTime();
+
+/**
+ * \brief Measure mutex protected std::deque push/pop throughput (baseline).
+ *
+ * \param[in] state The benchmark state.
+ */
+void pushPopMutex( ::benchmark::State & state )
+{
+    auto value = static_cast<std::uint32_t>( state.thread_index() );
+
+    for ( auto _ : state ) {
+        {
+            auto const guard = std::lock_guard{ mutex };
+
+            mutex_queue.push_back( value );
+        }
+
+        {
+            auto const guard = std::lock_guard{ mutex };
+
+            value = mutex_queue.front();
+            mutex_queue.pop_front();
+        }
+    } // for
+
+    ::benchmark::DoNotOptimize( value );
+
+    state.SetItemsProcessed( state.iterations() );
+}
+
+BENCHMARK( pushPopMutex )->ThreadRange( 1, 32 )->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,216 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Output_Stream benchmark program.
+ */
+
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+#include "picolibrary/error.h"
+#include "picolibrary/format.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+#include "picolibrary/void.h"
+
+namespace {
+
+using ::picolibrary::Error_Code;
+using ::picolibrary::Output_Stream;
+using ::picolibrary::Result;
+using ::picolibrary::Stream_Buffer;
+using ::picolibrary::Void;
+using ::picolibrary::Format::Binary;
+using ::picolibrary::Format::Decimal;
+using ::picolibrary::Format::Hexadecimal;
+
+/**
+ * \brief Benchmark device access buffer that counts and discards the data written to it.
+ */
+class Null_Stream_Buffer : public Stream_Buffer {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    Null_Stream_Buffer() = default;
+
+    Null_Stream_Buffer( Null_Stream_Buffer && ) = delete;
+
+    Null_Stream_Buffer( Null_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Null_Stream_Buffer() noexcept = default;
+
+    auto operator=( Null_Stream_Buffer && ) = delete;
+
+    auto operator=( Null_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Get the number of bytes written to the device access buffer.
+     *
+     * \return The number of bytes written to the device access buffer.
+     */
+    auto bytes() const noexcept
+    {
+        return m_bytes;
+    }
+
+    /**
+     * \copydoc picolibrary::Stream_Buffer::initialize()
+     */
+    virtual auto initialize() noexcept -> Result<Void, Error_Code> override final
+    {
+        return {};
+    }
+
+    /**
+     * \copydoc picolibrary::Stream_Buffer::put( char )
+     */
+    virtual auto put( char ) noexcept -> Result<Void, Error_Code> override final
+    {
+        ++m_bytes;
+
+        return {};
+    }
+
+    /**
+     * \copydoc picolibrary::Stream_Buffer::put( std::uint8_t )
+     */
+    virtual auto put( std::uint8_t ) noexcept -> Result<Void, Error_Code> override final
+    {
+        ++m_bytes;
+
+        return {};
+    }
+
+    /**
+     * \copydoc picolibrary::Stream_Buffer::put( std::int8_t )
+     */
+    virtual auto put( std::int8_t ) noexcept -> Result<Void, Error_Code> override final
+    {
+        ++m_bytes;
+
+        return {};
+    }
+
+    /**
+     * \copydoc picolibrary::Stream_Buffer::flush()
+     */
+    virtual auto flush() noexcept -> Result<Void, Error_Code> override final
+    {
+        return {};
+    }
+
+  private:
+    /**
+     * \brief The number of bytes written to the device access buffer.
+     */
+    std::int64_t m_bytes{};
+};
+
+/**
+ * \brief Benchmark output stream that counts and discards the data written to it.
+ */
+class Null_Output_Stream : public Output_Stream {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    Null_Output_Stream()
+    {
+        set_buffer( &m_buffer );
+    }
+
+    Null_Output_Stream( Null_Output_Stream && ) = delete;
+
+    Null_Output_Stream( Null_Output_Stream const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Null_Output_Stream() noexcept = default;
+
+    auto operator=( Null_Output_Stream && ) = delete;
+
+    auto operator=( Null_Output_Stream const & ) = delete;
+
+    /**
+     * \brief Get the number of bytes written to the stream.
+     *
+     * \return The number of bytes written to the stream.
+     */
+    auto bytes() const noexcept
+    {
+        return m_buffer.bytes();
+    }
+
+  private:
+    /**
+     * \brief The stream's device access buffer.
+     */
+    Null_Stream_Buffer m_buffer{};
+};
+
+/**
+ * \brief Measure picolibrary::Output_Stream::print() throughput.
+ *
+ * \tparam Values The types of the values to print.
+ *
+ * \param[in] state The benchmark state.
+ * \param[in] format The format string.
+ * \param[in] values The values to print.
+ */
+template<typename... Values>
+void print( ::benchmark::State & state, char const * format, Values... values )
+{
+    auto stream = Null_Output_Stream{};
+
+    for ( auto _ : state ) {
+        ::benchmark::DoNotOptimize( stream.print( format, values... ) );
+    } // for
+
+    state.SetBytesProcessed( stream.bytes() );
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE( print, string, "picolibrary benchmark" );
+BENCHMARK_CAPTURE( print, character, "{}", 'p' );
+BENCHMARK_CAPTURE( print, cString, "{}", "picolibrary benchmark" );
+BENCHMARK_CAPTURE( print, binaryUint8, "{}", Binary<std::uint8_t>{ 0xA5 } );
+BENCHMARK_CAPTURE( print, binaryUint32, "{}", Binary<std::uint32_t>{ 0xDEAD'BEEF } );
+BENCHMARK_CAPTURE( print, decimalInt32, "{}", Decimal<std::int32_t>{ -1'234'567'890 } );
+BENCHMARK_CAPTURE( print, decimalUint32, "{}", Decimal<std::uint32_t>{ 3'456'789'012 } );
+BENCHMARK_CAPTURE( print, hexadecimalUint8, "{}", Hexadecimal<std::uint8_t>{ 0xA5 } );
+BENCHMARK_CAPTURE(
+    print,
+    hexadecimalUint32,
+    "{}",
+    Hexadecimal<std::uint32_t>{ 0xDEAD'BEEF } );
+BENCHMARK_CAPTURE(
+    print,
+    mixed,
+    "register {} = {} ({})\n",
+    Hexadecimal<std::uint8_t>{ 0x09 },
+    Binary<std::uint8_t>{ 0xA5 },
+    Decimal<std::uint8_t>{ 0xA5 } );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,113 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Result benchmark program.
+ */
+
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+#include "picolibrary/error.h"
+#include "picolibrary/result.h"
+
+namespace {
+
+using ::picolibrary::Error_Code;
+using ::picolibrary::Generic_Error;
+using ::picolibrary::Result;
+
+/**
+ * \brief Produce a value, or an error, at the bottom of a call chain.
+ *
+ * \param[in] value The value to produce.
+ * \param[in] fail Produce an error instead of the value.
+ *
+ * \return value if fail is false.
+ * \return picolibrary::Generic_Error::BUS_ERROR if fail is true.
+ */
+[[gnu::noinline]] auto produce( std::uint32_t value, bool fail ) noexcept
+    -> Result<std::uint32_t, Error_Code>
+{
+    if ( fail ) {
+        return Generic_Error::BUS_ERROR;
+    } // if
+
+    return value;
+}
+
+/**
+ * \brief Propagate a value, or an error, up a call chain.
+ *
+ * \tparam DEPTH The number of calls between this call and the bottom of the call chain.
+ *
+ * \param[in] value The value to produce at the bottom of the call chain.
+ * \param[in] fail Produce an error instead of the value at the bottom of the call chain.
+ *
+ * \return The value produced at the bottom of the call chain, incremented once per
+ *         call, if the bottom of the call chain did not produce an error.
+ * \return The error produced at the bottom of the call chain if the bottom of the call
+ *         chain produced an error.
+ */
+template<int DEPTH>
+[[gnu::noinline]] auto propagate( std::uint32_t value, bool fail ) noexcept
+    -> Result<std::uint32_t, Error_Code>
+{
+    auto result = [ & ]() noexcept {
+        if constexpr ( DEPTH > 1 ) {
+            return propagate<DEPTH - 1>( value, fail );
+        } else {
+            return produce( value, fail );
+        } // else
+    }();
+    if ( result.is_error() ) {
+        return result.error();
+    } // if
+
+    return result.value() + 1;
+}
+
+} // namespace
+
+/**
+ * \brief Measure picolibrary::Result value and error propagation.
+ *
+ * \tparam DEPTH The depth of the call chain the value or error is propagated through.
+ *
+ * \param[in] state The benchmark state (range 0 is non-zero to propagate errors).
+ */
+template<int DEPTH>
+void propagateResult( ::benchmark::State & state )
+{
+    auto const fail  = state.range( 0 ) != 0;
+    auto       value = std::uint32_t{};
+
+    for ( auto _ : state ) {
+        ::benchmark::DoNotOptimize( value );
+
+        auto const result = propagate<DEPTH>( value, fail );
+
+        ::benchmark::DoNotOptimize( result );
+    } // for
+}
+
+BENCHMARK_TEMPLATE( propagateResult, 1 )->Arg( 0 )->Arg( 1 );
+BENCHMARK_TEMPLATE( propagateResult, 4 )->Arg( 0 )->Arg( 1 );
+BENCHMARK_TEMPLATE( propagateResult, 16 )->Arg( 0 )->Arg( 1 );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,133 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::SPI benchmark program.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "picolibrary/result.h"
+#include "picolibrary/spi.h"
+#include "picolibrary/testing/fake/spi.h"
+
+namespace {
+
+using ::picolibrary::and_then;
+using ::picolibrary::sequence;
+using ::picolibrary::SPI::make_device_selection_guard;
+using ::picolibrary::Testing::Fake::SPI::Fake_Controller;
+using ::picolibrary::Testing::Fake::SPI::Fake_Device_Selector;
+
+/**
+ * \brief Benchmarked device implementation.
+ */
+using Basic_Device = ::picolibrary::SPI::Device<Fake_Controller, Fake_Device_Selector>;
+
+/**
+ * \brief Benchmark device.
+ */
+class Device : public Basic_Device {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] controller The controller used to communicate with the device.
+     */
+    Device( Fake_Controller & controller ) noexcept :
+        Basic_Device{ controller, 0, Fake_Device_Selector{} }
+    {
+    }
+
+    /**
+     * \brief Configure the controller, select the device, and exchange a block of data
+     *        with the device (the typical SPI device driver transaction).
+     *
+     * \param[in] begin The beginning of the block of data to exchange.
+     * \param[in] end The end of the block of data to exchange.
+     *
+     * \return Nothing if the transaction succeeded.
+     * \return An error code if the transaction failed.
+     */
+    auto transaction( std::uint8_t * begin, std::uint8_t * end ) noexcept
+    {
+        return sequence(
+            [ this ]() noexcept { return configure(); },
+            [ this, begin, end ]() noexcept {
+                return and_then(
+                    make_device_selection_guard( device_selector() ),
+                    [ this, begin, end ]( auto guard ) noexcept {
+                        static_cast<void>( guard );
+
+                        return exchange( begin, end, begin, end );
+                    } );
+            } );
+    }
+
+    using Basic_Device::transmit;
+};
+
+} // namespace
+
+/**
+ * \brief Measure the typical SPI device driver transaction (configure, select, exchange,
+ *        deselect) throughput.
+ *
+ * \param[in] state The benchmark state.
+ */
+void transaction( ::benchmark::State & state )
+{
+    auto controller = Fake_Controller{};
+    auto device     = Device{ controller };
+    auto data       = std::vector<std::uint8_t>( state.range( 0 ), 0xA5 );
+
+    for ( auto _ : state ) {
+        ::benchmark::DoNotOptimize(
+            device.transaction( data.data(), data.data() + data.size() ) );
+    } // for
+
+    state.SetBytesProcessed( state.iterations() * state.range( 0 ) );
+}
+
+BENCHMARK( transaction )->RangeMultiplier( 4 )->Range( 1, 256 );
+
+/**
+ * \brief Measure picolibrary::SPI::Device::transmit( std::uint8_t const *, std::uint8_t
+ *        const * ) throughput.
+ *
+ * \param[in] state The benchmark state.
+ */
+void transmit( ::benchmark::State & state )
+{
+    auto controller = Fake_Controller{};
+    auto device     = Device{ controller };
+    auto data       = std::vector<std::uint8_t>( state.range( 0 ), 0xA5 );
+
+    for ( auto _ : state ) {
+        ::benchmark::DoNotOptimize(
+            device.transmit( data.data(), data.data() + data.size() ) );
+    } // for
+
+    state.SetBytesProcessed( state.iterations() * state.range( 0 ) );
+}
+
+BENCHMARK( transmit )->RangeMultiplier( 4 )->Range( 1, 256 );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,105 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Work_Stealing_Deque benchmark program.
+ */
+
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+#include "picolibrary/work_stealing_deque.h"
+
+namespace {
+
+/**
+ * \brief The deque shared by the benchmark threads.
+ */
+auto deque = ::picolibrary::Work_Stealing_Deque<std::uint32_t, 1024>{};
+
+} // namespace
+
+/**
+ * \brief Measure picolibrary::Work_Stealing_Deque owner push/pop throughput while the
+ *        other benchmark threads attempt to steal.
+ *
+ * \param[in] state The benchmark state.
+ */
+void pushPopSteal( ::benchmark::State & state )
+{
+    auto value = std::uint32_t{};
+    auto taken = std::int64_t{};
+
+    if ( state.thread_index() == 0 ) {
+        for ( auto _ : state ) {
+            if ( deque.push( value ) and deque.pop( value ) ) {
+                ++taken;
+            } // if
+        }     // for
+
+        while ( deque.pop( value ) ) {
+        } // while
+    } else {
+        for ( auto _ : state ) {
+            if ( deque.steal( value ) ) {
+                ++taken;
+            } // if
+        }     // for
+    }         // else
+
+    ::benchmark::DoNotOptimize( value );
+
+    state.SetItemsProcessed( taken );
+}
+
+BENCHMARK( pushPopSteal )->ThreadRange( 1, 32 )->UseRealTime();
+
+/**
+ * \brief Measure picolibrary::Work_Stealing_Deque steal throughput while the first
+ *        benchmark thread keeps the deque populated.
+ *
+ * \param[in] state The benchmark state.
+ */
+void steal( ::benchmark::State & state )
+{
+    auto value = std::uint32_t{};
+    auto taken = std::int64_t{};
+
+    if ( state.thread_index() == 0 ) {
+        for ( auto _ : state ) {
+            static_cast<void>( deque.push( value++ ) );
+        } // for
+
+        while ( deque.pop( value ) ) {
+        } // while
+    } else {
+        for ( auto _ : state ) {
+            if ( deque.steal( value ) ) {
+                ++taken;
+            } // if
+        }     // for
+    }         // else
+
+    ::benchmark::DoNotOptimize( value );
+
+    state.SetItemsProcessed( taken );
+}
+
+BENCHMARK( steal )->ThreadRange( 2, 32 )->UseRealTime();
+
+BENCHMARK_MAIN();
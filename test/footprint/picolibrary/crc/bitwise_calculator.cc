@@ -0,0 +1,46 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::CRC::Bitwise_Calculator footprint translation unit.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/crc.h"
+
+namespace picolibrary::Testing::Footprint::CRC {
+
+/**
+ * \brief Calculate the CRC-32 of a message.
+ *
+ * \param[in] parameters The calculation parameters.
+ * \param[in] begin The beginning of the message.
+ * \param[in] end The end of the message.
+ *
+ * \return The message's CRC-32.
+ */
+auto calculate(
+    ::picolibrary::CRC::Parameters<std::uint32_t> const & parameters,
+    std::uint8_t const *                                   begin,
+    std::uint8_t const *                                   end ) noexcept -> std::uint32_t
+{
+    return ::picolibrary::CRC::Bitwise_Calculator<std::uint32_t>{ parameters }.calculate( begin, end );
+}
+
+} // namespace picolibrary::Testing::Footprint::CRC
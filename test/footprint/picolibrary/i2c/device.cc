@@ -0,0 +1,110 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::I2C::Device footprint translation unit.
+ */
+
+#include <cstdint>
+
+#include "peripheral.h"
+#include "picolibrary/error.h"
+#include "picolibrary/i2c.h"
+#include "picolibrary/result.h"
+#include "picolibrary/void.h"
+
+namespace picolibrary::Testing::Footprint::I2C {
+
+/**
+ * \brief Footprint device.
+ */
+class Device : public ::picolibrary::I2C::Device<Bus_Multiplexer_Aligner, Controller, std::uint8_t> {
+  public:
+    using ::picolibrary::I2C::Device<Bus_Multiplexer_Aligner, Controller, std::uint8_t>::Device;
+
+    using ::picolibrary::I2C::Device<Bus_Multiplexer_Aligner, Controller, std::uint8_t>::read;
+
+    using ::picolibrary::I2C::Device<Bus_Multiplexer_Aligner, Controller, std::uint8_t>::write;
+};
+
+/**
+ * \brief Read a register.
+ *
+ * \param[in] device The device to read from.
+ * \param[in] register_address The address of the register to read.
+ *
+ * \return The register's contents if the read succeeded.
+ * \return An error code if the read failed.
+ */
+auto read( Device const & device, std::uint8_t register_address ) noexcept
+    -> Result<std::uint8_t, Error_Code>
+{
+    return device.read( register_address );
+}
+
+/**
+ * \brief Read a block of registers.
+ *
+ * \param[in] device The device to read from.
+ * \param[in] register_address The address of the block of registers to read.
+ * \param[out] begin The beginning of the data read from the block of registers.
+ * \param[out] end The end of the data read from the block of registers.
+ *
+ * \return Nothing if the read succeeded.
+ * \return An error code if the read failed.
+ */
+auto read( Device const & device, std::uint8_t register_address, std::uint8_t * begin, std::uint8_t * end ) noexcept
+    -> Result<Void, Error_Code>
+{
+    return device.read( register_address, begin, end );
+}
+
+/**
+ * \brief Write to a register.
+ *
+ * \param[in] device The device to write to.
+ * \param[in] register_address The address of the register to write to.
+ * \param[in] data The data to write to the register.
+ *
+ * \return Nothing if the write succeeded.
+ * \return An error code if the write failed.
+ */
+auto write( Device & device, std::uint8_t register_address, std::uint8_t data ) noexcept
+    -> Result<Void, Error_Code>
+{
+    return device.write( register_address, data );
+}
+
+/**
+ * \brief Write to a block of registers.
+ *
+ * \param[in] device The device to write to.
+ * \param[in] register_address The address of the block of registers to write to.
+ * \param[in] begin The beginning of the data to write to the block of registers.
+ * \param[in] end The end of the data to write to the block of registers.
+ *
+ * \return Nothing if the write succeeded.
+ * \return An error code if the write failed.
+ */
+auto write( Device & device, std::uint8_t register_address, std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    -> Result<Void, Error_Code>
+{
+    return device.write( register_address, begin, end );
+}
+
+} // namespace picolibrary::Testing::Footprint::I2C
@@ -0,0 +1,82 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::MCP23008::Driver footprint translation unit.
+ */
+
+#include <cstdint>
+
+#include "peripheral.h"
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/mcp23008.h"
+#include "picolibrary/result.h"
+#include "picolibrary/void.h"
+
+namespace picolibrary::Testing::Footprint::Microchip::MCP23008 {
+
+/**
+ * \brief Footprint driver.
+ */
+using Driver = ::picolibrary::Microchip::MCP23008::Driver<I2C::Bus_Multiplexer_Aligner, I2C::Controller>;
+
+/**
+ * \brief Configure a pin as a push-pull output.
+ *
+ * \param[in] driver The driver to use.
+ * \param[in] mask The mask identifying the pin.
+ *
+ * \return Nothing if pin configuration succeeded.
+ * \return An error code if pin configuration failed.
+ */
+auto configure_pin_as_push_pull_output( Driver & driver, std::uint8_t mask ) noexcept
+    -> Result<Void, Error_Code>
+{
+    return driver.configure_pin_as_push_pull_output( mask );
+}
+
+/**
+ * \brief Get the state of a pin.
+ *
+ * \param[in] driver The driver to use.
+ * \param[in] mask The mask identifying the pin.
+ *
+ * \return The state of the pin if getting the state of the pin succeeded.
+ * \return An error code if getting the state of the pin failed.
+ */
+auto state( Driver const & driver, std::uint8_t mask ) noexcept -> Result<std::uint8_t, Error_Code>
+{
+    return driver.state( mask );
+}
+
+/**
+ * \brief Toggle a push-pull output pin.
+ *
+ * \param[in] driver The driver to use.
+ * \param[in] mask The mask identifying the pin.
+ *
+ * \return Nothing if toggling the pin succeeded.
+ * \return An error code if toggling the pin failed.
+ */
+auto toggle_push_pull_output( Driver & driver, std::uint8_t mask ) noexcept
+    -> Result<Void, Error_Code>
+{
+    return driver.toggle_push_pull_output( mask );
+}
+
+} // namespace picolibrary::Testing::Footprint::Microchip::MCP23008
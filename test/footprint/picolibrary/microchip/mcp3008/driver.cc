@@ -0,0 +1,50 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::MCP3008::Driver footprint translation unit.
+ */
+
+#include "peripheral.h"
+#include "picolibrary/error.h"
+#include "picolibrary/microchip/mcp3008.h"
+#include "picolibrary/result.h"
+
+namespace picolibrary::Testing::Footprint::Microchip::MCP3008 {
+
+/**
+ * \brief Footprint driver.
+ */
+using Driver = ::picolibrary::Microchip::MCP3008::Driver<SPI::Controller, SPI::Device_Selector>;
+
+/**
+ * \brief Get a sample.
+ *
+ * \param[in] driver The driver to use.
+ * \param[in] input The input mode/channel(s) to sample.
+ *
+ * \return The sample if getting the sample succeeded.
+ * \return An error code if getting the sample failed.
+ */
+auto sample( Driver & driver, ::picolibrary::Microchip::MCP3008::Input input ) noexcept
+    -> Result<::picolibrary::Microchip::MCP3008::Sample, Error_Code>
+{
+    return driver.sample( input );
+}
+
+} // namespace picolibrary::Testing::Footprint::Microchip::MCP3008
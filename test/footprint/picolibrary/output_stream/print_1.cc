@@ -0,0 +1,44 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Output_Stream::print() (1 argument) footprint translation unit.
+ */
+
+#include "picolibrary/error.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+#include "picolibrary/void.h"
+
+namespace picolibrary::Testing::Footprint::Output_Stream {
+
+/**
+ * \brief Print 1 value.
+ *
+ * \param[in] stream The stream to print to.
+ * \param[in] string The string to print.
+ *
+ * \return Nothing if the print succeeded.
+ * \return An error code if the print failed.
+ */
+auto print( ::picolibrary::Output_Stream & stream, char const * string ) noexcept -> Result<Void, Error_Code>
+{
+    return stream.print( "{}\n", string );
+}
+
+} // namespace picolibrary::Testing::Footprint::Output_Stream
@@ -0,0 +1,56 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Output_Stream::print() (4 arguments) footprint translation unit.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/format.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+#include "picolibrary/void.h"
+
+namespace picolibrary::Testing::Footprint::Output_Stream {
+
+/**
+ * \brief Print 4 values.
+ *
+ * \param[in] stream The stream to print to.
+ * \param[in] string The string to print.
+ * \param[in] value The value to print (hexadecimal).
+ * \param[in] flags The flags to print (binary).
+ * \param[in] error The error to print.
+ *
+ * \return Nothing if the print succeeded.
+ * \return An error code if the print failed.
+ */
+auto print(
+    ::picolibrary::Output_Stream & stream,
+    char const *                   string,
+    std::uint32_t                  value,
+    std::uint8_t                   flags,
+    Error_Code const &             error ) noexcept -> Result<Void, Error_Code>
+{
+    return stream.print(
+        "{}: {} {} {}\n", string, Format::Hexadecimal{ value }, Format::Binary{ flags }, error );
+}
+
+} // namespace picolibrary::Testing::Footprint::Output_Stream
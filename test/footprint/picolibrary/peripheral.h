@@ -0,0 +1,127 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Testing::Footprint peripheral interface.
+ *
+ * The peripherals declared in this file are never defined. Footprint translation units
+ * are only compiled, never linked, so peripheral (HAL) code is excluded from the
+ * measurements and only the code generated by picolibrary is reported.
+ */
+
+#ifndef PICOLIBRARY_TEST_FOOTPRINT_PICOLIBRARY_PERIPHERAL_H
+#define PICOLIBRARY_TEST_FOOTPRINT_PICOLIBRARY_PERIPHERAL_H
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/i2c.h"
+#include "picolibrary/result.h"
+#include "picolibrary/spi.h"
+#include "picolibrary/void.h"
+
+/**
+ * \brief I2C footprint peripherals.
+ */
+namespace picolibrary::Testing::Footprint::I2C {
+
+/**
+ * \brief Footprint basic controller.
+ */
+class Basic_Controller {
+  public:
+    auto initialize() noexcept -> Result<Void, Error_Code>;
+
+    auto start() noexcept -> Result<Void, Error_Code>;
+
+    auto repeated_start() noexcept -> Result<Void, Error_Code>;
+
+    auto stop() noexcept -> Result<Void, Error_Code>;
+
+    auto address( ::picolibrary::I2C::Address address, ::picolibrary::I2C::Operation operation ) noexcept
+        -> Result<Void, Error_Code>;
+
+    auto read( ::picolibrary::I2C::Response response ) noexcept -> Result<std::uint8_t, Error_Code>;
+
+    auto write( std::uint8_t data ) noexcept -> Result<Void, Error_Code>;
+};
+
+/**
+ * \brief Footprint controller.
+ */
+using Controller = ::picolibrary::I2C::Controller<Basic_Controller>;
+
+/**
+ * \brief Footprint bus multiplexer aligner.
+ */
+struct Bus_Multiplexer_Aligner {
+    /**
+     * \brief Align the bus multiplexer(s).
+     *
+     * \return Nothing.
+     */
+    constexpr auto operator()() const noexcept -> Result<Void, Void>
+    {
+        return {};
+    }
+};
+
+} // namespace picolibrary::Testing::Footprint::I2C
+
+/**
+ * \brief SPI footprint peripherals.
+ */
+namespace picolibrary::Testing::Footprint::SPI {
+
+/**
+ * \brief Footprint basic controller.
+ */
+class Basic_Controller {
+  public:
+    /**
+     * \brief Clock and data exchange bit order configuration.
+     */
+    using Configuration = std::uint8_t;
+
+    auto initialize() noexcept -> Result<Void, Error_Code>;
+
+    auto configure( Configuration configuration ) noexcept -> Result<Void, Error_Code>;
+
+    auto exchange( std::uint8_t data ) noexcept -> Result<std::uint8_t, Error_Code>;
+};
+
+/**
+ * \brief Footprint controller.
+ */
+using Controller = ::picolibrary::SPI::Controller<Basic_Controller>;
+
+/**
+ * \brief Footprint device selector.
+ */
+class Device_Selector {
+  public:
+    auto initialize() noexcept -> Result<Void, Error_Code>;
+
+    auto select() noexcept -> Result<Void, Error_Code>;
+
+    auto deselect() noexcept -> Result<Void, Error_Code>;
+};
+
+} // namespace picolibrary::Testing::Footprint::SPI
+
+#endif // PICOLIBRARY_TEST_FOOTPRINT_PICOLIBRARY_PERIPHERAL_H
@@ -0,0 +1,85 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Result footprint translation unit.
+ */
+
+#include <cstdint>
+
+#include "picolibrary/error.h"
+#include "picolibrary/result.h"
+
+namespace picolibrary::Testing::Footprint::Result {
+
+/**
+ * \brief Produce a value, or an error, at the bottom of a call chain.
+ *
+ * \param[in] value The value to produce.
+ *
+ * \return A value if producing the value succeeded.
+ * \return An error code if producing the value failed.
+ */
+auto produce( std::uint32_t value ) noexcept -> ::picolibrary::Result<std::uint32_t, Error_Code>;
+
+/**
+ * \brief Propagate a value, or an error, up a call chain.
+ *
+ * \tparam DEPTH The number of calls between this call and the bottom of the call chain.
+ *
+ * \param[in] value The value to produce at the bottom of the call chain.
+ *
+ * \return The value produced at the bottom of the call chain, incremented once per
+ *         call, if the bottom of the call chain did not produce an error.
+ * \return The error produced at the bottom of the call chain if the bottom of the call
+ *         chain produced an error.
+ */
+template<int DEPTH>
+[[gnu::noinline]] auto propagate( std::uint32_t value ) noexcept
+    -> ::picolibrary::Result<std::uint32_t, Error_Code>
+{
+    auto result = [ & ]() noexcept {
+        if constexpr ( DEPTH > 1 ) {
+            return propagate<DEPTH - 1>( value );
+        } else {
+            return produce( value );
+        } // else
+    }();
+    if ( result.is_error() ) {
+        return result.error();
+    } // if
+
+    return result.value() + 1;
+}
+
+/**
+ * \brief Propagate a value, or an error, up a call chain that is 4 calls deep.
+ *
+ * \param[in] value The value to produce at the bottom of the call chain.
+ *
+ * \return The value produced at the bottom of the call chain, incremented once per
+ *         call, if the bottom of the call chain did not produce an error.
+ * \return The error produced at the bottom of the call chain if the bottom of the call
+ *         chain produced an error.
+ */
+auto propagate( std::uint32_t value ) noexcept -> ::picolibrary::Result<std::uint32_t, Error_Code>
+{
+    return propagate<4>( value );
+}
+
+} // namespace picolibrary::Testing::Footprint::Result
@@ -0,0 +1,87 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::SPI::Device footprint translation unit.
+ */
+
+#include <cstdint>
+
+#include "peripheral.h"
+#include "picolibrary/error.h"
+#include "picolibrary/result.h"
+#include "picolibrary/spi.h"
+#include "picolibrary/void.h"
+
+namespace picolibrary::Testing::Footprint::SPI {
+
+/**
+ * \brief Footprint device.
+ */
+class Device : public ::picolibrary::SPI::Device<Controller, Device_Selector> {
+  public:
+    using ::picolibrary::SPI::Device<Controller, Device_Selector>::Device;
+
+    /**
+     * \brief Perform a typical transaction (configure the controller, select the device,
+     *        and exchange a block of data with the device).
+     *
+     * \param[in] tx_begin The beginning of the block of data to transmit.
+     * \param[in] tx_end The end of the block of data to transmit.
+     * \param[out] rx_begin The beginning of the block of received data.
+     * \param[out] rx_end The end of the block of received data.
+     *
+     * \return Nothing if the transaction succeeded.
+     * \return An error code if the transaction failed.
+     */
+    auto transaction( std::uint8_t const * tx_begin, std::uint8_t const * tx_end, std::uint8_t * rx_begin, std::uint8_t * rx_end ) noexcept
+        -> Result<Void, Error_Code>
+    {
+        return sequence(
+            [ this ]() noexcept { return this->configure(); },
+            [ this, tx_begin, tx_end, rx_begin, rx_end ]() noexcept {
+                return and_then(
+                    ::picolibrary::SPI::make_device_selection_guard( this->device_selector() ),
+                    [ this, tx_begin, tx_end, rx_begin, rx_end ]( auto guard ) noexcept {
+                        static_cast<void>( guard );
+
+                        return this->exchange( tx_begin, tx_end, rx_begin, rx_end );
+                    } );
+            } );
+    }
+};
+
+/**
+ * \brief Perform a typical transaction.
+ *
+ * \param[in] device The device to perform the transaction with.
+ * \param[in] tx_begin The beginning of the block of data to transmit.
+ * \param[in] tx_end The end of the block of data to transmit.
+ * \param[out] rx_begin The beginning of the block of received data.
+ * \param[out] rx_end The end of the block of received data.
+ *
+ * \return Nothing if the transaction succeeded.
+ * \return An error code if the transaction failed.
+ */
+auto transaction( Device & device, std::uint8_t const * tx_begin, std::uint8_t const * tx_end, std::uint8_t * rx_begin, std::uint8_t * rx_end ) noexcept
+    -> Result<Void, Error_Code>
+{
+    return device.transaction( tx_begin, tx_end, rx_begin, rx_end );
+}
+
+} // namespace picolibrary::Testing::Footprint::SPI
@@ -0,0 +1,144 @@
+# picolibrary
+#
+# Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+# contributors
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+# file except in compliance with the License. You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software distributed under
+# the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied. See the License for the specific language governing
+# permissions and limitations under the License.
+
+
+# File: test/footprint/report.cmake
+# Description: picolibrary footprint report CMake script.
+#
+# Generates a code size and stack usage report from a set of footprint object files and
+# their GCC stack usage (-fstack-usage) files, and optionally checks the report against
+# a baseline report.
+#
+# Required variables:
+#     OBJECTS: The footprint object files.
+#     OBJECT_DIRECTORY: The directory the footprint object files are placed in (used to
+#         generate report entry names).
+#     SIZE_TOOL: The size tool (e.g. size, avr-size, arm-none-eabi-size) to use to
+#         measure section sizes.
+#     REPORT: The file to write the report to.
+#
+# Optional variables:
+#     BASELINE: The baseline report to check the report against.
+#     THRESHOLD: The maximum allowable increase (percent) of any report entry metric
+#         relative to the baseline report (defaults to 0).
+#
+# The report is a CSV file with the following columns:
+#     unit: The name of the footprint translation unit.
+#     text: The total size (bytes) of the translation unit's .text sections.
+#     rodata: The total size (bytes) of the translation unit's .rodata sections.
+#     stack: The largest stack frame (bytes) of any of the translation unit's functions.
+#         Frames are not summed along call chains, and dynamically sized frames are
+#         reported using their static portion.
+
+cmake_minimum_required( VERSION 3.12.4 )
+
+if( NOT SIZE_TOOL )
+    message( FATAL_ERROR "footprint report: no size tool specified" )
+endif( NOT SIZE_TOOL )
+
+if( NOT THRESHOLD )
+    set( THRESHOLD 0 )
+endif( NOT THRESHOLD )
+
+# measure each footprint translation unit
+set( report "unit,text,rodata,stack\n" )
+list( SORT OBJECTS )
+foreach( object ${OBJECTS} )
+    file( RELATIVE_PATH unit "${OBJECT_DIRECTORY}" "${object}" )
+    string( REGEX REPLACE "\\.[^./]+\\.(o|obj)$" "" unit "${unit}" )
+
+    execute_process(
+        COMMAND "${SIZE_TOOL}" -A "${object}"
+        OUTPUT_VARIABLE sections
+        RESULT_VARIABLE status
+    )
+    if( NOT status EQUAL 0 )
+        message( FATAL_ERROR "footprint report: ${SIZE_TOOL} failed for ${object}" )
+    endif( NOT status EQUAL 0 )
+
+    set( text 0 )
+    set( rodata 0 )
+    string( REPLACE "\n" ";" sections "${sections}" )
+    foreach( section ${sections} )
+        if( section MATCHES "^\\.text[^ ]* +([0-9]+)" )
+            math( EXPR text "${text} + ${CMAKE_MATCH_1}" )
+        elseif( section MATCHES "^\\.rodata[^ ]* +([0-9]+)" )
+            math( EXPR rodata "${rodata} + ${CMAKE_MATCH_1}" )
+        endif( section MATCHES "^\\.text[^ ]* +([0-9]+)" )
+    endforeach( section ${sections} )
+
+    string( REGEX REPLACE "\\.(o|obj)$" ".su" stack_usage_file "${object}" )
+    if( NOT EXISTS "${stack_usage_file}" )
+        message( FATAL_ERROR "footprint report: ${stack_usage_file} not found" )
+    endif( NOT EXISTS "${stack_usage_file}" )
+
+    set( stack 0 )
+    file( STRINGS "${stack_usage_file}" frames )
+    foreach( frame ${frames} )
+        if( frame MATCHES "\t([0-9]+)\t[a-z,]+$" AND CMAKE_MATCH_1 GREATER stack )
+            set( stack "${CMAKE_MATCH_1}" )
+        endif( frame MATCHES "\t([0-9]+)\t[a-z,]+$" AND CMAKE_MATCH_1 GREATER stack )
+    endforeach( frame ${frames} )
+
+    string( APPEND report "${unit},${text},${rodata},${stack}\n" )
+    message( STATUS "${unit}: text ${text} B, rodata ${rodata} B, stack ${stack} B" )
+endforeach( object ${OBJECTS} )
+
+file( WRITE "${REPORT}" "${report}" )
+message( STATUS "footprint report written to ${REPORT}" )
+
+# check the report against the baseline report
+if( BASELINE )
+    if( NOT EXISTS "${BASELINE}" )
+        message( FATAL_ERROR "footprint report: baseline ${BASELINE} not found" )
+    endif( NOT EXISTS "${BASELINE}" )
+
+    file( STRINGS "${BASELINE}" baseline_entries )
+    file( STRINGS "${REPORT}" report_entries )
+
+    set( metrics text rodata stack )
+    set( regressions 0 )
+    foreach( entry ${report_entries} )
+        string( REPLACE "," ";" entry "${entry}" )
+        list( GET entry 0 unit )
+        if( unit STREQUAL "unit" )
+            continue()
+        endif( unit STREQUAL "unit" )
+
+        foreach( baseline_entry ${baseline_entries} )
+            string( REPLACE "," ";" baseline_entry "${baseline_entry}" )
+            list( GET baseline_entry 0 baseline_unit )
+            if( NOT baseline_unit STREQUAL unit )
+                continue()
+            endif( NOT baseline_unit STREQUAL unit )
+
+            foreach( column 1 2 3 )
+                list( GET entry ${column} value )
+                list( GET baseline_entry ${column} baseline_value )
+                math( EXPR limit "${baseline_value} + ${baseline_value} * ${THRESHOLD} / 100" )
+                if( value GREATER limit )
+                    math( EXPR metric_index "${column} - 1" )
+                    list( GET metrics ${metric_index} metric )
+                    message( SEND_ERROR "footprint regression: ${unit} ${metric} ${baseline_value} B -> ${value} B (limit ${limit} B)" )
+                    math( EXPR regressions "${regressions} + 1" )
+                endif( value GREATER limit )
+            endforeach( column 1 2 3 )
+        endforeach( baseline_entry ${baseline_entries} )
+    endforeach( entry ${report_entries} )
+
+    if( regressions GREATER 0 )
+        message( FATAL_ERROR "footprint report: ${regressions} regression(s) beyond ${THRESHOLD}% of ${BASELINE}" )
+    endif( regressions GREATER 0 )
+endif( BASELINE )
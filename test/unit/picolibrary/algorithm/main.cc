@@ -20,6 +20,7 @@
  * \brief picolibrary::Algorithm unit test program.
  */
 
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 #include <vector>
@@ -137,6 +138,107 @@ TEST( forEach, worksProperly )
     }
 }
 
+/**
+ * \brief Verify picolibrary::for_each() works properly with an infallible functor.
+ */
+TEST( forEach, infallibleFunctorWorksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto functor = MockFunction<Result<Void, Void>( std::uint_fast8_t const & )>{};
+
+    auto const values = random_container<std::vector<std::uint_fast8_t>>();
+
+    for ( auto const & value : values ) {
+        EXPECT_CALL( functor, Call( Ref( value ) ) ).WillOnce( Return( Result<Void, Void>{} ) );
+    } // for
+
+    auto const result = ::picolibrary::for_each<Discard_Functor>(
+        values.begin(), values.end(), functor.AsStdFunction() );
+
+    static_assert( std::is_same_v<decltype( result ), Result<Void, Void> const> );
+}
+
+/**
+ * \brief Verify picolibrary::for_each_n() properly handles a functor error.
+ */
+TEST( forEachN, functorError )
+{
+    {
+        auto functor = MockFunction<Result<Void, Error_Code>( std::uint_fast8_t const & )>{};
+
+        auto const error = random<Mock_Error>();
+
+        EXPECT_CALL( functor, Call( _ ) ).WillOnce( Return( error ) );
+
+        auto const values = random_container<std::vector<std::uint_fast8_t>>(
+            random<std::uint_fast8_t>( 1 ) );
+        auto const result = ::picolibrary::for_each_n<Return_Functor>(
+            values.begin(), values.size(), functor.AsStdFunction() );
+
+        EXPECT_TRUE( result.is_error() );
+        EXPECT_EQ( result.error(), error );
+    }
+
+    {
+        auto functor = MockFunction<Result<Void, Error_Code>( std::uint_fast8_t const & )>{};
+
+        auto const error = random<Mock_Error>();
+
+        EXPECT_CALL( functor, Call( _ ) ).WillOnce( Return( error ) );
+
+        auto const values = random_container<std::vector<std::uint_fast8_t>>(
+            random<std::uint_fast8_t>( 1 ) );
+        auto const result = ::picolibrary::for_each_n<Discard_Functor>(
+            values.data(), values.size(), functor.AsStdFunction() );
+
+        EXPECT_TRUE( result.is_error() );
+        EXPECT_EQ( result.error(), error );
+    }
+}
+
+/**
+ * \brief Verify picolibrary::for_each_n() works properly.
+ */
+TEST( forEachN, worksProperly )
+{
+    {
+        auto const in_sequence = InSequence{};
+
+        auto functor = MockFunction<Result<Void, Error_Code>( std::uint_fast8_t const & )>{};
+
+        auto const values = random_container<std::vector<std::uint_fast8_t>>();
+        auto const n      = random<std::size_t>( 0, values.size() );
+
+        for ( auto i = std::size_t{}; i < n; ++i ) {
+            EXPECT_CALL( functor, Call( Ref( values[ i ] ) ) ).WillOnce( Return( Result<Void, Error_Code>{} ) );
+        } // for
+
+        auto const result = ::picolibrary::for_each_n<Return_Functor>(
+            values.begin(), n, functor.AsStdFunction() );
+
+        EXPECT_TRUE( result.is_value() );
+    }
+
+    {
+        auto const in_sequence = InSequence{};
+
+        auto functor = MockFunction<Result<Void, Error_Code>( std::uint_fast8_t const & )>{};
+
+        auto const values = random_container<std::vector<std::uint_fast8_t>>();
+        auto const n      = random<std::size_t>( 0, values.size() );
+
+        for ( auto i = std::size_t{}; i < n; ++i ) {
+            EXPECT_CALL( functor, Call( Ref( values[ i ] ) ) ).WillOnce( Return( Result<Void, Error_Code>{} ) );
+        } // for
+
+        auto const result = ::picolibrary::for_each_n<Discard_Functor>(
+            values.data(), n, functor.AsStdFunction() );
+
+        EXPECT_FALSE( result.is_error() );
+    }
+}
+
 /**
  * \brief Verify picolibrary::generate() properly handles a functor error.
  */
@@ -179,6 +281,144 @@ TEST( generate, worksProperly )
     EXPECT_EQ( output, values );
 }
 
+/**
+ * \brief Verify picolibrary::generate() works properly with an infallible functor.
+ */
+TEST( generate, infallibleFunctorWorksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto functor = MockFunction<Result<std::uint_fast8_t, Void>()>{};
+
+    auto const values = random_container<std::vector<std::uint_fast8_t>>();
+
+    for ( auto const value : values ) {
+        EXPECT_CALL( functor, Call() ).WillOnce( Return( value ) );
+    } // for
+
+    auto output = std::vector<std::uint_fast8_t>( values.size() );
+
+    EXPECT_FALSE(
+        ::picolibrary::generate( output.begin(), output.end(), functor.AsStdFunction() ).is_error() );
+
+    EXPECT_EQ( output, values );
+}
+
+/**
+ * \brief Verify picolibrary::transform() properly handles a functor error.
+ */
+TEST( transform, functorError )
+{
+    auto functor = MockFunction<Result<std::uint16_t, Error_Code>( std::uint8_t )>{};
+
+    auto const error = random<Mock_Error>();
+
+    EXPECT_CALL( functor, Call( _ ) ).WillOnce( Return( error ) );
+
+    auto const values = random_container<std::vector<std::uint8_t>>( random<std::uint_fast8_t>( 1 ) );
+    auto       output = std::vector<std::uint16_t>( values.size() );
+    auto const result = ::picolibrary::transform(
+        values.begin(), values.end(), output.begin(), functor.AsStdFunction() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify picolibrary::transform() works properly.
+ */
+TEST( transform, worksProperly )
+{
+    {
+        auto const in_sequence = InSequence{};
+
+        auto functor = MockFunction<Result<std::uint16_t, Error_Code>( std::uint8_t )>{};
+
+        auto const values   = random_container<std::vector<std::uint8_t>>();
+        auto const expected = random_container<std::vector<std::uint16_t>>( values.size() );
+
+        for ( auto i = std::size_t{}; i < values.size(); ++i ) {
+            EXPECT_CALL( functor, Call( values[ i ] ) ).WillOnce( Return( expected[ i ] ) );
+        } // for
+
+        auto output = std::vector<std::uint16_t>( values.size() );
+
+        EXPECT_FALSE( ::picolibrary::transform(
+                          values.begin(), values.end(), output.begin(), functor.AsStdFunction() )
+                          .is_error() );
+
+        EXPECT_EQ( output, expected );
+    }
+
+    {
+        auto const values = random_container<std::vector<std::uint8_t>>();
+        auto       output = std::vector<std::uint16_t>( values.size() );
+
+        auto const result = ::picolibrary::transform(
+            values.data(), values.data() + values.size(), output.data(), []( auto value ) noexcept {
+                return Result<std::uint16_t, Void>{ static_cast<std::uint16_t>( value * 3 ) };
+            } );
+
+        static_assert( std::is_same_v<decltype( result ), Result<Void, Void> const> );
+
+        for ( auto i = std::size_t{}; i < values.size(); ++i ) {
+            EXPECT_EQ( output[ i ], values[ i ] * 3 );
+        } // for
+    }
+}
+
+/**
+ * \brief Verify picolibrary::fill() works properly.
+ */
+TEST( fill, worksProperly )
+{
+    {
+        auto       output = std::vector<std::uint8_t>( random<std::uint_fast8_t>() );
+        auto const value  = random<std::uint8_t>();
+
+        ::picolibrary::fill( output.data(), output.data() + output.size(), value );
+
+        EXPECT_EQ( output, std::vector<std::uint8_t>( output.size(), value ) );
+    }
+
+    {
+        auto       output = std::vector<std::uint32_t>( random<std::uint_fast8_t>() );
+        auto const value  = random<std::uint32_t>();
+
+        ::picolibrary::fill( output.begin(), output.end(), value );
+
+        EXPECT_EQ( output, std::vector<std::uint32_t>( output.size(), value ) );
+    }
+}
+
+/**
+ * \brief Verify picolibrary::copy() works properly.
+ */
+TEST( copy, worksProperly )
+{
+    {
+        auto const values = random_container<std::vector<std::uint32_t>>();
+        auto       output = std::vector<std::uint32_t>( values.size() );
+
+        EXPECT_EQ(
+            ::picolibrary::copy( values.data(), values.data() + values.size(), output.data() ),
+            output.data() + output.size() );
+
+        EXPECT_EQ( output, values );
+    }
+
+    {
+        auto const values = random_container<std::vector<std::uint8_t>>();
+        auto       output = std::vector<std::uint16_t>( values.size() );
+
+        EXPECT_EQ( ::picolibrary::copy( values.begin(), values.end(), output.begin() ), output.end() );
+
+        for ( auto i = std::size_t{}; i < values.size(); ++i ) {
+            EXPECT_EQ( output[ i ], values[ i ] );
+        } // for
+    }
+}
+
 /**
  * \brief Execute the picolibrary::Algorithm unit tests.
  *
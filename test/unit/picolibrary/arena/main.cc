@@ -0,0 +1,171 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Arena unit test program.
+ */
+
+#include <cstdint>
+#include <initializer_list>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/arena.h"
+#include "picolibrary/testing/unit/random.h"
+
+namespace {
+
+using ::picolibrary::Arena;
+using ::picolibrary::Testing::Unit::random;
+
+/**
+ * \brief Verify picolibrary::Arena can be constant initialized.
+ */
+[[maybe_unused]] constexpr auto CONSTANT_INITIALIZED_ARENA = Arena<64>{};
+
+/**
+ * \brief A type whose std::initializer_list constructor would be selected if it were
+ *        list-initialized.
+ */
+struct Initializer_List_Constructible {
+    /**
+     * \brief The std::initializer_list constructor was used.
+     */
+    bool list_initialized{};
+
+    /**
+     * \brief Constructor.
+     */
+    Initializer_List_Constructible( std::initializer_list<int> ) noexcept :
+        list_initialized{ true }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     */
+    Initializer_List_Constructible( int, int ) noexcept
+    {
+    }
+};
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Arena::allocate() works properly.
+ */
+TEST( allocate, worksProperly )
+{
+    auto arena = Arena<64>{};
+
+    EXPECT_EQ( arena.capacity(), 64 );
+    EXPECT_EQ( arena.available(), 64 );
+
+    auto const a = arena.allocate( 1, 1 );
+
+    ASSERT_NE( a, nullptr );
+    EXPECT_EQ( arena.used(), 1 );
+
+    auto const b = arena.allocate( 8, 8 );
+
+    ASSERT_NE( b, nullptr );
+    EXPECT_EQ( reinterpret_cast<std::uintptr_t>( b ) % 8, 0 );
+    EXPECT_EQ( arena.used(), 16 );
+
+    EXPECT_EQ( arena.allocate( 49, 1 ), nullptr );
+    EXPECT_EQ( arena.used(), 16 );
+
+    EXPECT_NE( arena.allocate( 48, 1 ), nullptr );
+    EXPECT_EQ( arena.available(), 0 );
+    EXPECT_EQ( arena.allocate( 1, 1 ), nullptr );
+
+    arena.reset();
+
+    EXPECT_EQ( arena.available(), 64 );
+    EXPECT_EQ( arena.allocate( 1, 1 ), a );
+}
+
+/**
+ * \brief Verify picolibrary::Arena::create() works properly.
+ */
+TEST( create, worksProperly )
+{
+    auto arena = Arena<16>{};
+
+    auto const value = random<std::uint32_t>();
+
+    auto const object = arena.create<std::uint32_t>( value );
+
+    ASSERT_NE( object, nullptr );
+    EXPECT_EQ( *object, value );
+    EXPECT_EQ( reinterpret_cast<std::uintptr_t>( object ) % alignof( std::uint32_t ), 0 );
+
+    EXPECT_NE( ( arena.create<std::uint64_t>() ), nullptr );
+    EXPECT_EQ( ( arena.create<std::uint64_t>() ), nullptr );
+}
+
+/**
+ * \brief Verify picolibrary::Arena::create() does not select a type's
+ *        std::initializer_list constructor.
+ */
+TEST( create, initializerListConstructible )
+{
+    auto arena = Arena<16>{};
+
+    auto const object = arena.create<Initializer_List_Constructible>( 1, 2 );
+
+    ASSERT_NE( object, nullptr );
+    EXPECT_FALSE( object->list_initialized );
+}
+
+/**
+ * \brief Verify picolibrary::Arena::position() and picolibrary::Arena::rewind() work
+ *        properly.
+ */
+TEST( rewind, worksProperly )
+{
+    auto arena = Arena<32>{};
+
+    static_cast<void>( arena.allocate( 4, 4 ) );
+
+    auto const position = arena.position();
+
+    auto const scratch = arena.allocate( 16, 4 );
+
+    ASSERT_NE( scratch, nullptr );
+
+    arena.rewind( position );
+
+    EXPECT_EQ( arena.used(), 4 );
+    EXPECT_EQ( arena.allocate( 16, 4 ), scratch );
+}
+
+/**
+ * \brief Execute the picolibrary::Arena unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
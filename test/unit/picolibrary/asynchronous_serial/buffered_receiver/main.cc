@@ -0,0 +1,249 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Asynchronous_Serial::Buffered_Receiver unit test program.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/asynchronous_serial.h"
+#include "picolibrary/error.h"
+#include "picolibrary/testing/unit/random.h"
+
+namespace {
+
+using ::picolibrary::Generic_Error;
+using ::picolibrary::Testing::Unit::random;
+using ::picolibrary::Testing::Unit::random_container;
+
+/**
+ * \brief Fake clock.
+ */
+struct Fake_Clock {
+    /**
+     * \brief The current time.
+     */
+    std::uint32_t * now;
+
+    /**
+     * \brief Get the current time.
+     *
+     * \return The current time.
+     */
+    auto operator()() const noexcept
+    {
+        return *now;
+    }
+};
+
+/**
+ * \brief Fake idle functor that advances the fake clock.
+ */
+struct Fake_Idle {
+    /**
+     * \brief The current time.
+     */
+    std::uint32_t * now;
+
+    /**
+     * \brief Advance the fake clock.
+     */
+    void operator()() const noexcept
+    {
+        ++*now;
+    }
+};
+
+constexpr auto CAPACITY = std::size_t{ 64 };
+
+using Buffered_Receiver =
+    ::picolibrary::Asynchronous_Serial::Buffered_Receiver<CAPACITY, Fake_Clock, Fake_Idle>;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Buffered_Receiver::fill() properly
+ *        handles a buffer overrun.
+ */
+TEST( fill, overrun )
+{
+    auto now      = random<std::uint32_t>();
+    auto receiver = Buffered_Receiver{ Fake_Clock{ &now }, 0, Fake_Idle{ &now } };
+
+    auto const values = random_container<std::vector<std::uint8_t>>(
+        random<std::size_t>( CAPACITY + 1, CAPACITY * 2 ) );
+
+    EXPECT_EQ( receiver.fill( &*values.begin(), &*values.end() ), CAPACITY );
+    EXPECT_EQ( receiver.overruns(), values.size() - CAPACITY );
+    EXPECT_EQ( receiver.available(), CAPACITY );
+
+    EXPECT_FALSE( receiver.fill( random<std::uint8_t>() ) );
+    EXPECT_EQ( receiver.overruns(), values.size() - CAPACITY + 1 );
+
+    auto received = std::vector<std::uint8_t>( CAPACITY );
+
+    EXPECT_FALSE( receiver.receive( &*received.begin(), &*received.end() ).is_error() );
+    EXPECT_EQ( received, std::vector<std::uint8_t>( values.begin(), values.begin() + CAPACITY ) );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Buffered_Receiver::receive() properly
+ *        handles a timeout.
+ */
+TEST( receive, timeout )
+{
+    auto const start   = random<std::uint32_t>();
+    auto const timeout = random<std::uint32_t>( 0, 1000 );
+
+    auto now      = start;
+    auto receiver = Buffered_Receiver{ Fake_Clock{ &now }, timeout, Fake_Idle{ &now } };
+
+    {
+        auto const result = receiver.receive();
+
+        EXPECT_TRUE( result.is_error() );
+        EXPECT_EQ( result.error(), Generic_Error::OPERATION_TIMEOUT );
+        EXPECT_EQ( static_cast<std::uint32_t>( now - start ), timeout );
+    }
+
+    now = start;
+
+    auto const values = random_container<std::vector<std::uint8_t>>(
+        random<std::size_t>( 1, CAPACITY - 1 ) );
+
+    EXPECT_EQ( receiver.fill( &*values.begin(), &*values.end() ), values.size() );
+
+    auto received = std::vector<std::uint8_t>( values.size() + 1 );
+
+    auto const result = receiver.receive( &*received.begin(), &*received.end() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::OPERATION_TIMEOUT );
+    EXPECT_EQ( static_cast<std::uint32_t>( now - start ), timeout );
+    EXPECT_EQ( std::vector<std::uint8_t>( received.begin(), received.end() - 1 ), values );
+    EXPECT_EQ( receiver.available(), 0 );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Buffered_Receiver::receive() works
+ *        properly.
+ */
+TEST( receive, worksProperly )
+{
+    auto now      = random<std::uint32_t>();
+    auto receiver = Buffered_Receiver{ Fake_Clock{ &now }, 0, Fake_Idle{ &now } };
+
+    auto const value = random<std::uint8_t>();
+
+    EXPECT_TRUE( receiver.fill( value ) );
+
+    auto const result = receiver.receive();
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), value );
+
+    auto const values = random_container<std::vector<std::uint8_t>>(
+        random<std::size_t>( 1, CAPACITY ) );
+
+    EXPECT_EQ( receiver.fill( &*values.begin(), &*values.end() ), values.size() );
+    EXPECT_EQ( receiver.available(), values.size() );
+
+    auto received = std::vector<std::uint8_t>( values.size() );
+
+    EXPECT_FALSE( receiver.receive( &*received.begin(), &*received.end() ).is_error() );
+    EXPECT_EQ( received, values );
+    EXPECT_EQ( receiver.overruns(), 0 );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Buffered_Receiver::receive_available()
+ *        works properly.
+ */
+TEST( receiveAvailable, worksProperly )
+{
+    auto const start = random<std::uint32_t>();
+
+    auto now      = start;
+    auto receiver = Buffered_Receiver{ Fake_Clock{ &now },
+                                       random<std::uint32_t>(),
+                                       Fake_Idle{ &now } };
+
+    auto const values = random_container<std::vector<std::uint8_t>>(
+        random<std::size_t>( 1, CAPACITY - 1 ) );
+
+    EXPECT_EQ( receiver.fill( &*values.begin(), &*values.end() ), values.size() );
+
+    auto received = std::vector<std::uint8_t>( CAPACITY );
+
+    EXPECT_EQ( receiver.receive_available( &*received.begin(), &*received.end() ), values.size() );
+    EXPECT_EQ( std::vector<std::uint8_t>( received.begin(), received.begin() + values.size() ), values );
+    EXPECT_EQ( now, start );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Buffered_Receiver works properly when
+ *        filled by a reader thread.
+ */
+TEST( readerThread, worksProperly )
+{
+    auto now      = std::uint32_t{};
+    auto receiver = Buffered_Receiver{ Fake_Clock{ &now },
+                                       std::numeric_limits<std::uint32_t>::max(),
+                                       Fake_Idle{ &now } };
+
+    auto const values = random_container<std::vector<std::uint8_t>>( CAPACITY * 64 );
+
+    auto reader = std::thread{ [ &receiver, &values ]() {
+        for ( auto begin = &*values.begin(); begin != &*values.end(); ) {
+            begin += receiver.fill( begin, std::min( begin + 7, &*values.end() ) );
+
+            std::this_thread::yield();
+        } // for
+    } };
+
+    auto received = std::vector<std::uint8_t>( values.size() );
+
+    EXPECT_FALSE( receiver.receive( &*received.begin(), &*received.end() ).is_error() );
+
+    reader.join();
+
+    EXPECT_EQ( received, values );
+}
+
+/**
+ * \brief Execute the picolibrary::Asynchronous_Serial::Buffered_Receiver unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
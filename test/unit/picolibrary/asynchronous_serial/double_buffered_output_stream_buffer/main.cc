@@ -0,0 +1,324 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Asynchronous_Serial::Double_Buffered_Output_Stream_Buffer unit
+ *        test program.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/asynchronous_serial/stream.h"
+#include "picolibrary/error.h"
+#include "picolibrary/result.h"
+#include "picolibrary/testing/unit/asynchronous_serial.h"
+#include "picolibrary/testing/unit/error.h"
+#include "picolibrary/testing/unit/random.h"
+#include "picolibrary/void.h"
+
+namespace {
+
+using ::picolibrary::Error_Code;
+using ::picolibrary::Result;
+using ::picolibrary::Void;
+using ::picolibrary::Testing::Unit::Mock_Error;
+using ::picolibrary::Testing::Unit::random;
+using ::picolibrary::Testing::Unit::random_container;
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::Return;
+
+using Mock_Non_Blocking_Transmitter =
+    ::picolibrary::Testing::Unit::Asynchronous_Serial::Mock_Non_Blocking_Transmitter<std::uint8_t>;
+
+/**
+ * \brief Idle functor that counts the number of times it has been called.
+ */
+struct Counting_Idle {
+    /**
+     * \brief The number of times the idle functor has been called.
+     */
+    std::size_t * calls;
+
+    /**
+     * \brief Count a call.
+     */
+    void operator()() const noexcept
+    {
+        ++*calls;
+    }
+};
+
+constexpr auto N = std::size_t{ 16 };
+
+using Double_Buffered_Output_Stream_Buffer = ::picolibrary::Asynchronous_Serial::
+    Double_Buffered_Output_Stream_Buffer<Mock_Non_Blocking_Transmitter::Handle, N, Counting_Idle>;
+
+using Double_Buffered_Output_Stream = ::picolibrary::Asynchronous_Serial::
+    Double_Buffered_Output_Stream<Mock_Non_Blocking_Transmitter::Handle, N, Counting_Idle>;
+
+} // namespace
+
+/**
+ * \brief Verify
+ *        picolibrary::Asynchronous_Serial::Double_Buffered_Output_Stream_Buffer::initialize()
+ *        properly handles a transmitter initialization error.
+ */
+TEST( initialize, transmitterInitializationError )
+{
+    auto transmitter = Mock_Non_Blocking_Transmitter{};
+    auto idle_calls  = std::size_t{};
+
+    auto buffer = Double_Buffered_Output_Stream_Buffer{ transmitter.handle(), Counting_Idle{ &idle_calls } };
+
+    auto const error = random<Mock_Error>();
+
+    EXPECT_CALL( transmitter, initialize() ).WillOnce( Return( error ) );
+
+    auto const result = buffer.initialize();
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify
+ *        picolibrary::Asynchronous_Serial::Double_Buffered_Output_Stream_Buffer::initialize()
+ *        works properly.
+ */
+TEST( initialize, worksProperly )
+{
+    auto transmitter = Mock_Non_Blocking_Transmitter{};
+    auto idle_calls  = std::size_t{};
+
+    auto buffer = Double_Buffered_Output_Stream_Buffer{ transmitter.handle(), Counting_Idle{ &idle_calls } };
+
+    EXPECT_CALL( transmitter, initialize() ).WillOnce( Return( Result<Void, Error_Code>{} ) );
+
+    EXPECT_FALSE( buffer.initialize().is_error() );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Double_Buffered_Output_Stream_Buffer::put()
+ *        properly handles a transmission start error.
+ */
+TEST( put, startTransmitError )
+{
+    auto transmitter = Mock_Non_Blocking_Transmitter{};
+    auto idle_calls  = std::size_t{};
+
+    auto buffer = Double_Buffered_Output_Stream_Buffer{ transmitter.handle(), Counting_Idle{ &idle_calls } };
+
+    auto const error = random<Mock_Error>();
+
+    EXPECT_CALL( transmitter, transmit_complete() ).WillOnce( Return( true ) );
+    EXPECT_CALL( transmitter, start_transmit( _ ) ).WillOnce( Return( error ) );
+
+    auto const values = random_container<std::vector<std::uint8_t>>( N + 1 );
+
+    auto const result = buffer.put( &*values.begin(), &*values.end() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Double_Buffered_Output_Stream_Buffer::put()
+ *        does not start a transmission until a buffer fills.
+ */
+TEST( put, partialBuffer )
+{
+    auto transmitter = Mock_Non_Blocking_Transmitter{};
+    auto idle_calls  = std::size_t{};
+
+    auto buffer = Double_Buffered_Output_Stream_Buffer{ transmitter.handle(), Counting_Idle{ &idle_calls } };
+
+    EXPECT_CALL( transmitter, transmit_complete() ).Times( 0 );
+    EXPECT_CALL( transmitter, start_transmit( _ ) ).Times( 0 );
+
+    auto const character = random<char>();
+    auto const values    = random_container<std::vector<std::uint8_t>>( N - 1 );
+
+    EXPECT_FALSE( buffer.put( character ).is_error() );
+    EXPECT_FALSE( buffer.put( &*values.begin(), &*values.end() ).is_error() );
+
+    EXPECT_EQ( buffer.size(), N );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Double_Buffered_Output_Stream_Buffer::put()
+ *        works properly.
+ */
+TEST( put, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto transmitter = Mock_Non_Blocking_Transmitter{};
+    auto idle_calls  = std::size_t{};
+
+    auto buffer = Double_Buffered_Output_Stream_Buffer{ transmitter.handle(), Counting_Idle{ &idle_calls } };
+
+    auto const string = random_container<std::string>( random<std::size_t>( 2 * N + 1, 3 * N - 1 ) );
+
+    EXPECT_CALL( transmitter, transmit_complete() ).WillOnce( Return( true ) );
+    EXPECT_CALL(
+        transmitter, start_transmit( std::vector<std::uint8_t>{ string.begin(), string.begin() + N } ) )
+        .WillOnce( Return( Result<Void, Error_Code>{} ) );
+    EXPECT_CALL( transmitter, transmit_complete() )
+        .WillOnce( Return( false ) )
+        .WillOnce( Return( false ) )
+        .WillOnce( Return( true ) );
+    EXPECT_CALL(
+        transmitter,
+        start_transmit( std::vector<std::uint8_t>{ string.begin() + N, string.begin() + 2 * N } ) )
+        .WillOnce( Return( Result<Void, Error_Code>{} ) );
+
+    EXPECT_FALSE( buffer.put( string.c_str() ).is_error() );
+
+    EXPECT_EQ( idle_calls, 2 );
+    EXPECT_EQ( buffer.size(), string.size() - 2 * N );
+
+    EXPECT_CALL( transmitter, transmit_complete() ).WillOnce( Return( true ) );
+}
+
+/**
+ * \brief Verify
+ *        picolibrary::Asynchronous_Serial::Double_Buffered_Output_Stream_Buffer::flush()
+ *        works properly.
+ */
+TEST( flush, worksProperly )
+{
+    {
+        auto transmitter = Mock_Non_Blocking_Transmitter{};
+        auto idle_calls  = std::size_t{};
+
+        auto buffer = Double_Buffered_Output_Stream_Buffer{ transmitter.handle(), Counting_Idle{ &idle_calls } };
+
+        EXPECT_CALL( transmitter, transmit_complete() ).Times( 0 );
+        EXPECT_CALL( transmitter, start_transmit( _ ) ).Times( 0 );
+
+        EXPECT_FALSE( buffer.flush().is_error() );
+    }
+
+    {
+        auto const in_sequence = InSequence{};
+
+        auto transmitter = Mock_Non_Blocking_Transmitter{};
+        auto idle_calls  = std::size_t{};
+
+        auto buffer = Double_Buffered_Output_Stream_Buffer{ transmitter.handle(), Counting_Idle{ &idle_calls } };
+
+        auto const values = random_container<std::vector<std::int8_t>>( random<std::size_t>( 1, N ) );
+
+        EXPECT_FALSE( buffer.put( &*values.begin(), &*values.end() ).is_error() );
+
+        EXPECT_CALL( transmitter, transmit_complete() ).WillOnce( Return( true ) );
+        EXPECT_CALL( transmitter, start_transmit( std::vector<std::uint8_t>{ values.begin(), values.end() } ) )
+            .WillOnce( Return( Result<Void, Error_Code>{} ) );
+
+        EXPECT_FALSE( buffer.flush().is_error() );
+
+        EXPECT_EQ( buffer.size(), 0 );
+        EXPECT_EQ( idle_calls, 0 );
+
+        EXPECT_CALL( transmitter, transmit_complete() ).WillOnce( Return( true ) );
+    }
+}
+
+/**
+ * \brief Verify
+ *        picolibrary::Asynchronous_Serial::Double_Buffered_Output_Stream_Buffer::~Double_Buffered_Output_Stream_Buffer()
+ *        waits for a transmission that is in progress to complete.
+ */
+TEST( destructor, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto transmitter = Mock_Non_Blocking_Transmitter{};
+    auto idle_calls  = std::size_t{};
+
+    {
+        auto buffer = Double_Buffered_Output_Stream_Buffer{ transmitter.handle(), Counting_Idle{ &idle_calls } };
+
+        auto const values = random_container<std::vector<std::uint8_t>>( random<std::size_t>( 1, N ) );
+
+        EXPECT_CALL( transmitter, transmit_complete() ).WillOnce( Return( true ) );
+        EXPECT_CALL( transmitter, start_transmit( values ) ).WillOnce( Return( Result<Void, Error_Code>{} ) );
+
+        EXPECT_FALSE( buffer.put( &*values.begin(), &*values.end() ).is_error() );
+        EXPECT_FALSE( buffer.flush().is_error() );
+
+        EXPECT_CALL( transmitter, transmit_complete() )
+            .WillOnce( Return( false ) )
+            .WillOnce( Return( false ) )
+            .WillOnce( Return( true ) );
+    }
+
+    EXPECT_EQ( idle_calls, 2 );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Double_Buffered_Output_Stream works
+ *        properly.
+ */
+TEST( stream, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto transmitter = Mock_Non_Blocking_Transmitter{};
+    auto idle_calls  = std::size_t{};
+
+    auto stream = Double_Buffered_Output_Stream{ transmitter.handle(), Counting_Idle{ &idle_calls } };
+
+    EXPECT_TRUE( stream.buffer_is_set() );
+
+    auto const string = random_container<std::string>( random<std::size_t>( 1, N ) );
+
+    EXPECT_CALL( transmitter, transmit_complete() ).WillOnce( Return( true ) );
+    EXPECT_CALL( transmitter, start_transmit( std::vector<std::uint8_t>{ string.begin(), string.end() } ) )
+        .WillOnce( Return( Result<Void, Error_Code>{} ) );
+    EXPECT_CALL( transmitter, transmit_complete() ).WillOnce( Return( false ) );
+
+    EXPECT_FALSE( stream.put( string.c_str() ).is_error() );
+    EXPECT_FALSE( stream.flush().is_error() );
+
+    EXPECT_FALSE( stream.transmit_complete() );
+
+    EXPECT_CALL( transmitter, transmit_complete() ).WillOnce( Return( true ) );
+}
+
+/**
+ * \brief Execute the picolibrary::Asynchronous_Serial::Double_Buffered_Output_Stream_Buffer
+ *        unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
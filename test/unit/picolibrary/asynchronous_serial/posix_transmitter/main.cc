@@ -0,0 +1,335 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Asynchronous_Serial::Posix_Transmitter unit test program.
+ */
+
+#include <cerrno>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/asynchronous_serial/posix.h"
+#include "picolibrary/asynchronous_serial/stream.h"
+#include "picolibrary/format.h"
+#include "picolibrary/posix.h"
+#include "picolibrary/testing/unit/random.h"
+
+namespace {
+
+using ::picolibrary::Asynchronous_Serial::Posix_Transmitter;
+using ::picolibrary::Asynchronous_Serial::Unbuffered_Output_Stream;
+using ::picolibrary::Format::Decimal;
+using ::picolibrary::Posix::make_errno_error_code;
+using ::picolibrary::Testing::Unit::random;
+using ::picolibrary::Testing::Unit::random_container;
+
+/**
+ * \brief Pipe.
+ */
+class Pipe {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    Pipe() noexcept
+    {
+        EXPECT_EQ( ::pipe( m_file_descriptors ), 0 );
+    }
+
+    Pipe( Pipe && ) = delete;
+
+    Pipe( Pipe const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Pipe() noexcept
+    {
+        close_read_end();
+        close_write_end();
+    }
+
+    auto operator=( Pipe && ) = delete;
+
+    auto operator=( Pipe const & ) = delete;
+
+    /**
+     * \brief Get the pipe's read end.
+     *
+     * \return The pipe's read end.
+     */
+    auto read_end() const noexcept
+    {
+        return m_file_descriptors[ 0 ];
+    }
+
+    /**
+     * \brief Get the pipe's write end.
+     *
+     * \return The pipe's write end.
+     */
+    auto write_end() const noexcept
+    {
+        return m_file_descriptors[ 1 ];
+    }
+
+    /**
+     * \brief Close the pipe's read end.
+     */
+    void close_read_end() noexcept
+    {
+        close( m_file_descriptors[ 0 ] );
+    }
+
+    /**
+     * \brief Close the pipe's write end.
+     */
+    void close_write_end() noexcept
+    {
+        close( m_file_descriptors[ 1 ] );
+    }
+
+  private:
+    /**
+     * \brief The pipe's file descriptors.
+     */
+    int m_file_descriptors[ 2 ]{ -1, -1 };
+
+    /**
+     * \brief Close a file descriptor.
+     *
+     * \param[in,out] file_descriptor The file descriptor to close.
+     */
+    static void close( int & file_descriptor ) noexcept
+    {
+        if ( file_descriptor >= 0 ) {
+            ::close( file_descriptor );
+
+            file_descriptor = -1;
+        } // if
+    }
+};
+
+/**
+ * \brief Read from a file descriptor until the requested amount of data has been read or
+ *        the end of the file has been reached.
+ *
+ * \param[in] file_descriptor The file descriptor to read from.
+ * \param[in] size The amount of data to read.
+ *
+ * \return The data that was read.
+ */
+auto read_all( int file_descriptor, std::size_t size )
+{
+    auto data = std::vector<std::uint8_t>( size );
+
+    auto position = std::size_t{};
+    while ( position < size ) {
+        auto const result = ::read( file_descriptor, data.data() + position, size - position );
+        if ( result < 0 and errno == EINTR ) {
+            continue;
+        } // if
+
+        if ( result <= 0 ) {
+            break;
+        } // if
+
+        position += static_cast<std::size_t>( result );
+    } // while
+
+    data.resize( position );
+
+    return data;
+}
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Posix_Transmitter::initialize()
+ *        properly handles an invalid file descriptor.
+ */
+TEST( initialize, invalidFileDescriptor )
+{
+    auto transmitter = Posix_Transmitter{};
+
+    auto const result = transmitter.initialize();
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), make_errno_error_code( EBADF ) );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Posix_Transmitter::initialize()
+ *        properly handles a file descriptor that is not open for writing.
+ */
+TEST( initialize, readOnlyFileDescriptor )
+{
+    auto const pipe = Pipe{};
+
+    auto transmitter = Posix_Transmitter{ pipe.read_end() };
+
+    auto const result = transmitter.initialize();
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), make_errno_error_code( EBADF ) );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Posix_Transmitter::initialize() works
+ *        properly.
+ */
+TEST( initialize, worksProperly )
+{
+    auto const pipe = Pipe{};
+
+    auto transmitter = Posix_Transmitter{ pipe.write_end() };
+
+    EXPECT_FALSE( transmitter.initialize().is_error() );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Posix_Transmitter::transmit() properly
+ *        handles a write error.
+ */
+TEST( transmit, writeError )
+{
+    auto pipe = Pipe{};
+
+    pipe.close_read_end();
+
+    auto transmitter = Posix_Transmitter{ pipe.write_end() };
+
+    auto const values = random_container<std::vector<std::uint8_t>>( random<std::uint_fast8_t>( 1 ) );
+
+    auto const result = transmitter.transmit( &*values.begin(), &*values.end() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), make_errno_error_code( EPIPE ) );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Posix_Transmitter::transmit() works
+ *        properly.
+ */
+TEST( transmit, worksProperly )
+{
+    auto pipe = Pipe{};
+
+    auto transmitter = Posix_Transmitter{ pipe.write_end() };
+
+    auto const value = random<std::uint8_t>();
+
+    EXPECT_FALSE( transmitter.transmit( value ).is_error() );
+
+    EXPECT_EQ( read_all( pipe.read_end(), 1 ), std::vector<std::uint8_t>{ value } );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Posix_Transmitter::transmit() properly
+ *        handles partial writes to a non-blocking file descriptor.
+ */
+TEST( transmit, partialWrites )
+{
+    auto pipe = Pipe{};
+
+    ASSERT_EQ( ::fcntl( pipe.write_end(), F_SETFL, O_NONBLOCK ), 0 );
+
+    auto transmitter = Posix_Transmitter{ pipe.write_end() };
+
+    auto const values = random_container<std::vector<std::uint8_t>>(
+        random<std::size_t>( 1 << 18, 1 << 19 ) );
+
+    auto received = std::vector<std::uint8_t>{};
+
+    auto reader = std::thread{ [ &pipe, &received, size = values.size() ]() {
+        received = read_all( pipe.read_end(), size );
+    } };
+
+    EXPECT_FALSE( transmitter.transmit( &*values.begin(), &*values.end() ).is_error() );
+
+    reader.join();
+
+    EXPECT_EQ( received, values );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Unbuffered_Output_Stream works properly
+ *        end to end through a pseudo-terminal pair.
+ */
+TEST( pseudoTerminal, worksProperly )
+{
+    auto const controller = ::posix_openpt( O_RDWR | O_NOCTTY );
+    ASSERT_GE( controller, 0 );
+    ASSERT_EQ( ::grantpt( controller ), 0 );
+    ASSERT_EQ( ::unlockpt( controller ), 0 );
+
+    auto const device = ::open( ::ptsname( controller ), O_RDWR | O_NOCTTY );
+    ASSERT_GE( device, 0 );
+
+    auto attributes = ::termios{};
+    ASSERT_EQ( ::tcgetattr( device, &attributes ), 0 );
+    ::cfmakeraw( &attributes );
+    ASSERT_EQ( ::tcsetattr( device, TCSANOW, &attributes ), 0 );
+
+    auto stream = Unbuffered_Output_Stream{ Posix_Transmitter{ device } };
+
+    EXPECT_FALSE( stream.initialize().is_error() );
+
+    auto const string = random_container<std::string>();
+    auto const value  = random<std::uint32_t>();
+
+    EXPECT_FALSE( stream.print( "{} {}\n", string.c_str(), Decimal{ value } ).is_error() );
+
+    auto const expected = string + ' ' + std::to_string( value ) + '\n';
+
+    EXPECT_EQ(
+        read_all( controller, expected.size() ),
+        std::vector<std::uint8_t>( expected.begin(), expected.end() ) );
+
+    ::close( device );
+    ::close( controller );
+}
+
+/**
+ * \brief Execute the picolibrary::Asynchronous_Serial::Posix_Transmitter unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    std::signal( SIGPIPE, SIG_IGN );
+
+    return RUN_ALL_TESTS();
+}
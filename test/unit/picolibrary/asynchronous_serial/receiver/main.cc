@@ -0,0 +1,105 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Asynchronous_Serial::Receiver unit test program.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/asynchronous_serial.h"
+#include "picolibrary/error.h"
+#include "picolibrary/result.h"
+#include "picolibrary/testing/unit/asynchronous_serial.h"
+#include "picolibrary/testing/unit/error.h"
+#include "picolibrary/testing/unit/random.h"
+
+namespace {
+
+using ::picolibrary::Error_Code;
+using ::picolibrary::Result;
+using ::picolibrary::Testing::Unit::Mock_Error;
+using ::picolibrary::Testing::Unit::random;
+using ::picolibrary::Testing::Unit::random_container;
+using ::testing::InSequence;
+using ::testing::Return;
+
+using Receiver = ::picolibrary::Asynchronous_Serial::Receiver<
+    ::picolibrary::Testing::Unit::Asynchronous_Serial::Mock_Basic_Receiver<std::uint8_t>>;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Receiver::receive() properly handles a
+ *        reception error.
+ */
+TEST( receive, receptionError )
+{
+    auto receiver = Receiver{};
+
+    auto const error = random<Mock_Error>();
+
+    EXPECT_CALL( receiver, receive() ).WillOnce( Return( error ) );
+
+    auto values = std::vector<std::uint8_t>( random<std::uint_fast8_t>( 1 ) );
+
+    auto const result = receiver.receive( &*values.begin(), &*values.end() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Receiver::receive() works properly.
+ */
+TEST( receive, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto receiver = Receiver{};
+
+    auto const values_expected = random_container<std::vector<std::uint8_t>>();
+
+    for ( auto const value : values_expected ) {
+        EXPECT_CALL( receiver, receive() ).WillOnce( Return( Result<std::uint8_t, Error_Code>{ value } ) );
+    } // for
+
+    auto values = std::vector<std::uint8_t>( values_expected.size() );
+
+    EXPECT_FALSE( receiver.receive( &*values.begin(), &*values.end() ).is_error() );
+
+    EXPECT_EQ( values, values_expected );
+}
+
+/**
+ * \brief Execute the picolibrary::Asynchronous_Serial::Receiver unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
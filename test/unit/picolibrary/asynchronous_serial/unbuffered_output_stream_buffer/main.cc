@@ -22,7 +22,9 @@
  */
 
 #include <cstdint>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -42,6 +44,7 @@ using ::picolibrary::Void;
 using ::picolibrary::Asynchronous_Serial::Unbuffered_Output_Stream_Buffer;
 using ::picolibrary::Testing::Unit::Mock_Error;
 using ::picolibrary::Testing::Unit::random;
+using ::picolibrary::Testing::Unit::random_container;
 using ::testing::A;
 using ::testing::Return;
 
@@ -123,6 +126,64 @@ TEST( putChar, worksProperly )
     EXPECT_FALSE( buffer.put( character ).is_error() );
 }
 
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Unbuffered_Output_Stream_Buffer::put(
+ *        char const *, char const * ) properly handles a put error.
+ */
+TEST( putCharBlock, putError )
+{
+    auto transmitter = Mock_Transmitter{};
+
+    auto buffer = Unbuffered_Output_Stream_Buffer{ transmitter.handle() };
+
+    auto const error = random<Mock_Error>();
+
+    EXPECT_CALL( transmitter, transmit( A<std::vector<std::uint8_t>>() ) ).WillOnce( Return( error ) );
+
+    auto const string = random_container<std::string>( random<std::uint_fast8_t>( 1 ) );
+
+    auto const result = buffer.put( &*string.begin(), &*string.end() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Unbuffered_Output_Stream_Buffer::put(
+ *        char const *, char const * ) works properly.
+ */
+TEST( putCharBlock, worksProperly )
+{
+    auto transmitter = Mock_Transmitter{};
+
+    auto buffer = Unbuffered_Output_Stream_Buffer{ transmitter.handle() };
+
+    auto const string = random_container<std::string>();
+
+    EXPECT_CALL( transmitter, transmit( std::vector<std::uint8_t>{ string.begin(), string.end() } ) )
+        .WillOnce( Return( Result<Void, Error_Code>{} ) );
+
+    EXPECT_FALSE( buffer.put( &*string.begin(), &*string.end() ).is_error() );
+}
+
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Unbuffered_Output_Stream_Buffer::put(
+ *        char const * ) works properly.
+ */
+TEST( putNullTerminatedString, worksProperly )
+{
+    auto transmitter = Mock_Transmitter{};
+
+    auto buffer = Unbuffered_Output_Stream_Buffer{ transmitter.handle() };
+
+    auto const string = random_container<std::string>();
+
+    EXPECT_CALL( transmitter, transmit( std::vector<std::uint8_t>{ string.begin(), string.end() } ) )
+        .WillOnce( Return( Result<Void, Error_Code>{} ) );
+
+    EXPECT_FALSE( buffer.put( string.c_str() ).is_error() );
+}
+
 /**
  * \brief Verify picolibrary::Asynchronous_Serial::Unbuffered_Output_Stream_Buffer::put(
  *        std::uint8_t ) properly handles a put error.
@@ -160,6 +221,23 @@ TEST( putUnsignedByte, worksProperly )
     EXPECT_FALSE( buffer.put( value ).is_error() );
 }
 
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Unbuffered_Output_Stream_Buffer::put(
+ *        std::uint8_t const *, std::uint8_t const * ) works properly.
+ */
+TEST( putUnsignedByteBlock, worksProperly )
+{
+    auto transmitter = Mock_Transmitter{};
+
+    auto buffer = Unbuffered_Output_Stream_Buffer{ transmitter.handle() };
+
+    auto const values = random_container<std::vector<std::uint8_t>>();
+
+    EXPECT_CALL( transmitter, transmit( values ) ).WillOnce( Return( Result<Void, Error_Code>{} ) );
+
+    EXPECT_FALSE( buffer.put( &*values.begin(), &*values.end() ).is_error() );
+}
+
 /**
  * \brief Verify picolibrary::Asynchronous_Serial::Unbuffered_Output_Stream_Buffer::put(
  *        std::int8_t ) properly handles a put error.
@@ -197,6 +275,24 @@ TEST( putSignedByte, worksProperly )
     EXPECT_FALSE( buffer.put( value ).is_error() );
 }
 
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Unbuffered_Output_Stream_Buffer::put(
+ *        std::int8_t const *, std::int8_t const * ) works properly.
+ */
+TEST( putSignedByteBlock, worksProperly )
+{
+    auto transmitter = Mock_Transmitter{};
+
+    auto buffer = Unbuffered_Output_Stream_Buffer{ transmitter.handle() };
+
+    auto const values = random_container<std::vector<std::int8_t>>();
+
+    EXPECT_CALL( transmitter, transmit( std::vector<std::uint8_t>{ values.begin(), values.end() } ) )
+        .WillOnce( Return( Result<Void, Error_Code>{} ) );
+
+    EXPECT_FALSE( buffer.put( &*values.begin(), &*values.end() ).is_error() );
+}
+
 /**
  * \brief Verify
  *        picolibrary::Asynchronous_Serial::Unbuffered_Output_Stream_Buffer::flush() works
@@ -21,14 +21,91 @@
  */
 
 #include <cstdint>
+#include <limits>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "picolibrary/bit_manipulation.h"
+#include "picolibrary/testing/unit/random.h"
 
 namespace {
 
+using ::picolibrary::bit_field_mask;
+using ::picolibrary::byte_swap;
+using ::picolibrary::countl_zero;
+using ::picolibrary::countr_zero;
+using ::picolibrary::extract_bit_field;
+using ::picolibrary::insert_bit_field;
+using ::picolibrary::popcount;
 using ::picolibrary::reflect;
+using ::picolibrary::rotl;
+using ::picolibrary::rotr;
+using ::picolibrary::Testing::Unit::random;
+
+template<typename Integer>
+auto reference_bit( Integer value, int bit ) noexcept
+{
+    return static_cast<bool>( ( value >> bit ) & 1 );
+}
+
+template<typename Integer>
+auto reference_reflect( Integer value ) noexcept
+{
+    auto reflection = Integer{};
+
+    for ( auto bit = 0; bit < std::numeric_limits<Integer>::digits; ++bit ) {
+        reflection = static_cast<Integer>( ( reflection << 1 ) | reference_bit( value, bit ) );
+    } // for
+
+    return reflection;
+}
+
+template<typename Integer>
+auto reference_popcount( Integer value ) noexcept
+{
+    auto count = 0;
+
+    for ( auto bit = 0; bit < std::numeric_limits<Integer>::digits; ++bit ) {
+        count += reference_bit( value, bit );
+    } // for
+
+    return count;
+}
+
+template<typename Integer>
+auto reference_countl_zero( Integer value ) noexcept
+{
+    auto count = 0;
+
+    for ( auto bit = std::numeric_limits<Integer>::digits - 1;
+          bit >= 0 and not reference_bit( value, bit );
+          --bit ) {
+        ++count;
+    } // for
+
+    return count;
+}
+
+template<typename Integer>
+auto reference_countr_zero( Integer value ) noexcept
+{
+    auto count = 0;
+
+    for ( auto bit = 0; bit < std::numeric_limits<Integer>::digits and not reference_bit( value, bit );
+          ++bit ) {
+        ++count;
+    } // for
+
+    return count;
+}
+
+template<typename Integer>
+void verify_counts( Integer value )
+{
+    EXPECT_EQ( popcount( value ), reference_popcount( value ) );
+    EXPECT_EQ( countl_zero( value ), reference_countl_zero( value ) );
+    EXPECT_EQ( countr_zero( value ), reference_countr_zero( value ) );
+}
 
 } // namespace
 
@@ -255,6 +332,128 @@ TEST( reflect, uint32WorksProperly )
     } // for
 }
 
+/**
+ * \brief Verify picolibrary::reflect() works properly with std::uint64_t input.
+ */
+TEST( reflect, uint64WorksProperly )
+{
+    EXPECT_EQ( reflect( std::uint64_t{ 0x0000000000000000 } ), 0x0000000000000000 );
+    EXPECT_EQ( reflect( std::uint64_t{ 0xFFFFFFFFFFFFFFFF } ), 0xFFFFFFFFFFFFFFFF );
+    EXPECT_EQ( reflect( std::uint64_t{ 0x0000000000000001 } ), 0x8000000000000000 );
+    EXPECT_EQ( reflect( std::uint64_t{ 0x8000000000000000 } ), 0x0000000000000001 );
+    EXPECT_EQ( reflect( std::uint64_t{ 0x0123456789ABCDEF } ), 0xF7B3D591E6A2C480 );
+
+    for ( auto i = 0; i < 100; ++i ) {
+        auto const value = random<std::uint64_t>();
+
+        EXPECT_EQ( reflect( value ), reference_reflect( value ) );
+    } // for
+}
+
+/**
+ * \brief Verify picolibrary::reflect() can be evaluated at compile time.
+ */
+TEST( reflect, constexprWorksProperly )
+{
+    static_assert( reflect( std::uint8_t{ 0b00000001 } ) == 0b10000000 );
+    static_assert( reflect( std::uint16_t{ 0x1234 } ) == 0x2C48 );
+    static_assert( reflect( std::uint32_t{ 0x12345678 } ) == 0x1E6A2C48 );
+}
+
+/**
+ * \brief Verify picolibrary::popcount(), picolibrary::countl_zero(), and
+ *        picolibrary::countr_zero() work properly.
+ */
+TEST( count, worksProperly )
+{
+    verify_counts( std::uint8_t{ 0x00 } );
+    verify_counts( std::uint16_t{ 0x0000 } );
+    verify_counts( std::uint32_t{ 0x00000000 } );
+    verify_counts( std::uint64_t{ 0x0000000000000000 } );
+
+    verify_counts( std::uint8_t{ 0xFF } );
+    verify_counts( std::uint16_t{ 0xFFFF } );
+    verify_counts( std::uint32_t{ 0xFFFFFFFF } );
+    verify_counts( std::uint64_t{ 0xFFFFFFFFFFFFFFFF } );
+
+    for ( auto i = 0; i < 100; ++i ) {
+        verify_counts( random<std::uint8_t>() );
+        verify_counts( random<std::uint16_t>() );
+        verify_counts( random<std::uint32_t>() );
+        verify_counts( random<std::uint64_t>() );
+    } // for
+
+    static_assert( popcount( std::uint8_t{ 0b10110010 } ) == 4 );
+    static_assert( countl_zero( std::uint8_t{ 0b00010000 } ) == 3 );
+    static_assert( countr_zero( std::uint8_t{ 0b00010000 } ) == 4 );
+}
+
+/**
+ * \brief Verify picolibrary::rotl() and picolibrary::rotr() work properly.
+ */
+TEST( rotate, worksProperly )
+{
+    EXPECT_EQ( rotl( std::uint8_t{ 0b10010110 }, 0 ), 0b10010110 );
+    EXPECT_EQ( rotl( std::uint8_t{ 0b10010110 }, 3 ), 0b10110100 );
+    EXPECT_EQ( rotl( std::uint8_t{ 0b10010110 }, 8 ), 0b10010110 );
+    EXPECT_EQ( rotl( std::uint8_t{ 0b10010110 }, 11 ), 0b10110100 );
+    EXPECT_EQ( rotl( std::uint32_t{ 0x80000001 }, 4 ), 0x00000018 );
+
+    EXPECT_EQ( rotr( std::uint8_t{ 0b10010110 }, 0 ), 0b10010110 );
+    EXPECT_EQ( rotr( std::uint8_t{ 0b10010110 }, 3 ), 0b11010010 );
+    EXPECT_EQ( rotr( std::uint8_t{ 0b10010110 }, 8 ), 0b10010110 );
+    EXPECT_EQ( rotr( std::uint32_t{ 0x80000001 }, 4 ), 0x18000000 );
+
+    for ( auto i = 0; i < 100; ++i ) {
+        auto const value = random<std::uint16_t>();
+        auto const shift = random<std::uint_fast8_t>( 0, 15 );
+
+        EXPECT_EQ( rotr( rotl( value, shift ), shift ), value );
+    } // for
+}
+
+/**
+ * \brief Verify picolibrary::byte_swap() works properly.
+ */
+TEST( byteSwap, worksProperly )
+{
+    EXPECT_EQ( byte_swap( std::uint8_t{ 0x12 } ), 0x12 );
+    EXPECT_EQ( byte_swap( std::uint16_t{ 0x1234 } ), 0x3412 );
+    EXPECT_EQ( byte_swap( std::uint32_t{ 0x12345678 } ), 0x78563412 );
+    EXPECT_EQ( byte_swap( std::uint64_t{ 0x0123456789ABCDEF } ), 0xEFCDAB8967452301 );
+
+    static_assert( byte_swap( std::uint16_t{ 0x1234 } ) == 0x3412 );
+}
+
+/**
+ * \brief Verify picolibrary::bit_field_mask(), picolibrary::extract_bit_field(), and
+ *        picolibrary::insert_bit_field() work properly.
+ */
+TEST( bitField, worksProperly )
+{
+    EXPECT_EQ( bit_field_mask<std::uint8_t>( 0, 3 ), 0b00000000 );
+    EXPECT_EQ( bit_field_mask<std::uint8_t>( 1, 0 ), 0b00000001 );
+    EXPECT_EQ( bit_field_mask<std::uint8_t>( 2, 6 ), 0b11000000 );
+    EXPECT_EQ( bit_field_mask<std::uint8_t>( 8, 0 ), 0b11111111 );
+    EXPECT_EQ( bit_field_mask<std::uint32_t>( 32, 0 ), 0xFFFFFFFF );
+    EXPECT_EQ( bit_field_mask<std::uint32_t>( 12, 8 ), 0x000FFF00 );
+
+    EXPECT_EQ( extract_bit_field( std::uint8_t{ 0b10110110 }, std::uint8_t{ 0b00111000 } ), 0b110 );
+    EXPECT_EQ( extract_bit_field( std::uint32_t{ 0x12345678 }, std::uint32_t{ 0x000FFF00 } ), 0x456 );
+
+    EXPECT_EQ(
+        insert_bit_field( std::uint8_t{ 0b10110110 }, std::uint8_t{ 0b00111000 }, std::uint8_t{ 0b001 } ),
+        0b10001110 );
+    EXPECT_EQ(
+        insert_bit_field( std::uint8_t{ 0b00000000 }, std::uint8_t{ 0b00000110 }, std::uint8_t{ 0b111 } ),
+        0b00000110 );
+    EXPECT_EQ(
+        insert_bit_field( std::uint32_t{ 0x12345678 }, std::uint32_t{ 0x000FFF00 }, std::uint32_t{ 0xABC } ),
+        0x123ABC78 );
+
+    static_assert( bit_field_mask<std::uint8_t>( 2, 1 ) == 0b00000110 );
+}
+
 /**
  * \brief Execute the picolibrary::Bit_Manipulation unit tests.
  *
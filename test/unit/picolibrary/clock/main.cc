@@ -0,0 +1,172 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary clock unit test program.
+ */
+
+#include <cstdint>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/clock.h"
+#include "picolibrary/testing/unit/random.h"
+
+namespace {
+
+using ::picolibrary::Periodic_Timer;
+using ::picolibrary::Testing::Unit::random;
+
+/**
+ * \brief Manually advanced clock.
+ */
+struct Clock {
+    /**
+     * \brief The current time.
+     */
+    std::uint16_t * now{};
+
+    /**
+     * \brief Get the current time.
+     *
+     * \return The current time.
+     */
+    auto operator()() const noexcept
+    {
+        return *now;
+    }
+};
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Periodic_Timer::expired() works properly.
+ */
+TEST( expired, worksProperly )
+{
+    auto now   = random<std::uint16_t>();
+    auto timer = Periodic_Timer{ Clock{ &now }, 10 };
+
+    auto const start = now;
+
+    EXPECT_EQ( timer.period(), 10 );
+    EXPECT_EQ( timer.deadline(), static_cast<std::uint16_t>( start + 10 ) );
+    EXPECT_FALSE( timer.expired() );
+
+    now = static_cast<std::uint16_t>( start + 9 );
+    EXPECT_FALSE( timer.expired() );
+
+    // late detection does not cause drift
+    now = static_cast<std::uint16_t>( start + 13 );
+    EXPECT_TRUE( timer.expired() );
+    EXPECT_EQ( timer.deadline(), static_cast<std::uint16_t>( start + 20 ) );
+    EXPECT_FALSE( timer.expired() );
+    EXPECT_EQ( timer.missed(), 0 );
+
+    now = static_cast<std::uint16_t>( start + 20 );
+    EXPECT_TRUE( timer.expired() );
+    EXPECT_EQ( timer.deadline(), static_cast<std::uint16_t>( start + 30 ) );
+
+    // deadlines skipped over are counted as missed
+    now = static_cast<std::uint16_t>( start + 55 );
+    EXPECT_TRUE( timer.expired() );
+    EXPECT_EQ( timer.missed(), 2 );
+    EXPECT_EQ( timer.deadline(), static_cast<std::uint16_t>( start + 60 ) );
+    EXPECT_FALSE( timer.expired() );
+
+    timer.restart();
+    EXPECT_EQ( timer.missed(), 0 );
+    EXPECT_EQ( timer.deadline(), static_cast<std::uint16_t>( start + 65 ) );
+}
+
+/**
+ * \brief Verify picolibrary::Periodic_Timer::expired() and
+ *        picolibrary::Periodic_Timer::wait() properly handle a period of zero.
+ */
+TEST( expired, zeroPeriod )
+{
+    {
+        auto timer = Periodic_Timer<Clock>{};
+
+        EXPECT_EQ( timer.period(), 0 );
+        EXPECT_TRUE( timer.expired() );
+
+        timer.wait();
+
+        EXPECT_EQ( timer.missed(), 0 );
+    }
+
+    {
+        auto       now   = random<std::uint16_t>();
+        auto const start = now;
+        auto       timer = Periodic_Timer{ Clock{ &now }, 0 };
+
+        EXPECT_TRUE( timer.expired() );
+
+        now = static_cast<std::uint16_t>( start + random<std::uint16_t>() );
+
+        timer.wait();
+
+        EXPECT_TRUE( timer.expired() );
+        EXPECT_EQ( timer.missed(), 0 );
+    }
+}
+
+/**
+ * \brief Verify picolibrary::Periodic_Timer::wait() works properly.
+ */
+TEST( wait, worksProperly )
+{
+    auto       now    = random<std::uint16_t>();
+    auto const start  = now;
+    auto const period = random<std::uint16_t>( 1, 1000 );
+
+    auto idles = std::uint_fast32_t{};
+    auto timer = Periodic_Timer{ Clock{ &now }, period, [ & ]() noexcept {
+                                    ++idles;
+                                    ++now;
+                                } };
+
+    auto const periods = random<std::uint16_t>( 1, 16 );
+    for ( auto i = std::uint16_t{}; i < periods; ++i ) {
+        timer();
+
+        EXPECT_EQ( now, static_cast<std::uint16_t>( start + ( i + 1 ) * period ) );
+
+        // simulate periodic work that takes time to execute
+        now += static_cast<std::uint16_t>( random<std::uint16_t>( 0, period - 1 ) );
+    } // for
+
+    EXPECT_EQ( timer.missed(), 0 );
+    EXPECT_LE( idles, static_cast<std::uint_fast32_t>( periods ) * period );
+}
+
+/**
+ * \brief Execute the picolibrary clock unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
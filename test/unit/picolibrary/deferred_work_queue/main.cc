@@ -0,0 +1,128 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Deferred_Work_Queue unit test program.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/deferred_work_queue.h"
+#include "picolibrary/testing/unit/random.h"
+
+namespace {
+
+using ::picolibrary::Deferred_Work_Queue;
+using ::picolibrary::Testing::Unit::random_container;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Deferred_Work_Queue::post() and
+ *        picolibrary::Deferred_Work_Queue::execute() work properly.
+ */
+TEST( postExecute, worksProperly )
+{
+    auto queue = Deferred_Work_Queue<8>{};
+
+    EXPECT_EQ( queue.capacity(), 8 );
+    EXPECT_EQ( queue.execute(), 0 );
+
+    auto log = std::vector<std::uint32_t>{};
+
+    for ( auto i = 0; i < 3; ++i ) {
+        auto const values = random_container<std::vector<std::uint32_t>>( 8 );
+
+        for ( auto const value : values ) {
+            EXPECT_TRUE( queue.post( [ &log, value ]() noexcept { log.push_back( value ); } ) );
+        } // for
+
+        EXPECT_FALSE( queue.post( []() noexcept {} ) );
+
+        log.clear();
+
+        EXPECT_EQ( queue.execute( 3 ), 3 );
+        EXPECT_EQ( log, std::vector<std::uint32_t>( values.begin(), values.begin() + 3 ) );
+
+        EXPECT_EQ( queue.execute(), 5 );
+        EXPECT_EQ( log, values );
+
+        EXPECT_EQ( queue.execute(), 0 );
+    } // for
+}
+
+/**
+ * \brief Verify picolibrary::Deferred_Work_Queue works properly when multiple contexts
+ *        post closures while another context executes them.
+ */
+TEST( concurrent, worksProperly )
+{
+    constexpr auto THREADS  = 4;
+    constexpr auto CLOSURES = std::uint32_t{ 10'000 };
+
+    auto queue = Deferred_Work_Queue<64>{};
+    auto sum   = std::uint64_t{};
+
+    auto done      = std::atomic<int>{};
+    auto producers = std::vector<std::thread>{};
+    for ( auto thread = 0; thread < THREADS; ++thread ) {
+        producers.emplace_back( [ &queue, &sum, &done ]() {
+            for ( auto value = std::uint32_t{ 1 }; value <= CLOSURES; ) {
+                if ( queue.post( [ &sum, value ]() noexcept { sum += value; } ) ) {
+                    ++value;
+                } else {
+                    std::this_thread::yield();
+                } // else
+            }     // for
+
+            ++done;
+        } );
+    } // for
+
+    while ( done != THREADS ) {
+        queue.execute();
+    } // while
+
+    queue.execute();
+
+    for ( auto & thread : producers ) {
+        thread.join();
+    } // for
+
+    EXPECT_EQ( sum, std::uint64_t{ THREADS } * CLOSURES * ( CLOSURES + 1 ) / 2 );
+}
+
+/**
+ * \brief Execute the picolibrary::Deferred_Work_Queue unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,253 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Error_Statistics unit test program.
+ */
+
+#include <cstdint>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/error.h"
+#include "picolibrary/error_statistics.h"
+#include "picolibrary/result.h"
+#include "picolibrary/testing/unit/error.h"
+#include "picolibrary/testing/unit/random.h"
+#include "picolibrary/testing/unit/stream.h"
+#include "picolibrary/void.h"
+
+namespace {
+
+using ::picolibrary::and_then;
+using ::picolibrary::Error_Code;
+using ::picolibrary::Error_ID;
+using ::picolibrary::Error_Statistics;
+using ::picolibrary::Generic_Error;
+using ::picolibrary::Generic_Error_Category;
+using ::picolibrary::make_error;
+using ::picolibrary::Result;
+using ::picolibrary::Void;
+using ::picolibrary::Testing::Unit::Mock_Error;
+using ::picolibrary::Testing::Unit::Mock_Output_Stream;
+using ::picolibrary::Testing::Unit::Output_String_Stream;
+using ::picolibrary::Testing::Unit::random;
+using ::testing::A;
+using ::testing::Return;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Error_Statistics::record() works properly.
+ */
+TEST( record, worksProperly )
+{
+    auto statistics = Error_Statistics{};
+
+    statistics.record( Generic_Error::NONRESPONSIVE_DEVICE );
+    statistics.record( Generic_Error::BUS_ERROR );
+    statistics.record( Generic_Error::NONRESPONSIVE_DEVICE );
+
+    EXPECT_EQ( statistics.count( Generic_Error::NONRESPONSIVE_DEVICE ), 2 );
+    EXPECT_EQ( statistics.count( Generic_Error::BUS_ERROR ), 1 );
+    EXPECT_EQ( statistics.count( Generic_Error::ARBITRATION_LOST ), 0 );
+    EXPECT_EQ( statistics.dropped(), 0 );
+}
+
+/**
+ * \brief Verify picolibrary::Error_Statistics::record() properly handles a full table.
+ */
+TEST( record, tableFull )
+{
+    auto const make_error = []( auto id ) {
+        return Error_Code{ Generic_Error_Category::instance(), static_cast<Error_ID>( id ) };
+    };
+
+    auto statistics = Error_Statistics{};
+
+    for ( auto id = Error_Statistics::CAPACITY; id; --id ) {
+        statistics.record( make_error( id ) );
+    } // for
+
+    statistics.record( make_error( 0 ) );
+    statistics.record( make_error( 1 ) );
+
+    EXPECT_EQ( statistics.count( make_error( 0 ) ), 0 );
+    EXPECT_EQ( statistics.count( make_error( 1 ) ), 2 );
+    EXPECT_EQ( statistics.dropped(), 1 );
+}
+
+/**
+ * \brief Verify picolibrary::Error_Statistics::reset() works properly.
+ */
+TEST( reset, worksProperly )
+{
+    auto statistics = Error_Statistics{};
+
+    statistics.record( Generic_Error::BUS_ERROR );
+
+    statistics.reset();
+
+    EXPECT_EQ( statistics.count( Generic_Error::BUS_ERROR ), 0 );
+    EXPECT_EQ( statistics.dropped(), 0 );
+}
+
+/**
+ * \brief Verify picolibrary::Result records errors with
+ *        picolibrary::Error_Statistics::instance() when error statistics are enabled.
+ */
+TEST( instance, worksProperly )
+{
+    auto const error = random<Mock_Error>();
+
+    auto const count = Error_Statistics::instance().count( error );
+
+    auto const result = Result<Void, Error_Code>{ error };
+
+    EXPECT_TRUE( result.is_error() );
+#ifdef PICOLIBRARY_ENABLE_ERROR_STATISTICS
+    EXPECT_EQ( Error_Statistics::instance().count( error ), count + 1 );
+#else  // PICOLIBRARY_ENABLE_ERROR_STATISTICS
+    EXPECT_EQ( Error_Statistics::instance().count( error ), count );
+#endif // PICOLIBRARY_ENABLE_ERROR_STATISTICS
+}
+
+/**
+ * \brief Verify picolibrary::Result records a failure once when the failure is
+ *        propagated through multiple layers.
+ */
+TEST( instance, propagation )
+{
+    auto const create = []() noexcept -> Result<Void, Error_Code> {
+        return Generic_Error::NONRESPONSIVE_DEVICE;
+    };
+    auto const propagate = [ &create ]() noexcept -> Result<std::uint8_t, Error_Code> {
+        auto result = create();
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        return random<std::uint8_t>();
+    };
+    auto const propagate_again = [ &propagate ]() noexcept -> Result<Void, Error_Code> {
+        auto result = propagate();
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        return {};
+    };
+
+    auto const count = Error_Statistics::instance().count( Generic_Error::NONRESPONSIVE_DEVICE );
+
+    auto const result = and_then( propagate_again(), []() noexcept {
+        return Result<Void, Error_Code>{};
+    } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::NONRESPONSIVE_DEVICE );
+#ifdef PICOLIBRARY_ENABLE_ERROR_STATISTICS
+    EXPECT_EQ( Error_Statistics::instance().count( Generic_Error::NONRESPONSIVE_DEVICE ), count + 1 );
+#else  // PICOLIBRARY_ENABLE_ERROR_STATISTICS
+    EXPECT_EQ( Error_Statistics::instance().count( Generic_Error::NONRESPONSIVE_DEVICE ), count );
+#endif // PICOLIBRARY_ENABLE_ERROR_STATISTICS
+}
+
+/**
+ * \brief Verify picolibrary::make_error() records a failure once.
+ */
+TEST( makeError, worksProperly )
+{
+    auto const error = Error_Code{ random<Mock_Error>() };
+
+    auto const count = Error_Statistics::instance().count( error );
+
+    auto const result = Result<Void, Error_Code>{ make_error( error ) };
+
+    EXPECT_TRUE( result.is_error() );
+#ifdef PICOLIBRARY_ENABLE_ERROR_STATISTICS
+    EXPECT_EQ( Error_Statistics::instance().count( error ), count + 1 );
+#else  // PICOLIBRARY_ENABLE_ERROR_STATISTICS
+    EXPECT_EQ( Error_Statistics::instance().count( error ), count );
+#endif // PICOLIBRARY_ENABLE_ERROR_STATISTICS
+}
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Error_Statistics> properly
+ *        handles a print error.
+ */
+TEST( outputFormatterErrorStatistics, printError )
+{
+    auto stream = Mock_Output_Stream{};
+
+    auto const error = random<Mock_Error>();
+
+    EXPECT_CALL( stream.buffer(), put( A<std::string>() ) ).WillOnce( Return( error ) );
+
+    auto statistics = Error_Statistics{};
+
+    statistics.record( Generic_Error::BUS_ERROR );
+
+    auto const result = stream.print( "{}", statistics );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_present() );
+    EXPECT_TRUE( stream.fatal_error_present() );
+}
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Error_Statistics> works
+ *        properly.
+ */
+TEST( outputFormatterErrorStatistics, worksProperly )
+{
+    auto stream = Output_String_Stream{};
+
+    auto statistics = Error_Statistics{};
+
+    statistics.record( Generic_Error::NONRESPONSIVE_DEVICE );
+    statistics.record( Generic_Error::BUS_ERROR );
+    statistics.record( Generic_Error::NONRESPONSIVE_DEVICE );
+
+    EXPECT_FALSE( stream.print( "{}", statistics ).is_error() );
+
+    EXPECT_EQ(
+        stream.string(),
+        "::picolibrary::Generic_Error::NONRESPONSIVE_DEVICE (5): 2\n"
+        "::picolibrary::Generic_Error::BUS_ERROR (8): 1\n"
+        "dropped: 0\n" );
+}
+
+/**
+ * \brief Execute the picolibrary::Error_Statistics unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
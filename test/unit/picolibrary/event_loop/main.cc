@@ -0,0 +1,292 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Event_Loop unit test program.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/event_loop.h"
+#include "picolibrary/testing/unit/random.h"
+
+namespace {
+
+using ::picolibrary::Event_Loop;
+using ::picolibrary::Event_Loop_Task;
+using ::picolibrary::Testing::Unit::random;
+
+/**
+ * \brief Event loop.
+ */
+using Loop = Event_Loop<std::uint16_t>;
+
+/**
+ * \brief Task that records when it is run.
+ */
+class Task : public Event_Loop_Task<std::uint16_t> {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] id The task's ID.
+     * \param[in] log The log to record the task's ID in when the task is run.
+     */
+    Task( int id, std::vector<int> & log ) noexcept : m_id{ id }, m_log{ &log }
+    {
+    }
+
+    /**
+     * \brief The number of remaining times the task should repost itself when run.
+     */
+    int reposts{};
+
+    /**
+     * \brief The event loop the task reposts itself to.
+     */
+    Loop * loop{};
+
+    /**
+     * \brief The task's readiness.
+     */
+    bool is_ready{};
+
+    /**
+     * \copydoc picolibrary::Event_Loop_Task::run()
+     */
+    void run() noexcept override
+    {
+        m_log->push_back( m_id );
+
+        if ( reposts ) {
+            --reposts;
+
+            loop->post( *this );
+        } // if
+    }
+
+    /**
+     * \copydoc picolibrary::Event_Loop_Task::ready()
+     */
+    auto ready() noexcept -> bool override
+    {
+        return is_ready;
+    }
+
+  private:
+    /**
+     * \brief The task's ID.
+     */
+    int m_id;
+
+    /**
+     * \brief The log to record the task's ID in when the task is run.
+     */
+    std::vector<int> * m_log;
+};
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Event_Loop::post() and picolibrary::Event_Loop::poll() work
+ *        properly.
+ */
+TEST( post, worksProperly )
+{
+    auto log  = std::vector<int>{};
+    auto loop = Loop{};
+    auto a    = Task{ 0, log };
+    auto b    = Task{ 1, log };
+
+    EXPECT_TRUE( loop.idle() );
+    EXPECT_FALSE( loop.poll( random<std::uint16_t>() ) );
+
+    loop.post( a );
+    loop.post( b );
+    loop.post( a );
+
+    EXPECT_FALSE( loop.idle() );
+    EXPECT_TRUE( a.posted() );
+    EXPECT_TRUE( b.posted() );
+
+    EXPECT_TRUE( loop.poll( random<std::uint16_t>() ) );
+
+    EXPECT_EQ( log, ( std::vector<int>{ 0, 1 } ) );
+    EXPECT_TRUE( loop.idle() );
+    EXPECT_FALSE( a.posted() );
+    EXPECT_FALSE( b.posted() );
+}
+
+/**
+ * \brief Verify tasks posted while an iteration's tasks are being run are run during
+ *        the next iteration.
+ */
+TEST( post, repostedTasksRunNextIteration )
+{
+    auto log  = std::vector<int>{};
+    auto loop = Loop{};
+    auto a    = Task{ 0, log };
+    auto b    = Task{ 1, log };
+
+    a.loop    = &loop;
+    a.reposts = 2;
+
+    loop.post( a );
+    loop.post( b );
+
+    EXPECT_TRUE( loop.poll( 0 ) );
+    EXPECT_EQ( log, ( std::vector<int>{ 0, 1 } ) );
+
+    EXPECT_TRUE( loop.poll( 0 ) );
+    EXPECT_EQ( log, ( std::vector<int>{ 0, 1, 0 } ) );
+
+    EXPECT_TRUE( loop.poll( 0 ) );
+    EXPECT_EQ( log, ( std::vector<int>{ 0, 1, 0, 0 } ) );
+
+    EXPECT_FALSE( loop.poll( 0 ) );
+    EXPECT_TRUE( loop.idle() );
+}
+
+/**
+ * \brief Verify picolibrary::Event_Loop::schedule() and picolibrary::Event_Loop::cancel()
+ *        work properly.
+ */
+TEST( schedule, worksProperly )
+{
+    auto log  = std::vector<int>{};
+    auto loop = Loop{};
+    auto a    = Task{ 0, log };
+    auto b    = Task{ 1, log };
+    auto c    = Task{ 2, log };
+
+    auto const now = random<std::uint16_t>();
+
+    EXPECT_FALSE( loop.scheduled() );
+
+    loop.schedule( b, static_cast<std::uint16_t>( now + 20 ) );
+    loop.schedule( a, static_cast<std::uint16_t>( now + 10 ) );
+    loop.schedule( c, static_cast<std::uint16_t>( now + 15 ) );
+    loop.cancel( c );
+
+    EXPECT_TRUE( loop.scheduled() );
+    EXPECT_EQ( loop.next_expiration(), static_cast<std::uint16_t>( now + 10 ) );
+
+    EXPECT_FALSE( loop.poll( static_cast<std::uint16_t>( now + 9 ) ) );
+    EXPECT_TRUE( log.empty() );
+
+    EXPECT_TRUE( loop.poll( static_cast<std::uint16_t>( now + 10 ) ) );
+    EXPECT_EQ( log, ( std::vector<int>{ 0 } ) );
+    EXPECT_EQ( loop.next_expiration(), static_cast<std::uint16_t>( now + 20 ) );
+
+    EXPECT_TRUE( loop.poll( static_cast<std::uint16_t>( now + 30 ) ) );
+    EXPECT_EQ( log, ( std::vector<int>{ 0, 1 } ) );
+    EXPECT_FALSE( loop.scheduled() );
+}
+
+/**
+ * \brief Verify picolibrary::Event_Loop::watch() and picolibrary::Event_Loop::unwatch()
+ *        work properly.
+ */
+TEST( watch, worksProperly )
+{
+    auto log  = std::vector<int>{};
+    auto loop = Loop{};
+    auto a    = Task{ 0, log };
+    auto b    = Task{ 1, log };
+
+    EXPECT_FALSE( loop.watching() );
+
+    loop.watch( a );
+    loop.watch( b );
+    loop.watch( a );
+
+    EXPECT_TRUE( loop.watching() );
+    EXPECT_TRUE( a.watched() );
+
+    EXPECT_FALSE( loop.poll( 0 ) );
+
+    b.is_ready = true;
+
+    EXPECT_TRUE( loop.poll( 0 ) );
+    EXPECT_TRUE( loop.poll( 0 ) );
+    EXPECT_EQ( log, ( std::vector<int>{ 1, 1 } ) );
+
+    loop.unwatch( b );
+    loop.unwatch( b );
+
+    EXPECT_FALSE( b.watched() );
+    EXPECT_FALSE( loop.poll( 0 ) );
+
+    a.is_ready = true;
+
+    EXPECT_TRUE( loop.poll( 0 ) );
+    EXPECT_EQ( log, ( std::vector<int>{ 1, 1, 0 } ) );
+
+    loop.unwatch( a );
+
+    EXPECT_FALSE( loop.watching() );
+}
+
+/**
+ * \brief Verify picolibrary::Event_Loop::run() and picolibrary::Event_Loop::stop() work
+ *        properly.
+ */
+TEST( run, worksProperly )
+{
+    auto log  = std::vector<int>{};
+    auto loop = Loop{};
+    auto a    = Task{ 0, log };
+
+    auto now   = std::uint16_t{};
+    auto idles = 0;
+
+    loop.schedule( a, 5 );
+
+    loop.run(
+        [ &now ]() noexcept { return now; },
+        [ & ]() noexcept {
+            ++idles;
+
+            if ( log.empty() ) {
+                now = loop.next_expiration();
+            } else {
+                loop.stop();
+            } // else
+        } );
+
+    EXPECT_EQ( log, ( std::vector<int>{ 0 } ) );
+    EXPECT_EQ( idles, 2 );
+}
+
+/**
+ * \brief Execute the picolibrary::Event_Loop unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,191 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Fixed_Capacity_String unit test program.
+ */
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/fixed_capacity_string.h"
+#include "picolibrary/testing/unit/random.h"
+#include "picolibrary/testing/unit/stream.h"
+
+namespace {
+
+using ::picolibrary::Fixed_Capacity_String;
+using ::picolibrary::Testing::Unit::Output_String_Stream;
+using ::picolibrary::Testing::Unit::random;
+using ::picolibrary::Testing::Unit::random_container;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_String is trivially copyable.
+ */
+TEST( triviallyCopyable, worksProperly )
+{
+    EXPECT_TRUE( std::is_trivially_copyable_v<Fixed_Capacity_String<16>> );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_String::Fixed_Capacity_String() works
+ *        properly.
+ */
+TEST( constructorDefault, worksProperly )
+{
+    constexpr auto string = Fixed_Capacity_String<16>{};
+
+    EXPECT_TRUE( string.empty() );
+    EXPECT_EQ( string.size(), 0 );
+    EXPECT_EQ( string.max_size(), 16 );
+    EXPECT_STREQ( string.c_str(), "" );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_String::Fixed_Capacity_String( char const *
+ *        ) works properly.
+ */
+TEST( constructorString, worksProperly )
+{
+    auto const expected = random_container<std::string>( random<std::uint_fast8_t>( 0, 32 ) );
+
+    auto const string = Fixed_Capacity_String<32>{ expected.c_str() };
+
+    EXPECT_EQ( string.size(), expected.size() );
+    EXPECT_STREQ( string.c_str(), expected.c_str() );
+    EXPECT_TRUE( string == expected.c_str() );
+
+    auto reversed = std::string{};
+    for ( auto character = string.rbegin(); character != string.rend(); ++character ) {
+        reversed.push_back( *character );
+    } // for
+
+    EXPECT_EQ( reversed, std::string( expected.rbegin(), expected.rend() ) );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_String modifiers work properly.
+ */
+TEST( modifiers, worksProperly )
+{
+    auto string = Fixed_Capacity_String<8>{ "abc" };
+
+    string += 'd';
+    string += "ef";
+
+    EXPECT_TRUE( string == "abcdef" );
+    EXPECT_FALSE( string.full() );
+
+    string.pop_back();
+    string.push_back( 'g' );
+    string.push_back( 'h' );
+
+    EXPECT_TRUE( string == "abcdegh" );
+
+    string.push_back( 'i' );
+
+    EXPECT_TRUE( string.full() );
+
+    string.resize( 2 );
+
+    EXPECT_TRUE( string == "ab" );
+    EXPECT_TRUE( string != "abc" );
+    EXPECT_TRUE( string != "a" );
+
+    string.resize( 4, 'z' );
+
+    EXPECT_TRUE( string == ( Fixed_Capacity_String<4>{ "abzz" } ) );
+
+    string.clear();
+
+    EXPECT_TRUE( string.empty() );
+    EXPECT_STREQ( string.c_str(), "" );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_String comparison with a C string stops at the
+ *        C string's null terminator.
+ */
+TEST( equalityOperatorString, embeddedNull )
+{
+    auto string = Fixed_Capacity_String<4>{ "a" };
+    string.push_back( '\0' );
+    string.push_back( 'b' );
+
+    EXPECT_FALSE( string == "a" );
+    EXPECT_FALSE( "a" == string );
+    EXPECT_TRUE( string != "a" );
+    EXPECT_FALSE( string == "" );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_String comparison with another
+ *        picolibrary::Fixed_Capacity_String compares embedded null characters.
+ */
+TEST( equalityOperatorFixedCapacityString, embeddedNull )
+{
+    auto string = Fixed_Capacity_String<4>{ "a" };
+    string.resize( 3 );
+
+    auto const copy = string;
+
+    EXPECT_TRUE( copy == string );
+    EXPECT_FALSE( copy != string );
+
+    auto other = Fixed_Capacity_String<8>{ "a" };
+    other.resize( 2 );
+    other.push_back( 'b' );
+
+    EXPECT_FALSE( other == string );
+    EXPECT_TRUE( other != string );
+}
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Fixed_Capacity_String> works
+ *        properly.
+ */
+TEST( outputFormatterFixedCapacityString, worksProperly )
+{
+    auto stream = Output_String_Stream{};
+
+    auto const expected = random_container<std::string>( random<std::uint_fast8_t>( 0, 32 ) );
+
+    EXPECT_FALSE( stream.print( "{}", Fixed_Capacity_String<32>{ expected.c_str() } ).is_error() );
+
+    EXPECT_EQ( stream.string(), expected );
+}
+
+/**
+ * \brief Execute the picolibrary::Fixed_Capacity_String unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
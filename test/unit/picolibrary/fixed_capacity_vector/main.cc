@@ -0,0 +1,251 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Fixed_Capacity_Vector unit test program.
+ */
+
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/fixed_capacity_vector.h"
+#include "picolibrary/testing/unit/random.h"
+
+namespace {
+
+using ::picolibrary::Fixed_Capacity_Vector;
+using ::picolibrary::Testing::Unit::random;
+using ::picolibrary::Testing::Unit::random_container;
+using ::testing::ElementsAre;
+using ::testing::ElementsAreArray;
+using ::testing::IsEmpty;
+
+template<typename T, std::size_t N>
+auto elements( Fixed_Capacity_Vector<T, N> const & vector )
+{
+    return std::vector<T>( vector.begin(), vector.end() );
+}
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_Vector is trivially copyable if its element
+ *        type is trivially copyable.
+ */
+TEST( triviallyCopyable, worksProperly )
+{
+    EXPECT_TRUE( ( std::is_trivially_copyable_v<Fixed_Capacity_Vector<std::uint8_t, 8>> ) );
+    EXPECT_FALSE( ( std::is_trivially_copyable_v<Fixed_Capacity_Vector<std::shared_ptr<int>, 8>> ) );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_Vector::Fixed_Capacity_Vector() works
+ *        properly.
+ */
+TEST( constructorDefault, worksProperly )
+{
+    auto const vector = Fixed_Capacity_Vector<std::uint8_t, 8>{};
+
+    EXPECT_TRUE( vector.empty() );
+    EXPECT_FALSE( vector.full() );
+    EXPECT_EQ( vector.size(), 0 );
+    EXPECT_EQ( vector.max_size(), 8 );
+    EXPECT_EQ( vector.capacity(), 8 );
+    EXPECT_EQ( vector.begin(), vector.end() );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_Vector::Fixed_Capacity_Vector( Size,
+ *        Const_Reference ) works properly.
+ */
+TEST( constructorSizeValue, worksProperly )
+{
+    auto const size  = random<std::uint_fast8_t>( 0, 16 );
+    auto const value = random<std::uint16_t>();
+
+    auto const vector = Fixed_Capacity_Vector<std::uint16_t, 16>( size, value );
+
+    EXPECT_EQ( vector.size(), size );
+    EXPECT_EQ( elements( vector ), std::vector<std::uint16_t>( size, value ) );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_Vector::Fixed_Capacity_Vector(
+ *        std::initializer_list<Value> ) works properly.
+ */
+TEST( constructorInitializerList, worksProperly )
+{
+    auto const vector = Fixed_Capacity_Vector<std::uint8_t, 8>{ 0x3C, 0xA5, 0x0F };
+
+    EXPECT_EQ( vector.size(), 3 );
+    EXPECT_EQ( vector.front(), 0x3C );
+    EXPECT_EQ( vector.back(), 0x0F );
+    EXPECT_THAT( elements( vector ), ElementsAre( 0x3C, 0xA5, 0x0F ) );
+
+    auto reversed = std::vector<std::uint8_t>{};
+    for ( auto element = vector.rbegin(); element != vector.rend(); ++element ) {
+        reversed.push_back( *element );
+    } // for
+
+    EXPECT_THAT( reversed, ElementsAre( 0x0F, 0xA5, 0x3C ) );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_Vector copy and move construction and
+ *        assignment work properly for non-trivially copyable element types.
+ */
+TEST( copyMove, worksProperly )
+{
+    auto const element = std::make_shared<int>( random<int>() );
+
+    auto vector = Fixed_Capacity_Vector<std::shared_ptr<int>, 4>{ element, element };
+
+    EXPECT_EQ( element.use_count(), 3 );
+
+    {
+        auto copy = vector;
+
+        EXPECT_EQ( element.use_count(), 5 );
+        EXPECT_EQ( copy, vector );
+
+        auto moved = std::move( copy );
+
+        EXPECT_EQ( element.use_count(), 5 );
+        EXPECT_EQ( moved, vector );
+
+        moved = vector;
+
+        EXPECT_EQ( element.use_count(), 5 );
+
+        moved.pop_back();
+
+        EXPECT_EQ( element.use_count(), 4 );
+        EXPECT_NE( moved, vector );
+    }
+
+    EXPECT_EQ( element.use_count(), 3 );
+
+    vector.clear();
+
+    EXPECT_EQ( element.use_count(), 1 );
+    EXPECT_TRUE( vector.empty() );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_Vector copy construction, move construction,
+ *        and picolibrary::Fixed_Capacity_Vector::emplace_back() do not select an element
+ *        type's std::initializer_list constructor.
+ */
+TEST( copyMove, initializerListConstructibleElement )
+{
+    auto vector = Fixed_Capacity_Vector<std::vector<std::any>, 2>{};
+
+    vector.emplace_back( 3, std::any{} );
+
+    EXPECT_EQ( vector[ 0 ].size(), 3 );
+
+    auto const copy = vector;
+
+    EXPECT_EQ( copy[ 0 ].size(), 3 );
+
+    auto const moved = std::move( vector );
+
+    EXPECT_EQ( moved[ 0 ].size(), 3 );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_Vector::push_back() and
+ *        picolibrary::Fixed_Capacity_Vector::pop_back() work properly.
+ */
+TEST( pushBackPopBack, worksProperly )
+{
+    auto const values = random_container<std::vector<std::uint32_t>>( random<std::uint_fast8_t>( 1, 32 ) );
+
+    auto vector = Fixed_Capacity_Vector<std::uint32_t, 32>{};
+
+    for ( auto const value : values ) {
+        vector.push_back( value );
+    } // for
+
+    EXPECT_EQ( vector.full(), values.size() == 32 );
+    EXPECT_THAT( elements( vector ), ElementsAreArray( values ) );
+
+    vector.pop_back();
+
+    EXPECT_THAT( elements( vector ), ElementsAreArray( values.begin(), values.end() - 1 ) );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_Vector::emplace_back() works properly.
+ */
+TEST( emplaceBack, worksProperly )
+{
+    auto const value = random<int>();
+
+    auto vector = Fixed_Capacity_Vector<std::shared_ptr<int>, 4>{};
+
+    auto & element = vector.emplace_back( std::make_shared<int>( value ) );
+
+    EXPECT_EQ( &element, &vector.back() );
+    EXPECT_EQ( *vector[ 0 ], value );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_Vector::resize() works properly.
+ */
+TEST( resize, worksProperly )
+{
+    auto vector = Fixed_Capacity_Vector<std::uint8_t, 8>{ 0x12, 0x34, 0x56 };
+
+    vector.resize( 5 );
+
+    EXPECT_THAT( elements( vector ), ElementsAre( 0x12, 0x34, 0x56, 0x00, 0x00 ) );
+
+    vector.resize( 2 );
+
+    EXPECT_THAT( elements( vector ), ElementsAre( 0x12, 0x34 ) );
+
+    vector.resize( 4, 0xFF );
+
+    EXPECT_THAT( elements( vector ), ElementsAre( 0x12, 0x34, 0xFF, 0xFF ) );
+
+    vector.clear();
+
+    EXPECT_THAT( elements( vector ), IsEmpty() );
+}
+
+/**
+ * \brief Execute the picolibrary::Fixed_Capacity_Vector unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,180 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Fixed_Object_Pool unit test program.
+ */
+
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/fixed_object_pool.h"
+#include "picolibrary/testing/unit/random.h"
+
+namespace {
+
+using ::picolibrary::Fixed_Object_Pool;
+using ::picolibrary::Testing::Unit::random;
+
+/**
+ * \brief Verify picolibrary::Fixed_Object_Pool can be constant initialized.
+ */
+[[maybe_unused]] constexpr auto CONSTANT_INITIALIZED_POOL = Fixed_Object_Pool<std::uint32_t, 4>{};
+
+/**
+ * \brief A type whose std::initializer_list constructor would be selected if it were
+ *        list-initialized.
+ */
+struct Initializer_List_Constructible {
+    /**
+     * \brief The std::initializer_list constructor was used.
+     */
+    bool list_initialized{};
+
+    /**
+     * \brief Constructor.
+     */
+    Initializer_List_Constructible( std::initializer_list<int> ) noexcept :
+        list_initialized{ true }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     */
+    Initializer_List_Constructible( int, int ) noexcept
+    {
+    }
+};
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Fixed_Object_Pool::allocate() works properly.
+ */
+TEST( allocate, worksProperly )
+{
+    auto pool = Fixed_Object_Pool<std::uint32_t, 4>{};
+
+    EXPECT_EQ( pool.capacity(), 4 );
+    EXPECT_EQ( pool.available(), 4 );
+
+    auto handles = std::vector<Fixed_Object_Pool<std::uint32_t, 4>::Handle>{};
+    auto values  = std::vector<std::uint32_t>{};
+    for ( auto i = 0; i < 4; ++i ) {
+        values.push_back( random<std::uint32_t>() );
+        handles.push_back( pool.allocate( values.back() ) );
+
+        EXPECT_TRUE( handles.back() );
+    } // for
+
+    EXPECT_EQ( pool.available(), 0 );
+    EXPECT_FALSE( pool.allocate() );
+
+    for ( auto i = 0; i < 4; ++i ) {
+        EXPECT_EQ( *handles[ i ], values[ i ] );
+    } // for
+
+    auto const address = handles[ 1 ].get();
+
+    handles[ 1 ].reset();
+
+    EXPECT_FALSE( handles[ 1 ] );
+    EXPECT_EQ( pool.available(), 1 );
+
+    auto handle = pool.allocate( std::uint32_t{ 0x12345678 } );
+
+    EXPECT_EQ( handle.get(), address );
+    EXPECT_EQ( *handle, 0x12345678 );
+    EXPECT_EQ( pool.available(), 0 );
+
+    handles.clear();
+
+    EXPECT_EQ( pool.available(), 3 );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Object_Pool::allocate() does not select the pooled
+ *        type's std::initializer_list constructor.
+ */
+TEST( allocate, initializerListConstructible )
+{
+    auto pool = Fixed_Object_Pool<Initializer_List_Constructible, 1>{};
+
+    auto const handle = pool.allocate( 1, 2 );
+
+    ASSERT_TRUE( handle );
+    EXPECT_FALSE( handle->list_initialized );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Object_Pool::Handle destroys the owned object, and
+ *        supports moves.
+ */
+TEST( handle, worksProperly )
+{
+    auto const object = std::make_shared<int>( random<int>() );
+
+    auto pool = Fixed_Object_Pool<std::shared_ptr<int>, 2>{};
+
+    {
+        auto handle = pool.allocate( object );
+
+        EXPECT_EQ( object.use_count(), 2 );
+        EXPECT_EQ( **handle, *object );
+        EXPECT_EQ( handle->get(), object.get() );
+
+        auto moved = std::move( handle );
+
+        EXPECT_FALSE( handle );
+        EXPECT_TRUE( moved );
+        EXPECT_EQ( object.use_count(), 2 );
+
+        handle = pool.allocate( object );
+
+        EXPECT_EQ( object.use_count(), 3 );
+
+        moved = std::move( handle );
+
+        EXPECT_EQ( object.use_count(), 2 );
+        EXPECT_EQ( pool.available(), 1 );
+    }
+
+    EXPECT_EQ( object.use_count(), 1 );
+    EXPECT_EQ( pool.available(), 2 );
+}
+
+/**
+ * \brief Execute the picolibrary::Fixed_Object_Pool unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,267 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+/**
+ * \file
+ * \brief picolibrary::Fixed_Size_Bitset unit test program.
+ */
+
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/fixed_size_bitset.h"
+#include "picolibrary/testing/unit/random.h"
+
+namespace {
+
+using ::picolibrary::Fixed_Size_Bitset;
+using ::picolibrary::Testing::Unit::random;
+using ::testing::ElementsAreArray;
+
+/**
+ * \brief Verify picolibrary::Fixed_Size_Bitset can be constant initialized.
+ */
+[[maybe_unused]] constexpr auto CONSTANT_INITIALIZED_BITSET = Fixed_Size_Bitset<8>{
+    std::uint8_t{ 0xA5 }
+};
+
+static_assert( CONSTANT_INITIALIZED_BITSET.count() == 4 );
+static_assert( CONSTANT_INITIALIZED_BITSET.to_integer<std::uint8_t>() == 0xA5 );
+static_assert( Fixed_Size_Bitset<16, std::uint8_t>{}.set().all() );
+static_assert( Fixed_Size_Bitset<16, std::uint8_t>{}.set().count() == 16 );
+
+/**
+ * \brief Bit count used to exercise bitsets that span multiple, partially used words.
+ */
+constexpr auto BITS = std::size_t{ 75 };
+
+/**
+ * \brief Bitset used to exercise bitsets that span multiple, partially used words.
+ */
+using Bitset = Fixed_Size_Bitset<BITS, std::uint8_t>;
+
+/**
+ * \brief Generate a pseudo-random bitset and its std::bitset equivalent.
+ *
+ * \param[out] bitset The generated bitset.
+ * \param[out] expected The std::bitset equivalent of the generated bitset.
+ */
+void random_bitset( Bitset & bitset, std::bitset<BITS> & expected )
+{
+    bitset.reset();
+    expected.reset();
+
+    for ( auto position = std::size_t{}; position < BITS; ++position ) {
+        auto const value = random<bool>();
+
+        bitset.set( position, value );
+        expected.set( position, value );
+    } // for
+}
+
+/**
+ * \brief Check if a bitset is equivalent to a std::bitset.
+ *
+ * \param[in] bitset The bitset to check.
+ * \param[in] expected The std::bitset the bitset is expected to be equivalent to.
+ *
+ * \return Success if the bitset is equivalent to the std::bitset.
+ * \return Failure if the bitset is not equivalent to the std::bitset.
+ */
+auto equivalent( Bitset const & bitset, std::bitset<BITS> const & expected )
+    -> ::testing::AssertionResult
+{
+    for ( auto position = std::size_t{}; position < BITS; ++position ) {
+        if ( bitset.test( position ) != expected.test( position ) ) {
+            return ::testing::AssertionFailure() << "bit " << position << " differs";
+        } // if
+    }     // for
+
+    if ( bitset.count() != expected.count() ) {
+        return ::testing::AssertionFailure() << "count differs";
+    } // if
+
+    return ::testing::AssertionSuccess();
+}
+
+/**
+ * \brief Get the positions of the set bits in a std::bitset.
+ *
+ * \param[in] expected The std::bitset.
+ *
+ * \return The positions of the set bits in the std::bitset.
+ */
+auto set_bits( std::bitset<BITS> const & expected )
+{
+    auto positions = std::vector<std::size_t>{};
+
+    for ( auto position = std::size_t{}; position < BITS; ++position ) {
+        if ( expected.test( position ) ) {
+            positions.push_back( position );
+        } // if
+    }     // for
+
+    return positions;
+}
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Fixed_Size_Bitset::Fixed_Size_Bitset() works properly.
+ */
+TEST( constructorDefault, worksProperly )
+{
+    auto const bitset = Bitset{};
+
+    EXPECT_EQ( bitset.size(), BITS );
+    EXPECT_TRUE( bitset.none() );
+    EXPECT_FALSE( bitset.any() );
+    EXPECT_FALSE( bitset.all() );
+    EXPECT_EQ( bitset.count(), 0 );
+    EXPECT_EQ( bitset.find_first(), BITS );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Size_Bitset::Fixed_Size_Bitset( Integer ) and
+ *        picolibrary::Fixed_Size_Bitset::to_integer() work properly with 8-bit register
+ *        masks.
+ */
+TEST( registerMaskInteroperability, worksProperly )
+{
+    auto const mask = random<std::uint8_t>();
+
+    auto const bitset = Fixed_Size_Bitset<8>{ mask };
+
+    EXPECT_EQ( bitset.to_integer<std::uint8_t>(), mask );
+    for ( auto bit = std::size_t{}; bit < 8; ++bit ) {
+        EXPECT_EQ( bitset[ bit ], ( ( mask >> bit ) & 0b1 ) != 0 );
+    } // for
+
+    auto const value = random<std::uint64_t>();
+
+    EXPECT_EQ( ( Bitset{ value }.to_integer<std::uint64_t>() ), value );
+    EXPECT_EQ(
+        ( Bitset{ value }.to_integer<std::uint8_t>() ),
+        static_cast<std::uint8_t>( value ) );
+    EXPECT_EQ(
+        ( Fixed_Size_Bitset<4>{ value }.to_integer<std::uint64_t>() ), value & 0xF );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Size_Bitset set, reset, and flip operations work
+ *        properly.
+ */
+TEST( setResetFlip, worksProperly )
+{
+    auto bitset   = Bitset{};
+    auto expected = std::bitset<BITS>{};
+    random_bitset( bitset, expected );
+
+    ASSERT_TRUE( equivalent( bitset, expected ) );
+
+    auto const position = random<std::uint8_t>( 0, BITS - 1 );
+
+    bitset.flip( position );
+    expected.flip( position );
+    EXPECT_TRUE( equivalent( bitset, expected ) );
+
+    bitset.reset( position );
+    expected.reset( position );
+    EXPECT_TRUE( equivalent( bitset, expected ) );
+
+    bitset.set( position );
+    expected.set( position );
+    EXPECT_TRUE( equivalent( bitset, expected ) );
+
+    bitset.flip();
+    expected.flip();
+    EXPECT_TRUE( equivalent( bitset, expected ) );
+
+    bitset.set();
+    EXPECT_TRUE( bitset.all() );
+    EXPECT_EQ( bitset.count(), BITS );
+    EXPECT_EQ( ( ~bitset ).count(), 0 );
+
+    bitset.reset();
+    EXPECT_TRUE( bitset.none() );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Size_Bitset bulk logic operators work properly.
+ */
+TEST( logicOperators, worksProperly )
+{
+    auto lhs          = Bitset{};
+    auto expected_lhs = std::bitset<BITS>{};
+    random_bitset( lhs, expected_lhs );
+
+    auto rhs          = Bitset{};
+    auto expected_rhs = std::bitset<BITS>{};
+    random_bitset( rhs, expected_rhs );
+
+    EXPECT_TRUE( equivalent( lhs & rhs, expected_lhs & expected_rhs ) );
+    EXPECT_TRUE( equivalent( lhs | rhs, expected_lhs | expected_rhs ) );
+    EXPECT_TRUE( equivalent( lhs ^ rhs, expected_lhs ^ expected_rhs ) );
+    EXPECT_TRUE( equivalent( ~lhs, ~expected_lhs ) );
+
+    EXPECT_TRUE( lhs == lhs );
+    EXPECT_FALSE( lhs != lhs );
+    EXPECT_EQ( lhs == rhs, expected_lhs == expected_rhs );
+    EXPECT_EQ( lhs != rhs, expected_lhs != expected_rhs );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Size_Bitset set bit iteration works properly.
+ */
+TEST( setBits, worksProperly )
+{
+    auto bitset   = Bitset{};
+    auto expected = std::bitset<BITS>{};
+    random_bitset( bitset, expected );
+
+    auto const positions = set_bits( expected );
+
+    auto iterated = std::vector<std::size_t>{};
+    for ( auto const position : bitset.set_bits() ) {
+        iterated.push_back( position );
+    } // for
+    EXPECT_THAT( iterated, ElementsAreArray( positions ) );
+
+    auto found = std::vector<std::size_t>{};
+    for ( auto position = bitset.find_first(); position != BITS;
+          position      = bitset.find_next( position ) ) {
+        found.push_back( position );
+    } // for
+    EXPECT_THAT( found, ElementsAreArray( positions ) );
+}
+
+/**
+ * \brief Execute the picolibrary::Fixed_Size_Bitset unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -29,6 +29,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "picolibrary/error.h"
+#include "picolibrary/error_statistics.h"
 #include "picolibrary/i2c.h"
 #include "picolibrary/result.h"
 #include "picolibrary/testing/unit/error.h"
@@ -39,6 +40,7 @@
 namespace {
 
 using ::picolibrary::Error_Code;
+using ::picolibrary::Error_Statistics;
 using ::picolibrary::Generic_Error;
 using ::picolibrary::Result;
 using ::picolibrary::Void;
@@ -263,10 +265,17 @@ TEST( pingOperation, nonresponsiveDeviceError )
     EXPECT_CALL( controller, address( _, _ ) ).WillOnce( Return( Generic_Error::NONRESPONSIVE_DEVICE ) );
     EXPECT_CALL( controller, stop() ).WillOnce( Return( Result<Void, Error_Code>{} ) );
 
+    auto const count = Error_Statistics::instance().count( nonresponsive_device_error );
+
     auto const result = device.ping( random<Operation>() );
 
     EXPECT_TRUE( result.is_error() );
     EXPECT_EQ( result.error(), nonresponsive_device_error );
+#ifdef PICOLIBRARY_ENABLE_ERROR_STATISTICS
+    EXPECT_EQ( Error_Statistics::instance().count( nonresponsive_device_error ), count + 1 );
+#else  // PICOLIBRARY_ENABLE_ERROR_STATISTICS
+    EXPECT_EQ( Error_Statistics::instance().count( nonresponsive_device_error ), count );
+#endif // PICOLIBRARY_ENABLE_ERROR_STATISTICS
 }
 
 /**
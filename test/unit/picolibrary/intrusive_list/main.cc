@@ -0,0 +1,232 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+/**
+ * \file
+ * \brief picolibrary intrusive list unit test program.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/intrusive_list.h"
+#include "picolibrary/testing/unit/random.h"
+
+namespace {
+
+using ::picolibrary::Intrusive_Forward_List;
+using ::picolibrary::Intrusive_Forward_List_Node;
+using ::picolibrary::Intrusive_List;
+using ::picolibrary::Intrusive_List_Node;
+using ::picolibrary::Testing::Unit::random;
+using ::testing::ElementsAreArray;
+
+/**
+ * \brief Intrusive singly linked list object.
+ */
+struct Forward_Object : public Intrusive_Forward_List_Node {
+    /**
+     * \brief The object's ID.
+     */
+    std::uint32_t id{};
+};
+
+/**
+ * \brief Intrusive doubly linked list object.
+ */
+struct Object : public Intrusive_List_Node {
+    /**
+     * \brief The object's ID.
+     */
+    std::uint32_t id{};
+};
+
+/**
+ * \brief Get the IDs of the objects in a list.
+ *
+ * \tparam List The list type.
+ *
+ * \param[in] list The list.
+ *
+ * \return The IDs of the objects in the list.
+ */
+template<typename List>
+auto ids( List const & list )
+{
+    auto ids = std::vector<std::uint32_t>{};
+
+    for ( auto const & object : list ) {
+        ids.push_back( object.id );
+    } // for
+
+    return ids;
+}
+
+/**
+ * \brief Get the IDs of the objects in a list, in reverse order.
+ *
+ * \param[in] list The list.
+ *
+ * \return The IDs of the objects in the list, in reverse order.
+ */
+auto reverse_ids( Intrusive_List<Object> const & list )
+{
+    auto ids = std::vector<std::uint32_t>{};
+
+    for ( auto iterator = list.end(); iterator != list.begin(); ) {
+        ids.push_back( ( --iterator )->id );
+    } // for
+
+    return ids;
+}
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Intrusive_Forward_List works properly.
+ */
+TEST( intrusiveForwardList, worksProperly )
+{
+    auto objects = std::vector<Forward_Object>( random<std::uint8_t>( 1, 32 ) );
+    for ( auto i = std::size_t{}; i < objects.size(); ++i ) {
+        objects[ i ].id = static_cast<std::uint32_t>( i );
+    } // for
+
+    auto list     = Intrusive_Forward_List<Forward_Object>{};
+    auto expected = std::deque<std::uint32_t>{};
+
+    EXPECT_TRUE( list.empty() );
+    EXPECT_EQ( list.size(), 0 );
+
+    for ( auto & object : objects ) {
+        if ( random<bool>() ) {
+            list.push_front( object );
+            expected.push_front( object.id );
+        } else {
+            list.push_back( object );
+            expected.push_back( object.id );
+        } // else
+
+        ASSERT_EQ( list.front().id, expected.front() );
+        ASSERT_EQ( list.back().id, expected.back() );
+    } // for
+
+    EXPECT_FALSE( list.empty() );
+    EXPECT_EQ( list.size(), expected.size() );
+    EXPECT_THAT( ids( list ), ElementsAreArray( expected ) );
+
+    while ( not expected.empty() ) {
+        ASSERT_EQ( list.pop_front().id, expected.front() );
+
+        expected.pop_front();
+    } // while
+
+    EXPECT_TRUE( list.empty() );
+
+    list.push_back( objects.front() );
+    EXPECT_EQ( &list.front(), &objects.front() );
+    EXPECT_EQ( &list.back(), &objects.front() );
+
+    list.clear();
+    EXPECT_TRUE( list.empty() );
+    EXPECT_EQ( list.size(), 0 );
+}
+
+/**
+ * \brief Verify picolibrary::Intrusive_List works properly.
+ */
+TEST( intrusiveList, worksProperly )
+{
+    auto objects = std::vector<Object>( random<std::uint8_t>( 2, 32 ) );
+    for ( auto i = std::size_t{}; i < objects.size(); ++i ) {
+        objects[ i ].id = static_cast<std::uint32_t>( i );
+    } // for
+
+    auto list     = Intrusive_List<Object>{};
+    auto expected = std::deque<std::uint32_t>{};
+
+    EXPECT_TRUE( list.empty() );
+    EXPECT_EQ( list.size(), 0 );
+    EXPECT_TRUE( list.begin() == list.end() );
+
+    for ( auto & object : objects ) {
+        EXPECT_FALSE( object.linked() );
+
+        if ( random<bool>() ) {
+            list.push_front( object );
+            expected.push_front( object.id );
+        } else {
+            list.push_back( object );
+            expected.push_back( object.id );
+        } // else
+
+        EXPECT_TRUE( object.linked() );
+    } // for
+
+    EXPECT_EQ( list.size(), expected.size() );
+    EXPECT_THAT( ids( list ), ElementsAreArray( expected ) );
+    EXPECT_THAT(
+        reverse_ids( list ), ElementsAreArray( expected.rbegin(), expected.rend() ) );
+
+    auto & erased = objects[ random<std::uint8_t>( 0, objects.size() - 1 ) ];
+    list.erase( erased );
+    expected.erase( std::find( expected.begin(), expected.end(), erased.id ) );
+
+    EXPECT_FALSE( erased.linked() );
+    EXPECT_EQ( list.size(), expected.size() );
+    EXPECT_THAT( ids( list ), ElementsAreArray( expected ) );
+
+    auto position = list.begin();
+    ++position;
+    EXPECT_EQ( &*list.insert( position, erased ), &erased );
+    expected.insert( expected.begin() + 1, erased.id );
+
+    EXPECT_THAT( ids( list ), ElementsAreArray( expected ) );
+
+    EXPECT_EQ( list.pop_back().id, expected.back() );
+    expected.pop_back();
+    EXPECT_EQ( list.pop_front().id, expected.front() );
+    expected.pop_front();
+
+    EXPECT_THAT( ids( list ), ElementsAreArray( expected ) );
+
+    list.clear();
+
+    EXPECT_TRUE( list.empty() );
+    EXPECT_EQ( list.size(), 0 );
+    for ( auto const & object : objects ) {
+        EXPECT_FALSE( object.linked() );
+    } // for
+}
+
+/**
+ * \brief Execute the picolibrary intrusive list unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
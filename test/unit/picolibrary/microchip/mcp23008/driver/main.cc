@@ -30,6 +30,7 @@
 #include "picolibrary/i2c.h"
 #include "picolibrary/microchip/mcp23008.h"
 #include "picolibrary/result.h"
+#include "picolibrary/testing/fake/i2c.h"
 #include "picolibrary/testing/unit/error.h"
 #include "picolibrary/testing/unit/i2c.h"
 #include "picolibrary/testing/unit/microchip/mcp23008.h"
@@ -47,6 +48,9 @@ using ::picolibrary::Microchip::MCP23008::Interrupt_Mode;
 using ::picolibrary::Microchip::MCP23008::make_driver;
 using ::picolibrary::Microchip::MCP23008::SDA_Slew_Rate_Control;
 using ::picolibrary::Microchip::MCP23008::Sequential_Operation_Mode;
+using ::picolibrary::Testing::Fake::I2C::Fake_Controller;
+using ::picolibrary::Testing::Fake::I2C::Timed_Fake_Controller;
+using ::picolibrary::Testing::Fake::I2C::Timing;
 using ::picolibrary::Testing::Unit::Mock_Error;
 using ::picolibrary::Testing::Unit::random;
 using ::picolibrary::Testing::Unit::I2C::Mock_Controller;
@@ -1432,6 +1436,132 @@ TEST( togglePushPullOutput, worksProperly )
     EXPECT_FALSE( mcp23008.toggle_push_pull_output( mask ).is_error() );
 }
 
+/**
+ * \brief Verify picolibrary::Microchip::MCP23008::Driver works properly with the default
+ *        register cache and I2C device implementations, and a fake register file I2C
+ *        controller.
+ */
+TEST( fakeController, worksProperly )
+{
+    auto controller = Fake_Controller{ random<Address>(
+        ::picolibrary::Microchip::MCP23008::Address::min(),
+        ::picolibrary::Microchip::MCP23008::Address::max() ) };
+    auto const nonresponsive_device_error = random<Mock_Error>();
+
+    auto mcp23008 = ::picolibrary::Microchip::MCP23008::Driver<std::function<Result<Void, Error_Code>()>, Fake_Controller>{
+        []() -> Result<Void, Error_Code> { return {}; },
+        controller,
+        controller.device_address(),
+        nonresponsive_device_error
+    };
+
+    for ( auto i = 0; i < 1000; ++i ) {
+        auto const transactions = controller.transactions();
+        auto const mask         = random<std::uint8_t>();
+
+        switch ( random<std::uint_fast8_t>( 0, 4 ) ) {
+            case 0:
+                ASSERT_FALSE( mcp23008.write_iodir( mask ).is_error() );
+                ASSERT_EQ( controller.registers()[ 0x00 ], mask );
+                ASSERT_EQ( mcp23008.iodir(), mask );
+                ASSERT_EQ( controller.transactions(), transactions + 1 );
+                break;
+            case 1:
+                ASSERT_FALSE( mcp23008.write_gpio( mask ).is_error() );
+                ASSERT_EQ( controller.registers()[ 0x09 ], mask );
+                ASSERT_EQ( controller.transactions(), transactions + 1 );
+                break;
+            case 2: {
+                auto const gpio = mcp23008.gpio();
+
+                ASSERT_FALSE( mcp23008.toggle_push_pull_output( mask ).is_error() );
+                ASSERT_EQ( controller.registers()[ 0x09 ], gpio ^ mask );
+                ASSERT_EQ( controller.transactions(), transactions + 1 );
+            } break;
+            case 3: {
+                controller.registers()[ 0x09 ] = mask;
+
+                auto const result = mcp23008.read_gpio();
+
+                ASSERT_FALSE( result.is_error() );
+                ASSERT_EQ( result.value(), mask );
+                ASSERT_EQ( controller.transactions(), transactions + 2 );
+            } break;
+            default: {
+                controller.fail( Generic_Error::BUS_ERROR );
+
+                auto const result = mcp23008.write_gppu( mask );
+
+                ASSERT_TRUE( result.is_error() );
+                ASSERT_EQ( result.error(), Generic_Error::BUS_ERROR );
+            } break;
+        } // switch
+    }     // for
+
+    auto nonresponsive_mcp23008 = ::picolibrary::Microchip::MCP23008::Driver<std::function<Result<Void, Error_Code>()>, Fake_Controller>{
+        []() -> Result<Void, Error_Code> { return {}; },
+        controller,
+        Address{ Address::NUMERIC,
+                 static_cast<std::uint_fast8_t>( controller.device_address().numeric() ^ 0b1 ) },
+        nonresponsive_device_error
+    };
+
+    auto const result = nonresponsive_mcp23008.read_gpio();
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), nonresponsive_device_error );
+}
+
+/**
+ * \brief Verify the bus timing estimates for picolibrary::Microchip::MCP23008::Driver
+ *        register accesses.
+ */
+TEST( timedFakeController, worksProperly )
+{
+    struct {
+        Timing             timing;
+        bool               read;
+        std::uint_fast32_t transactions;
+        std::uint_fast32_t bytes;
+        std::uint_fast64_t cycles;
+        std::uint_fast64_t nanoseconds;
+    } const test_cases[]{
+        // clang-format off
+
+        { Timing{},                      false, 1, 3, 29, 290'000 },
+        { Timing{},                      true,  2, 4, 39, 390'000 },
+        { Timing{ 400'000, 1, 1, 1, 2 }, false, 1, 3, 35,  87'500 },
+        { Timing{ 400'000, 2, 2, 2, 0 }, true,  2, 4, 42, 105'000 },
+
+        // clang-format on
+    };
+
+    for ( auto const test_case : test_cases ) {
+        auto controller = Timed_Fake_Controller{ test_case.timing,
+                                                 ::picolibrary::Microchip::MCP23008::Address::min() };
+
+        auto mcp23008 = ::picolibrary::Microchip::MCP23008::Driver<std::function<Result<Void, Error_Code>()>, Timed_Fake_Controller>{
+            []() -> Result<Void, Error_Code> { return {}; },
+            controller,
+            controller.device_address(),
+            random<Mock_Error>()
+        };
+
+        if ( test_case.read ) {
+            EXPECT_FALSE( mcp23008.read_gpio().is_error() );
+        } else {
+            EXPECT_FALSE( mcp23008.write_gpio( random<std::uint8_t>() ).is_error() );
+        } // else
+
+        EXPECT_EQ( controller.bus_timing().transactions(), test_case.transactions );
+        EXPECT_EQ( controller.bus_timing().bytes(), test_case.bytes );
+        EXPECT_EQ( controller.bus_timing().cycles(), test_case.cycles );
+        EXPECT_EQ( controller.bus_timing().nanoseconds(), test_case.nanoseconds );
+        EXPECT_EQ(
+            controller.bus_timing().microseconds(), ( test_case.nanoseconds + 999 ) / 1'000 );
+    } // for
+}
+
 /**
  * \brief Execute the picolibrary::Microchip::MCP23008::Driver unit tests.
  *
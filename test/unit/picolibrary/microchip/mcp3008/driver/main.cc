@@ -29,6 +29,7 @@
 #include "picolibrary/error.h"
 #include "picolibrary/microchip/mcp3008.h"
 #include "picolibrary/result.h"
+#include "picolibrary/testing/fake/spi.h"
 #include "picolibrary/testing/unit/error.h"
 #include "picolibrary/testing/unit/microchip/mcp3008.h"
 #include "picolibrary/testing/unit/random.h"
@@ -44,6 +45,10 @@ using ::picolibrary::Microchip::MCP3008::Channel;
 using ::picolibrary::Microchip::MCP3008::Channel_Pair;
 using ::picolibrary::Microchip::MCP3008::Input;
 using ::picolibrary::Microchip::MCP3008::Sample;
+using ::picolibrary::Testing::Fake::SPI::Fake_Controller;
+using ::picolibrary::Testing::Fake::SPI::Fake_Device_Selector;
+using ::picolibrary::Testing::Fake::SPI::Timed_Fake_Controller;
+using ::picolibrary::Testing::Fake::SPI::Timing;
 using ::picolibrary::Testing::Unit::Mock_Error;
 using ::picolibrary::Testing::Unit::random;
 using ::picolibrary::Testing::Unit::SPI::Mock_Controller;
@@ -76,6 +81,40 @@ TEST( sample, configurationError )
     EXPECT_EQ( result.error(), error );
 }
 
+/**
+ * \brief Verify the bus timing estimates for picolibrary::Microchip::MCP3008::Driver::sample().
+ */
+TEST( sample, timedFakeController )
+{
+    struct {
+        Timing             timing;
+        std::uint_fast64_t cycles;
+        std::uint_fast64_t nanoseconds;
+    } const test_cases[]{
+        // clang-format off
+
+        { Timing{},                  24, 24'000 },
+        { Timing{ 2'000'000, 4, 1 }, 31, 15'500 },
+
+        // clang-format on
+    };
+
+    for ( auto const test_case : test_cases ) {
+        auto controller = Timed_Fake_Controller{ test_case.timing };
+
+        auto mcp3008 = ::picolibrary::Microchip::MCP3008::Driver<Timed_Fake_Controller, Fake_Device_Selector>{
+            controller, random<Timed_Fake_Controller::Configuration>(), Fake_Device_Selector{}, random<Mock_Error>()
+        };
+
+        EXPECT_TRUE( mcp3008.sample( random<Input>() ).is_value() );
+
+        EXPECT_EQ( controller.bus_timing().transactions(), 1 );
+        EXPECT_EQ( controller.bus_timing().bytes(), 3 );
+        EXPECT_EQ( controller.bus_timing().cycles(), test_case.cycles );
+        EXPECT_EQ( controller.bus_timing().nanoseconds(), test_case.nanoseconds );
+    } // for
+}
+
 /**
  * \brief Verify picolibrary::Microchip::MCP3008::Driver::sample() properly handles a
  *        selection error.
@@ -210,6 +249,60 @@ TEST( sample, worksProperly )
     EXPECT_EQ( result.value(), sample );
 }
 
+/**
+ * \brief Verify picolibrary::Microchip::MCP3008::Driver::sample() works properly with the
+ *        default SPI device implementation, and a fake SPI controller.
+ */
+TEST( sample, fakeController )
+{
+    auto controller = Fake_Controller{};
+
+    auto const configuration = random<Fake_Controller::Configuration>();
+    auto const nonresponsive = random<Mock_Error>();
+
+    auto mcp3008 = ::picolibrary::Microchip::MCP3008::Driver<Fake_Controller, Fake_Device_Selector>{
+        controller, configuration, Fake_Device_Selector{}, nonresponsive
+    };
+
+    for ( auto i = 0; i < 1000; ++i ) {
+        auto const input  = random<Input>();
+        auto const sample = random<Sample::Value>( Sample::MIN, Sample::MAX );
+
+        std::uint8_t const rx[] = {
+            random<std::uint8_t>(),
+            static_cast<std::uint8_t>(
+                ( random<std::uint8_t>( 0, 0x1F ) << 3 )
+                | ( sample >> std::numeric_limits<std::uint8_t>::digits ) ),
+            static_cast<std::uint8_t>( sample ),
+        };
+        std::uint8_t tx[ 3 ] = {};
+
+        controller.script( rx );
+        controller.capture( tx );
+
+        auto const result = mcp3008.sample( input );
+
+        ASSERT_TRUE( result.is_value() );
+        ASSERT_EQ( result.value(), sample );
+        ASSERT_EQ( controller.configuration(), configuration );
+        ASSERT_EQ( controller.transmitted().size(), 3 );
+        ASSERT_EQ( tx[ 0 ], 0x01 );
+        ASSERT_EQ( tx[ 1 ], static_cast<std::uint8_t>( input ) );
+        ASSERT_EQ( tx[ 2 ], 0x00 );
+    } // for
+
+    EXPECT_EQ( controller.exchanges(), 3 * 1000 );
+
+    auto const error = random<Mock_Error>();
+
+    controller.fail( error );
+
+    auto const result = mcp3008.sample( {} );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
 /**
  * \brief Execute the picolibrary::Microchip::MCP3008::Driver unit tests.
  *
@@ -0,0 +1,145 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::MPMC_Queue unit test program.
+ */
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/mpmc_queue.h"
+#include "picolibrary/testing/unit/random.h"
+
+namespace {
+
+using ::picolibrary::MPMC_Queue;
+using ::picolibrary::Testing::Unit::random;
+using ::picolibrary::Testing::Unit::random_container;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::MPMC_Queue::push() and picolibrary::MPMC_Queue::pop() work
+ *        properly.
+ */
+TEST( pushPop, worksProperly )
+{
+    auto queue = MPMC_Queue<std::uint32_t, 8>{};
+
+    EXPECT_EQ( queue.capacity(), 8 );
+
+    for ( auto i = 0; i < 3; ++i ) {
+        auto const values = random_container<std::vector<std::uint32_t>>( 8 );
+
+        for ( auto const value : values ) {
+            EXPECT_TRUE( queue.push( value ) );
+        } // for
+
+        EXPECT_FALSE( queue.push( random<std::uint32_t>() ) );
+
+        for ( auto const expected_value : values ) {
+            auto value = std::uint32_t{};
+
+            EXPECT_TRUE( queue.pop( value ) );
+            EXPECT_EQ( value, expected_value );
+        } // for
+
+        auto value = std::uint32_t{};
+
+        EXPECT_FALSE( queue.pop( value ) );
+    } // for
+}
+
+/**
+ * \brief Verify picolibrary::MPMC_Queue works properly when multiple producers and
+ *        multiple consumers run concurrently.
+ */
+TEST( concurrent, worksProperly )
+{
+    constexpr auto THREADS  = 4;
+    constexpr auto ELEMENTS = std::uint32_t{ 10'000 };
+
+    auto queue = MPMC_Queue<std::uint32_t, 64>{};
+
+    auto producers = std::vector<std::thread>{};
+    for ( auto thread = 0; thread < THREADS; ++thread ) {
+        producers.emplace_back( [ &queue ]() {
+            for ( auto value = std::uint32_t{ 1 }; value <= ELEMENTS; ) {
+                if ( queue.push( value ) ) {
+                    ++value;
+                } else {
+                    std::this_thread::yield();
+                } // else
+            }     // for
+        } );
+    } // for
+
+    auto sums      = std::vector<std::uint64_t>( THREADS );
+    auto consumers = std::vector<std::thread>{};
+    for ( auto thread = 0; thread < THREADS; ++thread ) {
+        consumers.emplace_back( [ &queue, &sum = sums[ thread ] ]() {
+            for ( auto popped = std::uint32_t{}; popped < ELEMENTS; ) {
+                auto value = std::uint32_t{};
+                if ( queue.pop( value ) ) {
+                    sum += value;
+                    ++popped;
+                } else {
+                    std::this_thread::yield();
+                } // else
+            }     // for
+        } );
+    } // for
+
+    for ( auto & thread : producers ) {
+        thread.join();
+    } // for
+
+    for ( auto & thread : consumers ) {
+        thread.join();
+    } // for
+
+    auto sum = std::uint64_t{};
+    for ( auto const thread_sum : sums ) {
+        sum += thread_sum;
+    } // for
+
+    EXPECT_EQ( sum, std::uint64_t{ THREADS } * ELEMENTS * ( ELEMENTS + 1 ) / 2 );
+
+    auto value = std::uint32_t{};
+
+    EXPECT_FALSE( queue.pop( value ) );
+}
+
+/**
+ * \brief Execute the picolibrary::MPMC_Queue unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,257 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Parallel unit test program.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/error.h"
+#include "picolibrary/parallel.h"
+#include "picolibrary/result.h"
+#include "picolibrary/testing/unit/error.h"
+#include "picolibrary/testing/unit/random.h"
+#include "picolibrary/void.h"
+
+namespace {
+
+using ::picolibrary::Error_Code;
+using ::picolibrary::Result;
+using ::picolibrary::Void;
+using ::picolibrary::Parallel::Thread_Pool;
+using ::picolibrary::Testing::Unit::Mock_Error;
+using ::picolibrary::Testing::Unit::random;
+using ::picolibrary::Testing::Unit::random_container;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Parallel::Thread_Pool::run() executes every chunk exactly
+ *        once.
+ */
+TEST( threadPoolRun, worksProperly )
+{
+    for ( auto const workers : { 0, 1, 3 } ) {
+        auto pool = Thread_Pool{ static_cast<Thread_Pool::Size>( workers ) };
+
+        EXPECT_EQ( pool.participants(), static_cast<Thread_Pool::Size>( workers + 1 ) );
+
+        for ( auto const chunks : { 0, 1, 7, 1000 } ) {
+            auto executions = std::vector<std::atomic<int>>( static_cast<std::size_t>( chunks ) );
+
+            pool.run( static_cast<Thread_Pool::Size>( chunks ), [ &executions ]( Thread_Pool::Size chunk ) noexcept {
+                executions[ chunk ].fetch_add( 1, std::memory_order_relaxed );
+            } );
+
+            for ( auto const & execution : executions ) {
+                EXPECT_EQ( execution.load(), 1 );
+            } // for
+        }     // for
+    }         // for
+}
+
+/**
+ * \brief Verify picolibrary::Parallel::Thread_Pool::run() lets the other participants
+ *        steal the chunks queued for a participant that is busy.
+ */
+TEST( threadPoolRun, stealing )
+{
+    auto pool = Thread_Pool{ 1 };
+
+    auto const chunks = Thread_Pool::Size{ 8 };
+    auto const caller = std::this_thread::get_id();
+
+    auto executed = std::atomic<Thread_Pool::Size>{};
+    auto blocked  = std::atomic<bool>{};
+
+    pool.run( chunks, [ & ]( Thread_Pool::Size ) noexcept {
+        if ( std::this_thread::get_id() != caller and not blocked.exchange( true ) ) {
+            while ( executed.load() != chunks - 1 ) {
+                std::this_thread::yield();
+            } // while
+        }     // if
+
+        executed.fetch_add( 1 );
+    } );
+
+    EXPECT_EQ( executed.load(), chunks );
+}
+
+/**
+ * \brief Verify picolibrary::Parallel::for_each() properly handles a functor error.
+ */
+TEST( forEach, functorError )
+{
+    auto pool = Thread_Pool{ 3 };
+
+    auto const values = random_container<std::vector<std::uint32_t>>( 10'000 );
+    auto const error  = random<Mock_Error>();
+    auto const failing_position = random<std::size_t>( 0, values.size() - 1 );
+
+    auto calls = std::atomic<std::size_t>{};
+
+    auto const result = ::picolibrary::Parallel::for_each(
+        pool, values.data(), values.data() + values.size(), [ & ]( std::uint32_t const & value ) noexcept {
+            calls.fetch_add( 1, std::memory_order_relaxed );
+
+            return &value == &values[ failing_position ] ? Result<Void, Error_Code>{ error }
+                                                         : Result<Void, Error_Code>{};
+        } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+    EXPECT_LE( calls.load(), values.size() );
+}
+
+/**
+ * \brief Verify picolibrary::Parallel::for_each() works properly.
+ */
+TEST( forEach, worksProperly )
+{
+    auto pool = Thread_Pool{ 3 };
+
+    auto const values = random_container<std::vector<std::uint8_t>>( 10'000 );
+
+    auto sum = std::atomic<std::uint64_t>{};
+
+    auto const result = ::picolibrary::Parallel::for_each(
+        pool, values.data(), values.data() + values.size(), [ &sum ]( std::uint8_t value ) noexcept {
+            sum.fetch_add( value, std::memory_order_relaxed );
+
+            return Result<Void, Void>{};
+        } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( sum.load(), std::accumulate( values.begin(), values.end(), std::uint64_t{} ) );
+}
+
+/**
+ * \brief Verify picolibrary::Parallel::generate() properly handles a functor error.
+ */
+TEST( generate, functorError )
+{
+    auto pool = Thread_Pool{ 3 };
+
+    auto const error = random<Mock_Error>();
+
+    auto output = std::vector<std::uint32_t>( 10'000 );
+
+    auto const result = ::picolibrary::Parallel::generate(
+        pool, output.data(), output.data() + output.size(), [ &error ]() noexcept {
+            return Result<std::uint32_t, Error_Code>{ error };
+        } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify picolibrary::Parallel::generate() works properly.
+ */
+TEST( generate, worksProperly )
+{
+    auto pool = Thread_Pool{ 3 };
+
+    auto const value = random<std::uint32_t>();
+
+    auto output = std::vector<std::uint32_t>( 10'000 );
+
+    auto const result = ::picolibrary::Parallel::generate(
+        pool, output.data(), output.data() + output.size(), [ value ]() noexcept {
+            return Result<std::uint32_t, Error_Code>{ value };
+        } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( output, std::vector<std::uint32_t>( output.size(), value ) );
+}
+
+/**
+ * \brief Verify picolibrary::Parallel::transform_reduce() properly handles a transform
+ *        error.
+ */
+TEST( transformReduce, transformError )
+{
+    auto pool = Thread_Pool{ 3 };
+
+    auto const values = random_container<std::vector<std::uint8_t>>( 10'000 );
+    auto const error  = random<Mock_Error>();
+
+    auto const result = ::picolibrary::Parallel::transform_reduce(
+        pool,
+        values.data(),
+        values.data() + values.size(),
+        std::uint64_t{},
+        []( std::uint64_t a, std::uint64_t b ) noexcept { return a + b; },
+        [ &error ]( std::uint8_t ) noexcept { return Result<std::uint64_t, Error_Code>{ error }; } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify picolibrary::Parallel::transform_reduce() works properly.
+ */
+TEST( transformReduce, worksProperly )
+{
+    for ( auto const workers : { 0, 3 } ) {
+        auto pool = Thread_Pool{ static_cast<Thread_Pool::Size>( workers ) };
+
+        auto const values        = random_container<std::vector<std::uint8_t>>( random<std::uint16_t>() );
+        auto const initial_value = std::uint64_t{ random<std::uint32_t>() };
+
+        auto const result = ::picolibrary::Parallel::transform_reduce(
+            pool,
+            values.data(),
+            values.data() + values.size(),
+            initial_value,
+            []( std::uint64_t a, std::uint64_t b ) noexcept { return a + b; },
+            []( std::uint8_t value ) noexcept {
+                return Result<std::uint64_t, Void>{ std::uint64_t{ value } * value };
+            } );
+
+        auto expected = initial_value;
+        for ( auto const value : values ) {
+            expected += std::uint64_t{ value } * value;
+        } // for
+
+        EXPECT_EQ( result.value(), expected );
+    } // for
+}
+
+/**
+ * \brief Execute the picolibrary::Parallel unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
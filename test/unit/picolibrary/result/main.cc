@@ -0,0 +1,297 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Result unit test program.
+ */
+
+#include <cstdint>
+#include <type_traits>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/error.h"
+#include "picolibrary/result.h"
+#include "picolibrary/testing/unit/error.h"
+#include "picolibrary/testing/unit/random.h"
+#include "picolibrary/void.h"
+
+namespace {
+
+using ::picolibrary::and_then;
+using ::picolibrary::Error_Code;
+using ::picolibrary::map;
+using ::picolibrary::map_error;
+using ::picolibrary::or_else;
+using ::picolibrary::Result;
+using ::picolibrary::sequence;
+using ::picolibrary::Void;
+using ::picolibrary::Testing::Unit::Mock_Error;
+using ::picolibrary::Testing::Unit::random;
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::MockFunction;
+using ::testing::Return;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::and_then() properly handles an error.
+ */
+TEST( andThen, error )
+{
+    auto functor = MockFunction<Result<std::uint16_t, Error_Code>( std::uint8_t )>{};
+
+    auto const error = random<Mock_Error>();
+
+    EXPECT_CALL( functor, Call( _ ) ).Times( 0 );
+
+    auto const result = and_then( Result<std::uint8_t, Error_Code>{ error }, functor.AsStdFunction() );
+
+    static_assert( std::is_same_v<std::decay_t<decltype( result )>, Result<std::uint16_t, Error_Code>> );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify picolibrary::and_then() works properly.
+ */
+TEST( andThen, worksProperly )
+{
+    {
+        auto functor = MockFunction<Result<std::uint16_t, Error_Code>( std::uint8_t )>{};
+
+        auto const value   = random<std::uint8_t>();
+        auto const chained = random<std::uint16_t>();
+
+        EXPECT_CALL( functor, Call( value ) ).WillOnce( Return( chained ) );
+
+        auto const result = and_then( Result<std::uint8_t, Error_Code>{ value }, functor.AsStdFunction() );
+
+        EXPECT_TRUE( result.is_value() );
+        EXPECT_EQ( result.value(), chained );
+    }
+
+    {
+        auto functor = MockFunction<Result<Void, Void>()>{};
+
+        EXPECT_CALL( functor, Call() ).WillOnce( Return( Result<Void, Void>{} ) );
+
+        auto const result = and_then( Result<Void, Error_Code>{}, functor.AsStdFunction() );
+
+        static_assert( std::is_same_v<std::decay_t<decltype( result )>, Result<Void, Error_Code>> );
+
+        EXPECT_TRUE( result.is_value() );
+    }
+
+    {
+        auto functor = MockFunction<Result<Void, Error_Code>()>{};
+
+        auto const error = random<Mock_Error>();
+
+        EXPECT_CALL( functor, Call() ).WillOnce( Return( error ) );
+
+        auto const result = and_then( Result<Void, Void>{}, functor.AsStdFunction() );
+
+        EXPECT_TRUE( result.is_error() );
+        EXPECT_EQ( result.error(), error );
+    }
+}
+
+/**
+ * \brief Verify picolibrary::map() properly handles an error.
+ */
+TEST( map, error )
+{
+    auto functor = MockFunction<std::uint16_t( std::uint8_t )>{};
+
+    auto const error = random<Mock_Error>();
+
+    EXPECT_CALL( functor, Call( _ ) ).Times( 0 );
+
+    auto const result = map( Result<std::uint8_t, Error_Code>{ error }, functor.AsStdFunction() );
+
+    static_assert( std::is_same_v<std::decay_t<decltype( result )>, Result<std::uint16_t, Error_Code>> );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify picolibrary::map() works properly.
+ */
+TEST( map, worksProperly )
+{
+    {
+        auto functor = MockFunction<std::uint16_t( std::uint8_t )>{};
+
+        auto const value  = random<std::uint8_t>();
+        auto const mapped = random<std::uint16_t>();
+
+        EXPECT_CALL( functor, Call( value ) ).WillOnce( Return( mapped ) );
+
+        auto const result = map( Result<std::uint8_t, Error_Code>{ value }, functor.AsStdFunction() );
+
+        EXPECT_TRUE( result.is_value() );
+        EXPECT_EQ( result.value(), mapped );
+    }
+
+    {
+        auto functor = MockFunction<void( std::uint8_t )>{};
+
+        auto const value = random<std::uint8_t>();
+
+        EXPECT_CALL( functor, Call( value ) );
+
+        auto const result = map( Result<std::uint8_t, Error_Code>{ value }, functor.AsStdFunction() );
+
+        static_assert( std::is_same_v<std::decay_t<decltype( result )>, Result<Void, Error_Code>> );
+
+        EXPECT_TRUE( result.is_value() );
+    }
+}
+
+/**
+ * \brief Verify picolibrary::map_error() works properly.
+ */
+TEST( mapError, worksProperly )
+{
+    {
+        auto functor = MockFunction<Error_Code( Error_Code const & )>{};
+
+        auto const error  = random<Mock_Error>();
+        auto const mapped = random<Mock_Error>();
+
+        EXPECT_CALL( functor, Call( Error_Code{ error } ) ).WillOnce( Return( mapped ) );
+
+        auto const result = map_error( Result<std::uint8_t, Error_Code>{ error }, functor.AsStdFunction() );
+
+        EXPECT_TRUE( result.is_error() );
+        EXPECT_EQ( result.error(), mapped );
+    }
+
+    {
+        auto functor = MockFunction<Error_Code( Error_Code const & )>{};
+
+        auto const value = random<std::uint8_t>();
+
+        EXPECT_CALL( functor, Call( _ ) ).Times( 0 );
+
+        auto const result = map_error( Result<std::uint8_t, Error_Code>{ value }, functor.AsStdFunction() );
+
+        EXPECT_TRUE( result.is_value() );
+        EXPECT_EQ( result.value(), value );
+    }
+}
+
+/**
+ * \brief Verify picolibrary::or_else() works properly.
+ */
+TEST( orElse, worksProperly )
+{
+    {
+        auto functor = MockFunction<Result<std::uint8_t, Void>( Error_Code const & )>{};
+
+        auto const error     = random<Mock_Error>();
+        auto const recovered = random<std::uint8_t>();
+
+        EXPECT_CALL( functor, Call( Error_Code{ error } ) ).WillOnce( Return( recovered ) );
+
+        auto const result = or_else( Result<std::uint8_t, Error_Code>{ error }, functor.AsStdFunction() );
+
+        static_assert( std::is_same_v<std::decay_t<decltype( result )>, Result<std::uint8_t, Void>> );
+
+        EXPECT_EQ( result.value(), recovered );
+    }
+
+    {
+        auto functor = MockFunction<Result<std::uint8_t, Void>( Error_Code const & )>{};
+
+        auto const value = random<std::uint8_t>();
+
+        EXPECT_CALL( functor, Call( _ ) ).Times( 0 );
+
+        auto const result = or_else( Result<std::uint8_t, Error_Code>{ value }, functor.AsStdFunction() );
+
+        EXPECT_EQ( result.value(), value );
+    }
+}
+
+/**
+ * \brief Verify picolibrary::sequence() properly handles an error.
+ */
+TEST( sequence, error )
+{
+    auto first  = MockFunction<Result<Void, Error_Code>()>{};
+    auto second = MockFunction<Result<Void, Error_Code>()>{};
+    auto third  = MockFunction<Result<std::uint8_t, Error_Code>()>{};
+
+    auto const error = random<Mock_Error>();
+
+    EXPECT_CALL( first, Call() ).WillOnce( Return( Result<Void, Error_Code>{} ) );
+    EXPECT_CALL( second, Call() ).WillOnce( Return( error ) );
+    EXPECT_CALL( third, Call() ).Times( 0 );
+
+    auto const result = sequence(
+        first.AsStdFunction(), second.AsStdFunction(), third.AsStdFunction() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify picolibrary::sequence() works properly.
+ */
+TEST( sequence, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto first  = MockFunction<Result<Void, Error_Code>()>{};
+    auto second = MockFunction<Result<std::uint16_t, Void>()>{};
+    auto third  = MockFunction<Result<std::uint8_t, Error_Code>()>{};
+
+    auto const value = random<std::uint8_t>();
+
+    EXPECT_CALL( first, Call() ).WillOnce( Return( Result<Void, Error_Code>{} ) );
+    EXPECT_CALL( second, Call() ).WillOnce( Return( random<std::uint16_t>() ) );
+    EXPECT_CALL( third, Call() ).WillOnce( Return( value ) );
+
+    auto const result = sequence(
+        first.AsStdFunction(), second.AsStdFunction(), third.AsStdFunction() );
+
+    static_assert( std::is_same_v<std::decay_t<decltype( result )>, Result<std::uint8_t, Error_Code>> );
+
+    EXPECT_TRUE( result.is_value() );
+    EXPECT_EQ( result.value(), value );
+}
+
+/**
+ * \brief Execute the picolibrary::Result unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
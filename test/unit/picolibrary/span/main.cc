@@ -0,0 +1,207 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Span unit test program.
+ */
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/fixed_capacity_vector.h"
+#include "picolibrary/fixed_size_array.h"
+#include "picolibrary/span.h"
+#include "picolibrary/testing/unit/random.h"
+
+namespace {
+
+using ::picolibrary::Byte_View;
+using ::picolibrary::Fixed_Capacity_Vector;
+using ::picolibrary::Fixed_Size_Array;
+using ::picolibrary::Span;
+using ::picolibrary::Testing::Unit::random;
+using ::picolibrary::Testing::Unit::random_container;
+using ::testing::ElementsAreArray;
+using ::testing::IsEmpty;
+
+template<typename T>
+auto elements( Span<T> span )
+{
+    return std::vector<std::remove_cv_t<T>>( span.begin(), span.end() );
+}
+
+/**
+ * \brief Get a copy of the bytes in a byte view.
+ *
+ * \param[in] view The byte view.
+ *
+ * \return A copy of the bytes in the byte view.
+ */
+auto bytes( Byte_View view )
+{
+    return elements( view );
+}
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Span::Span() works properly.
+ */
+TEST( constructorDefault, worksProperly )
+{
+    constexpr auto span = Span<std::uint8_t const>{};
+
+    EXPECT_TRUE( span.empty() );
+    EXPECT_EQ( span.size(), 0 );
+    EXPECT_EQ( span.data(), nullptr );
+    EXPECT_EQ( span.begin(), span.end() );
+}
+
+/**
+ * \brief Verify picolibrary::Span::Span( Pointer, Pointer ) and
+ *        picolibrary::Span::Span( Pointer, Size ) work properly.
+ */
+TEST( constructorPointer, worksProperly )
+{
+    auto values = random_container<std::vector<std::uint8_t>>();
+
+    auto const range = Span<std::uint8_t>{ values.data(), values.data() + values.size() };
+    auto const sized = Span<std::uint8_t>{ values.data(), values.size() };
+
+    EXPECT_EQ( range.data(), values.data() );
+    EXPECT_EQ( range.size(), values.size() );
+    EXPECT_EQ( sized.data(), values.data() );
+    EXPECT_EQ( sized.size(), values.size() );
+    EXPECT_THAT( elements( sized ), ElementsAreArray( values ) );
+}
+
+/**
+ * \brief Verify picolibrary::Span::Span( U ( & )[ N ] ) and the container constructor
+ *        work properly.
+ */
+TEST( constructorContainer, worksProperly )
+{
+    {
+        std::uint8_t values[] = { random<std::uint8_t>(), random<std::uint8_t>(), random<std::uint8_t>() };
+
+        auto const view = Byte_View{ values };
+
+        EXPECT_EQ( view.data(), values );
+        EXPECT_EQ( view.size(), 3 );
+    }
+
+    {
+        auto const values = Fixed_Size_Array<std::uint8_t, 4>{
+            random<std::uint8_t>(), random<std::uint8_t>(), random<std::uint8_t>(), random<std::uint8_t>()
+        };
+
+        auto const view = Byte_View{ values };
+
+        EXPECT_EQ( view.data(), values.data() );
+        EXPECT_EQ( view.size(), values.size() );
+    }
+
+    {
+        auto values = Fixed_Capacity_Vector<std::uint8_t, 8>( 5, random<std::uint8_t>() );
+
+        auto const span = Span<std::uint8_t>{ values };
+        auto const view = Byte_View{ span };
+
+        EXPECT_EQ( span.data(), values.data() );
+        EXPECT_EQ( span.size(), 5 );
+        EXPECT_EQ( view.data(), values.data() );
+        EXPECT_EQ( view.size(), 5 );
+    }
+}
+
+/**
+ * \brief Verify picolibrary::Span element access works properly.
+ */
+TEST( access, worksProperly )
+{
+    auto values = random_container<std::vector<std::uint32_t>>( 1 + random<std::uint_fast8_t>() );
+
+    auto const span = Span<std::uint32_t>{ values };
+
+    EXPECT_EQ( &span.front(), &values.front() );
+    EXPECT_EQ( &span.back(), &values.back() );
+    EXPECT_EQ( span.size_bytes(), values.size() * sizeof( std::uint32_t ) );
+
+    for ( auto i = std::size_t{}; i < values.size(); ++i ) {
+        EXPECT_EQ( &span[ i ], &values[ i ] );
+    } // for
+
+    auto const value = random<std::uint32_t>();
+    span.front()     = value;
+    EXPECT_EQ( values.front(), value );
+
+    auto element = span.rbegin();
+    for ( auto i = values.size(); i; --i, ++element ) {
+        EXPECT_EQ( *element, values[ i - 1 ] );
+    } // for
+    EXPECT_EQ( element, span.rend() );
+}
+
+/**
+ * \brief Verify picolibrary::Span::Span( picolibrary::Span<U> const & ) works properly.
+ */
+TEST( constructorSpan, worksProperly )
+{
+    auto values = random_container<std::vector<std::uint8_t>>( random<std::uint_fast8_t>( 2, 16 ) );
+
+    auto const span = Span<std::uint8_t>{ values.data(), values.size() };
+
+    EXPECT_THAT( bytes( span ), ElementsAreArray( values ) );
+    EXPECT_THAT( bytes( span.first( 2 ) ), ElementsAreArray( values.begin(), values.begin() + 2 ) );
+    EXPECT_THAT( bytes( span.subspan( 1 ) ), ElementsAreArray( values.begin() + 1, values.end() ) );
+}
+
+/**
+ * \brief Verify picolibrary::Span::first(), picolibrary::Span::last(), and
+ *        picolibrary::Span::subspan() work properly.
+ */
+TEST( subspan, worksProperly )
+{
+    auto const values = std::vector<std::uint8_t>{ 0x3C, 0x91, 0x5A, 0x0E, 0xD7 };
+
+    auto const view = Byte_View{ values };
+
+    EXPECT_THAT( elements( view.first( 2 ) ), ElementsAreArray( { 0x3C, 0x91 } ) );
+    EXPECT_THAT( elements( view.last( 2 ) ), ElementsAreArray( { 0x0E, 0xD7 } ) );
+    EXPECT_THAT( elements( view.subspan( 3 ) ), ElementsAreArray( { 0x0E, 0xD7 } ) );
+    EXPECT_THAT( elements( view.subspan( 1, 3 ) ), ElementsAreArray( { 0x91, 0x5A, 0x0E } ) );
+    EXPECT_THAT( elements( view.subspan( 5 ) ), IsEmpty() );
+}
+
+/**
+ * \brief Execute the picolibrary::Span unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
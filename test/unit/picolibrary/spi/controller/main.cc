@@ -32,6 +32,8 @@
 
 namespace {
 
+using ::picolibrary::Byte_View;
+using ::picolibrary::Span;
 using ::picolibrary::Testing::Unit::Mock_Error;
 using ::picolibrary::Testing::Unit::random;
 using ::picolibrary::Testing::Unit::random_container;
@@ -90,6 +92,30 @@ TEST( exchangeBlock, worksProperly )
     EXPECT_EQ( rx, rx_expected );
 }
 
+/**
+ * \brief Verify picolibrary::SPI::Controller::exchange( picolibrary::Byte_View,
+ *        picolibrary::Span<std::uint8_t> ) works properly.
+ */
+TEST( exchangeSpan, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto controller = Controller{};
+
+    auto const size        = random<std::uint_fast8_t>();
+    auto const tx          = random_container<std::vector<std::uint8_t>>( size );
+    auto const rx_expected = random_container<std::vector<std::uint8_t>>( size );
+
+    for ( auto i = 0; i < size; ++i ) {
+        EXPECT_CALL( controller, exchange( tx[ i ] ) ).WillOnce( Return( rx_expected[ i ] ) );
+    } // for
+
+    auto rx = std::vector<std::uint8_t>( size );
+    EXPECT_FALSE( controller.exchange( Byte_View{ tx }, Span<std::uint8_t>{ rx } ).is_error() );
+
+    EXPECT_EQ( rx, rx_expected );
+}
+
 /**
  * \brief Verify picolibrary::SPI::Controller::receive() properly handles an exchange
  *        error.
@@ -167,6 +193,28 @@ TEST( receiveBlock, worksProperly )
     EXPECT_EQ( rx, rx_expected );
 }
 
+/**
+ * \brief Verify picolibrary::SPI::Controller::receive( picolibrary::Span<std::uint8_t> )
+ *        works properly.
+ */
+TEST( receiveSpan, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto controller = Controller{};
+
+    auto const rx_expected = random_container<std::vector<std::uint8_t>>();
+
+    for ( auto const byte : rx_expected ) {
+        EXPECT_CALL( controller, exchange( 0x00 ) ).WillOnce( Return( byte ) );
+    } // for
+
+    auto rx = std::vector<std::uint8_t>( rx_expected.size() );
+    EXPECT_FALSE( controller.receive( Span<std::uint8_t>{ rx } ).is_error() );
+
+    EXPECT_EQ( rx, rx_expected );
+}
+
 /**
  * \brief Verify picolibrary::SPI::Controller::transmit( std::uint8_t ) properly handles
  *        an exchange error.
@@ -237,6 +285,25 @@ TEST( transmitBlock, worksProperly )
     EXPECT_FALSE( controller.transmit( &*tx.begin(), &*tx.end() ).is_error() );
 }
 
+/**
+ * \brief Verify picolibrary::SPI::Controller::transmit( picolibrary::Byte_View ) works
+ *        properly.
+ */
+TEST( transmitSpan, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto controller = Controller{};
+
+    auto const tx = random_container<std::vector<std::uint8_t>>();
+
+    for ( auto const byte : tx ) {
+        EXPECT_CALL( controller, exchange( byte ) ).WillOnce( Return( random<std::uint8_t>() ) );
+    } // for
+
+    EXPECT_FALSE( controller.transmit( Byte_View{ tx } ).is_error() );
+}
+
 /**
  * \brief Execute the picolibrary::SPI::Controller unit tests.
  *
@@ -0,0 +1,189 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::SPSC_Ring unit test program.
+ */
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/spsc_ring.h"
+#include "picolibrary/testing/unit/random.h"
+
+namespace {
+
+using ::picolibrary::SPSC_Ring;
+using ::picolibrary::Testing::Unit::random;
+using ::picolibrary::Testing::Unit::random_container;
+using ::testing::ElementsAreArray;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::SPSC_Ring::push() and picolibrary::SPSC_Ring::pop() work
+ *        properly.
+ */
+TEST( pushPop, worksProperly )
+{
+    auto ring = SPSC_Ring<std::uint32_t, 8>{};
+
+    EXPECT_TRUE( ring.empty() );
+    EXPECT_EQ( ring.capacity(), 8 );
+
+    auto const values = random_container<std::vector<std::uint32_t>>( 8 );
+
+    for ( auto const value : values ) {
+        EXPECT_TRUE( ring.push( value ) );
+    } // for
+
+    EXPECT_TRUE( ring.full() );
+    EXPECT_FALSE( ring.push( random<std::uint32_t>() ) );
+
+    for ( auto const expected_value : values ) {
+        auto value = std::uint32_t{};
+
+        EXPECT_TRUE( ring.pop( value ) );
+        EXPECT_EQ( value, expected_value );
+    } // for
+
+    auto value = std::uint32_t{};
+
+    EXPECT_TRUE( ring.empty() );
+    EXPECT_FALSE( ring.pop( value ) );
+}
+
+/**
+ * \brief Verify picolibrary::SPSC_Ring batch push and pop work properly when the ring
+ *        buffer wraps around.
+ */
+TEST( pushPopRange, worksProperly )
+{
+    auto ring = SPSC_Ring<std::uint8_t, 16>{};
+
+    for ( auto i = 0; i < 10; ++i ) {
+        auto const values = random_container<std::vector<std::uint8_t>>( random<std::uint_fast8_t>( 1, 24 ) );
+
+        auto const pushed = ring.push( &*values.begin(), &*values.begin() + values.size() );
+
+        EXPECT_EQ( pushed, values.size() < 16 ? values.size() : 16 );
+        EXPECT_EQ( ring.size(), pushed );
+
+        auto popped_values = std::vector<std::uint8_t>( 24 );
+
+        auto const popped = ring.pop( &*popped_values.begin(), &*popped_values.begin() + popped_values.size() );
+
+        EXPECT_EQ( popped, pushed );
+        EXPECT_THAT(
+            std::vector<std::uint8_t>( popped_values.begin(), popped_values.begin() + popped ),
+            ElementsAreArray( values.begin(), values.begin() + pushed ) );
+        EXPECT_TRUE( ring.empty() );
+    } // for
+}
+
+/**
+ * \brief Verify picolibrary::SPSC_Ring::reserve(), picolibrary::SPSC_Ring::commit(),
+ *        picolibrary::SPSC_Ring::peek(), and picolibrary::SPSC_Ring::consume() work
+ *        properly.
+ */
+TEST( reserveCommitPeekConsume, worksProperly )
+{
+    auto ring = SPSC_Ring<std::uint8_t, 8>{};
+
+    EXPECT_EQ( ring.reserve().size(), 8 );
+    EXPECT_TRUE( ring.peek().empty() );
+
+    ring.commit( 6 );
+    ring.consume( 6 );
+
+    auto const block = ring.reserve();
+
+    EXPECT_EQ( block.size(), 2 );
+
+    block.begin()[ 0 ] = 0x12;
+    block.begin()[ 1 ] = 0x34;
+
+    ring.commit( 2 );
+
+    EXPECT_EQ( ring.reserve().size(), 6 );
+
+    auto const available = ring.peek();
+
+    EXPECT_EQ( available.size(), 2 );
+    EXPECT_EQ( available.begin()[ 0 ], 0x12 );
+    EXPECT_EQ( available.begin()[ 1 ], 0x34 );
+
+    ring.consume( 2 );
+
+    EXPECT_TRUE( ring.empty() );
+}
+
+/**
+ * \brief Verify picolibrary::SPSC_Ring works properly when the producer and consumer
+ *        run concurrently.
+ */
+TEST( concurrent, worksProperly )
+{
+    constexpr auto ELEMENTS = std::uint32_t{ 100'000 };
+
+    auto ring = SPSC_Ring<std::uint32_t, 64>{};
+
+    auto producer = std::thread{ [ &ring ]() {
+        for ( auto value = std::uint32_t{}; value < ELEMENTS; ) {
+            if ( ring.push( value ) ) {
+                ++value;
+            } else {
+                std::this_thread::yield();
+            } // else
+        }     // for
+    } };
+
+    auto in_order = true;
+    for ( auto expected_value = std::uint32_t{}; expected_value < ELEMENTS; ) {
+        auto value = std::uint32_t{};
+        if ( ring.pop( value ) ) {
+            in_order = in_order and value == expected_value;
+            ++expected_value;
+        } else {
+            std::this_thread::yield();
+        } // else
+    }     // for
+
+    producer.join();
+
+    EXPECT_TRUE( in_order );
+    EXPECT_TRUE( ring.empty() );
+}
+
+/**
+ * \brief Execute the picolibrary::SPSC_Ring unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,197 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+/**
+ * \file
+ * \brief picolibrary::Timer_Queue unit test program.
+ */
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/testing/unit/random.h"
+#include "picolibrary/timer_queue.h"
+
+namespace {
+
+using ::picolibrary::Timer_Queue;
+using ::picolibrary::Timer_Queue_Node;
+using ::picolibrary::Testing::Unit::random;
+
+/**
+ * \brief Timer.
+ */
+struct Timer : public Timer_Queue_Node<std::uint16_t> {
+    /**
+     * \brief The timer's ID.
+     */
+    std::uint32_t id{};
+
+    /**
+     * \brief The number of times the timer has expired.
+     */
+    std::uint32_t expirations{};
+};
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Timer_Queue::precedes() works properly.
+ */
+TEST( precedes, worksProperly )
+{
+    using Queue = Timer_Queue<Timer>;
+
+    EXPECT_TRUE( Queue::precedes( 1, 2 ) );
+    EXPECT_FALSE( Queue::precedes( 2, 1 ) );
+    EXPECT_FALSE( Queue::precedes( 2, 2 ) );
+    EXPECT_TRUE( Queue::precedes( std::numeric_limits<std::uint16_t>::max(), 0 ) );
+    EXPECT_FALSE( Queue::precedes( 0, std::numeric_limits<std::uint16_t>::max() ) );
+}
+
+/**
+ * \brief Verify picolibrary::Timer_Queue schedule, cancel, and pop operations work
+ *        properly.
+ */
+TEST( scheduleCancelPop, worksProperly )
+{
+    auto timers = std::vector<Timer>( random<std::uint8_t>( 1, 128 ) );
+    for ( auto i = std::size_t{}; i < timers.size(); ++i ) {
+        timers[ i ].id = static_cast<std::uint32_t>( i );
+    } // for
+
+    auto const base = random<std::uint16_t>();
+
+    auto queue    = Timer_Queue<Timer>{};
+    auto expected = std::map<std::uint32_t, std::uint16_t>{};
+
+    EXPECT_TRUE( queue.empty() );
+
+    for ( auto i = 0; i < 512; ++i ) {
+        auto & timer = timers[ random<std::uint8_t>( 0, timers.size() - 1 ) ];
+
+        switch ( random<std::uint8_t>( 0, 2 ) ) {
+            case 0: {
+                auto const expiration = static_cast<std::uint16_t>(
+                    base + random<std::uint16_t>( 0, 0x3FFF ) );
+
+                queue.schedule( timer, expiration );
+                expected[ timer.id ] = expiration;
+
+                ASSERT_TRUE( timer.scheduled() );
+                ASSERT_EQ( timer.expiration(), expiration );
+            } break;
+            case 1:
+                queue.cancel( timer );
+                expected.erase( timer.id );
+
+                ASSERT_FALSE( timer.scheduled() );
+                break;
+            default:
+                if ( not queue.empty() ) {
+                    auto & next = queue.pop();
+
+                    ASSERT_FALSE( next.scheduled() );
+                    ASSERT_EQ( next.expiration(), expected.at( next.id ) );
+                    for ( auto const & [ id, expiration ] : expected ) {
+                        ASSERT_FALSE(
+                            Timer_Queue<Timer>::precedes( expiration, next.expiration() ) );
+                    } // for
+
+                    expected.erase( next.id );
+                } // if
+                break;
+        } // switch
+
+        ASSERT_EQ( queue.empty(), expected.empty() );
+    } // for
+
+    auto previous = std::uint16_t{ base };
+    while ( not queue.empty() ) {
+        auto const expiration = queue.next_expiration();
+        auto &     next       = queue.pop();
+
+        ASSERT_EQ( next.expiration(), expiration );
+        ASSERT_EQ( expected.erase( next.id ), 1 );
+        ASSERT_FALSE( Timer_Queue<Timer>::precedes( expiration, previous ) );
+
+        previous = expiration;
+    } // while
+
+    EXPECT_TRUE( expected.empty() );
+}
+
+/**
+ * \brief Verify picolibrary::Timer_Queue::expire() works properly with periodic timers
+ *        across a tick counter wrap around.
+ */
+TEST( expire, worksProperly )
+{
+    auto timers  = std::vector<Timer>( random<std::uint8_t>( 1, 16 ) );
+    auto periods = std::vector<std::uint16_t>{};
+
+    auto const start = static_cast<std::uint16_t>(
+        std::numeric_limits<std::uint16_t>::max() - random<std::uint8_t>() );
+
+    auto queue = Timer_Queue<Timer>{};
+
+    for ( auto i = std::size_t{}; i < timers.size(); ++i ) {
+        timers[ i ].id = static_cast<std::uint32_t>( i );
+        periods.push_back( random<std::uint16_t>( 1, 100 ) );
+
+        queue.schedule(
+            timers[ i ], static_cast<std::uint16_t>( start + periods.back() ) );
+    } // for
+
+    auto const ticks = std::uint16_t{ 1000 };
+
+    for ( auto tick = std::uint16_t{ 1 }; tick <= ticks; ++tick ) {
+        auto const now = static_cast<std::uint16_t>( start + tick );
+
+        queue.expire( now, [ & ]( Timer & timer ) {
+            EXPECT_EQ( timer.expiration(), now );
+
+            ++timer.expirations;
+
+            queue.schedule(
+                timer,
+                static_cast<std::uint16_t>( timer.expiration() + periods[ timer.id ] ) );
+        } );
+    } // for
+
+    for ( auto i = std::size_t{}; i < timers.size(); ++i ) {
+        EXPECT_EQ( timers[ i ].expirations, ticks / periods[ i ] );
+    } // for
+}
+
+/**
+ * \brief Execute the picolibrary::Timer_Queue unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,290 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Trace::Buffer unit test program.
+ */
+
+#include <cstddef>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/i2c.h"
+#include "picolibrary/spi.h"
+#include "picolibrary/testing/fake/i2c.h"
+#include "picolibrary/testing/fake/spi.h"
+#include "picolibrary/testing/unit/random.h"
+#include "picolibrary/trace.h"
+
+namespace {
+
+using ::picolibrary::I2C::make_bus_control_guard;
+using ::picolibrary::SPI::make_device_selection_guard;
+using ::picolibrary::Testing::Fake::I2C::Fake_Controller;
+using ::picolibrary::Testing::Fake::SPI::Fake_Device_Selector;
+using ::picolibrary::Testing::Unit::random;
+using ::picolibrary::Trace::Buffer;
+using ::picolibrary::Trace::Event;
+using ::picolibrary::Trace::Phase;
+using ::picolibrary::Trace::Timestamp;
+
+/**
+ * \brief The current time.
+ */
+thread_local Timestamp now{};
+
+/**
+ * \brief Unit testing clock (advances by one tick each time it is read).
+ *
+ * \return The current time.
+ */
+auto tick() noexcept -> Timestamp
+{
+    return now++;
+}
+
+/**
+ * \brief Get the events in a buffer, from oldest to newest.
+ *
+ * \param[in] buffer The buffer whose events are to be got.
+ *
+ * \return The events in the buffer, from oldest to newest.
+ */
+auto events( Buffer const & buffer )
+{
+    auto events = std::vector<Event>{};
+
+    buffer.for_each( [ &events ]( Event const & event ) { events.push_back( event ); } );
+
+    return events;
+}
+
+/**
+ * \brief Installed buffer guard.
+ */
+class Installation {
+  public:
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] buffer The buffer to install.
+     */
+    Installation( Buffer & buffer ) noexcept
+    {
+        ::picolibrary::Trace::install( &buffer );
+    }
+
+    Installation( Installation && ) = delete;
+
+    Installation( Installation const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Installation() noexcept
+    {
+        ::picolibrary::Trace::install( nullptr );
+    }
+
+    auto operator=( Installation && ) = delete;
+
+    auto operator=( Installation const & ) = delete;
+};
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Trace::Buffer::record() and
+ *        picolibrary::Trace::Buffer::for_each() work properly.
+ */
+TEST( record, worksProperly )
+{
+    auto buffer = Buffer{ random<Buffer::Thread_ID>(), tick };
+
+    EXPECT_TRUE( buffer.empty() );
+
+    auto const records = random<std::size_t>( Buffer::CAPACITY + 1, Buffer::CAPACITY * 3 );
+    auto const start   = now;
+
+    for ( auto i = std::size_t{ 0 }; i < records; ++i ) {
+        buffer.record( "event", i % 2 ? Phase::END : Phase::BEGIN );
+    } // for
+
+    EXPECT_FALSE( buffer.empty() );
+    EXPECT_EQ( buffer.size(), Buffer::CAPACITY );
+    EXPECT_EQ( buffer.overwritten(), records - Buffer::CAPACITY );
+
+    auto const recorded = events( buffer );
+
+    ASSERT_EQ( recorded.size(), Buffer::CAPACITY );
+
+    for ( auto i = std::size_t{ 0 }; i < recorded.size(); ++i ) {
+        auto const record = records - Buffer::CAPACITY + i;
+
+        EXPECT_STREQ( recorded[ i ].name, "event" );
+        EXPECT_EQ( recorded[ i ].timestamp, start + record );
+        EXPECT_EQ( recorded[ i ].phase, record % 2 ? Phase::END : Phase::BEGIN );
+    } // for
+
+    buffer.clear();
+
+    EXPECT_TRUE( buffer.empty() );
+    EXPECT_EQ( buffer.overwritten(), 0 );
+    EXPECT_TRUE( events( buffer ).empty() );
+}
+
+#ifdef PICOLIBRARY_ENABLE_TRACING
+/**
+ * \brief Verify the tracing macros record events in the installed buffer.
+ */
+TEST( macros, worksProperly )
+{
+    auto buffer = Buffer{ 0, tick };
+
+    PICOLIBRARY_TRACE_INSTANT( "discarded" );
+
+    EXPECT_EQ( ::picolibrary::Trace::installed(), nullptr );
+
+    {
+        auto const installation = Installation{ buffer };
+
+        EXPECT_EQ( ::picolibrary::Trace::installed(), &buffer );
+
+        {
+            PICOLIBRARY_TRACE_SCOPE( "outer" );
+            PICOLIBRARY_TRACE_SCOPE( "inner" );
+
+            PICOLIBRARY_TRACE_INSTANT( "instant" );
+        }
+
+        PICOLIBRARY_TRACE_BEGIN( "duration" );
+        PICOLIBRARY_TRACE_END( "duration" );
+    }
+
+    PICOLIBRARY_TRACE_INSTANT( "discarded" );
+
+    auto const recorded = events( buffer );
+
+    struct {
+        char const * name;
+        Phase        phase;
+    } const expected[]{
+        { "outer", Phase::BEGIN },    { "inner", Phase::BEGIN },
+        { "instant", Phase::INSTANT }, { "inner", Phase::END },
+        { "outer", Phase::END },      { "duration", Phase::BEGIN },
+        { "duration", Phase::END },
+    };
+
+    ASSERT_EQ( recorded.size(), std::size( expected ) );
+
+    for ( auto i = std::size_t{ 0 }; i < recorded.size(); ++i ) {
+        EXPECT_STREQ( recorded[ i ].name, expected[ i ].name );
+        EXPECT_EQ( recorded[ i ].phase, expected[ i ].phase );
+    } // for
+}
+
+/**
+ * \brief Verify buffers are installed per thread of execution.
+ */
+TEST( install, perThread )
+{
+    auto buffer        = Buffer{ 0, tick };
+    auto thread_buffer = Buffer{ 1, tick };
+
+    auto const installation = Installation{ buffer };
+
+    auto thread = std::thread{ [ &thread_buffer ]() {
+        EXPECT_EQ( ::picolibrary::Trace::installed(), nullptr );
+
+        auto const thread_installation = Installation{ thread_buffer };
+
+        PICOLIBRARY_TRACE_INSTANT( "thread" );
+    } };
+
+    thread.join();
+
+    PICOLIBRARY_TRACE_INSTANT( "main" );
+
+    ASSERT_EQ( buffer.size(), 1 );
+    EXPECT_STREQ( events( buffer )[ 0 ].name, "main" );
+    ASSERT_EQ( thread_buffer.size(), 1 );
+    EXPECT_STREQ( events( thread_buffer )[ 0 ].name, "thread" );
+}
+
+/**
+ * \brief Verify picolibrary::I2C::Bus_Control_Guard and
+ *        picolibrary::SPI::Device_Selection_Guard are traced.
+ */
+TEST( instrumentation, guards )
+{
+    auto buffer = Buffer{ 0, tick };
+
+    auto const installation = Installation{ buffer };
+
+    {
+        auto controller = Fake_Controller{};
+
+        auto result = make_bus_control_guard( controller );
+
+        ASSERT_TRUE( result.is_value() );
+
+        auto guard = std::move( result ).value();
+    }
+
+    {
+        auto device_selector = Fake_Device_Selector{};
+
+        auto result = make_device_selection_guard( device_selector );
+
+        ASSERT_TRUE( result.is_value() );
+
+        auto guard = std::move( result ).value();
+    }
+
+    auto const recorded = events( buffer );
+
+    ASSERT_EQ( recorded.size(), 4 );
+    EXPECT_STREQ( recorded[ 0 ].name, "I2C::Bus_Control_Guard" );
+    EXPECT_EQ( recorded[ 0 ].phase, Phase::BEGIN );
+    EXPECT_STREQ( recorded[ 1 ].name, "I2C::Bus_Control_Guard" );
+    EXPECT_EQ( recorded[ 1 ].phase, Phase::END );
+    EXPECT_STREQ( recorded[ 2 ].name, "SPI::Device_Selection_Guard" );
+    EXPECT_EQ( recorded[ 2 ].phase, Phase::BEGIN );
+    EXPECT_STREQ( recorded[ 3 ].name, "SPI::Device_Selection_Guard" );
+    EXPECT_EQ( recorded[ 3 ].phase, Phase::END );
+}
+#endif // PICOLIBRARY_ENABLE_TRACING
+
+/**
+ * \brief Execute the picolibrary::Trace::Buffer unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
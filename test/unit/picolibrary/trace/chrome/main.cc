@@ -0,0 +1,183 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Trace::Chrome unit test program.
+ */
+
+#include <cstdint>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/testing/unit/error.h"
+#include "picolibrary/testing/unit/random.h"
+#include "picolibrary/testing/unit/stream.h"
+#include "picolibrary/trace.h"
+#include "picolibrary/trace/chrome.h"
+
+namespace {
+
+using ::picolibrary::Testing::Unit::Mock_Error;
+using ::picolibrary::Testing::Unit::Mock_Output_Stream;
+using ::picolibrary::Testing::Unit::Output_String_Stream;
+using ::picolibrary::Testing::Unit::random;
+using ::picolibrary::Trace::Buffer;
+using ::picolibrary::Trace::Event;
+using ::picolibrary::Trace::Phase;
+using ::picolibrary::Trace::Timestamp;
+using ::picolibrary::Trace::Chrome::write;
+using ::testing::A;
+using ::testing::Return;
+
+/**
+ * \brief The current time.
+ */
+Timestamp now{};
+
+/**
+ * \brief Unit testing clock.
+ *
+ * \return The current time.
+ */
+auto clock() noexcept -> Timestamp
+{
+    return now;
+}
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Trace::Chrome::write( picolibrary::Output_Stream &,
+ *        std::uint_fast64_t, picolibrary::Trace::Buffer::Thread_ID,
+ *        picolibrary::Trace::Event const & ) works properly.
+ */
+TEST( writeEvent, worksProperly )
+{
+    struct {
+        std::uint_fast64_t  clock_frequency;
+        Buffer::Thread_ID   thread;
+        Event               event;
+        char const *        json;
+    } const test_cases[]{
+        // clang-format off
+
+        { 1'000'000,     0, { "a", 0,             Phase::BEGIN   }, R"({"name":"a","ph":"B","ts":0.000,"pid":0,"tid":0})" },
+        { 1'000'000,     1, { "b", 1'234,         Phase::END     }, R"({"name":"b","ph":"E","ts":1234.000,"pid":0,"tid":1})" },
+        { 1'000'000'000, 7, { "c", 1'234'567,     Phase::INSTANT }, R"({"name":"c","ph":"i","ts":1234.567,"pid":0,"tid":7,"s":"t"})" },
+        { 3,             2, { "d", 1,             Phase::BEGIN   }, R"({"name":"d","ph":"B","ts":333333.333,"pid":0,"tid":2})" },
+        { 1'000'000'000, 3, { "e", 0xFFFF'FFFF'FFFF, Phase::END  }, R"({"name":"e","ph":"E","ts":281474976710.655,"pid":0,"tid":3})" },
+
+        // clang-format on
+    };
+
+    for ( auto const test_case : test_cases ) {
+        auto stream = Output_String_Stream{};
+
+        EXPECT_FALSE( write( stream, test_case.clock_frequency, test_case.thread, test_case.event )
+                          .is_error() );
+
+        EXPECT_EQ( stream.string(), test_case.json );
+    } // for
+}
+
+/**
+ * \brief Verify picolibrary::Trace::Chrome::write( picolibrary::Output_Stream &,
+ *        std::uint_fast64_t, picolibrary::Trace::Buffer const * const *,
+ *        picolibrary::Trace::Buffer const * const * ) works properly.
+ */
+TEST( writeBuffers, worksProperly )
+{
+    auto main   = Buffer{ 0, clock };
+    auto worker = Buffer{ 1, clock };
+
+    now = 1;
+    main.record( "loop", Phase::BEGIN );
+    now = 2;
+    worker.record( "sample", Phase::INSTANT );
+    now = 3;
+    main.record( "loop", Phase::END );
+
+    Buffer const * const buffers[]{ &main, &worker };
+
+    auto stream = Output_String_Stream{};
+
+    EXPECT_FALSE( write( stream, 1'000'000, buffers, buffers + 2 ).is_error() );
+
+    EXPECT_EQ(
+        stream.string(),
+        "{\"traceEvents\":[\n"
+        "{\"name\":\"loop\",\"ph\":\"B\",\"ts\":1.000,\"pid\":0,\"tid\":0},\n"
+        "{\"name\":\"loop\",\"ph\":\"E\",\"ts\":3.000,\"pid\":0,\"tid\":0},\n"
+        "{\"name\":\"sample\",\"ph\":\"i\",\"ts\":2.000,\"pid\":0,\"tid\":1,\"s\":\"t\"}\n"
+        "],\"displayTimeUnit\":\"ns\"}\n" );
+}
+
+/**
+ * \brief Verify picolibrary::Trace::Chrome::write( picolibrary::Output_Stream &,
+ *        std::uint_fast64_t, picolibrary::Trace::Buffer const & ) works properly when
+ *        the buffer is empty.
+ */
+TEST( writeBuffer, empty )
+{
+    auto const buffer = Buffer{ 0, clock };
+
+    auto stream = Output_String_Stream{};
+
+    EXPECT_FALSE( write( stream, 1'000'000, buffer ).is_error() );
+
+    EXPECT_EQ( stream.string(), "{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\"}\n" );
+}
+
+/**
+ * \brief Verify picolibrary::Trace::Chrome::write( picolibrary::Output_Stream &,
+ *        std::uint_fast64_t, picolibrary::Trace::Buffer const & ) properly handles a
+ *        stream error.
+ */
+TEST( writeBuffer, streamError )
+{
+    auto buffer = Buffer{ 0, clock };
+
+    buffer.record( "event", Phase::INSTANT );
+
+    auto stream = Mock_Output_Stream{};
+
+    auto const error = random<Mock_Error>();
+
+    EXPECT_CALL( stream.buffer(), put( A<std::string>() ) ).WillOnce( Return( error ) );
+
+    auto const result = write( stream, 1'000'000, buffer );
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Execute the picolibrary::Trace::Chrome unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
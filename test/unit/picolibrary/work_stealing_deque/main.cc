@@ -0,0 +1,150 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2021, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Work_Stealing_Deque unit test program.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/testing/unit/random.h"
+#include "picolibrary/work_stealing_deque.h"
+
+namespace {
+
+using ::picolibrary::Work_Stealing_Deque;
+using ::picolibrary::Testing::Unit::random;
+using ::picolibrary::Testing::Unit::random_container;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Work_Stealing_Deque::push(),
+ *        picolibrary::Work_Stealing_Deque::pop(), and
+ *        picolibrary::Work_Stealing_Deque::steal() work properly.
+ */
+TEST( pushPopSteal, worksProperly )
+{
+    auto deque = Work_Stealing_Deque<std::uint32_t, 8>{};
+
+    EXPECT_TRUE( deque.empty() );
+    EXPECT_EQ( deque.capacity(), 8 );
+
+    auto const values = random_container<std::vector<std::uint32_t>>( 8 );
+
+    for ( auto const value : values ) {
+        EXPECT_TRUE( deque.push( value ) );
+    } // for
+
+    EXPECT_FALSE( deque.push( random<std::uint32_t>() ) );
+
+    auto value = std::uint32_t{};
+
+    EXPECT_TRUE( deque.steal( value ) );
+    EXPECT_EQ( value, values.front() );
+
+    EXPECT_TRUE( deque.pop( value ) );
+    EXPECT_EQ( value, values.back() );
+
+    for ( auto i = values.size() - 2; i; --i ) {
+        EXPECT_TRUE( deque.pop( value ) );
+        EXPECT_EQ( value, values[ i ] );
+    } // for
+
+    EXPECT_TRUE( deque.empty() );
+    EXPECT_FALSE( deque.pop( value ) );
+    EXPECT_FALSE( deque.steal( value ) );
+}
+
+/**
+ * \brief Verify picolibrary::Work_Stealing_Deque works properly when the owner and
+ *        multiple thieves run concurrently.
+ */
+TEST( concurrent, worksProperly )
+{
+    constexpr auto THIEVES  = 3;
+    constexpr auto ELEMENTS = std::uint32_t{ 20'000 };
+
+    auto deque = Work_Stealing_Deque<std::uint32_t, 256>{};
+
+    auto taken = std::atomic<std::uint32_t>{};
+    auto sum   = std::atomic<std::uint64_t>{};
+
+    auto thieves = std::vector<std::thread>{};
+    for ( auto thief = 0; thief < THIEVES; ++thief ) {
+        thieves.emplace_back( [ & ]() {
+            while ( taken.load() < ELEMENTS ) {
+                auto value = std::uint32_t{};
+                if ( deque.steal( value ) ) {
+                    sum += value;
+                    ++taken;
+                } else {
+                    std::this_thread::yield();
+                } // else
+            }     // while
+        } );
+    } // for
+
+    for ( auto value = std::uint32_t{ 1 }; value <= ELEMENTS; ) {
+        if ( deque.push( value ) ) {
+            ++value;
+        } else {
+            std::this_thread::yield();
+        } // else
+
+        if ( value % 3 == 0 ) {
+            auto popped = std::uint32_t{};
+            if ( deque.pop( popped ) ) {
+                sum += popped;
+                ++taken;
+            } // if
+        } // if
+    }     // for
+
+    for ( auto value = std::uint32_t{}; deque.pop( value ); ) {
+        sum += value;
+        ++taken;
+    } // for
+
+    for ( auto & thief : thieves ) {
+        thief.join();
+    } // for
+
+    EXPECT_EQ( taken.load(), ELEMENTS );
+    EXPECT_EQ( sum.load(), std::uint64_t{ ELEMENTS } * ( ELEMENTS + 1 ) / 2 );
+}
+
+/**
+ * \brief Execute the picolibrary::Work_Stealing_Deque unit tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}